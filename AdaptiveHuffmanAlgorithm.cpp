@@ -0,0 +1,249 @@
+/** @file AdaptiveHuffmanAlgorithm.cpp
+ @author Anthony Campos
+ @date 10/19/2026
+ This implementation file implements an AdaptiveHuffmanAlgorithm object, a live HuffmanAlgorithm
+ whose counts keep growing and whose codebook is rebuilt only when it pays off */
+
+//---------------------------------------------------------------------------
+// AdaptiveHuffmanAlgorithm class:  Huffman Coding with incremental counts
+//   included features:
+//   -- allows construction by 64 bit array that represents char counts for 'a' - 'z'
+//   -- allows for adding observed counts or text to the live counts
+//   -- tracks the bits the current codes spend on the live counts against the
+//			bits an optimal Huffman code would spend
+//   -- rebuilds the HuffmanAlgorithm only when the estimated savings exceed
+//			the rebuild threshold
+//   -- publishes each rebuilt HuffmanAlgorithm atomically, readers holding the
+//			previous one keep using it until they let it go
+//
+// Assumptions:
+//   --  index 0-25 represents 'a' - 'z' .
+//   --  any number of threads may call codec, updates are serialized
+//---------------------------------------------------------------------------
+
+
+// included .h files
+#include "AdaptiveHuffmanAlgorithm.h"
+
+// Included libraries
+#include <cmath>
+#include <functional>
+#include <queue>
+#include <vector>
+
+
+/** Constructor
+@pre all indexes must have a integer value >= 0, rebuildThreshold >= 0
+@post AdaptiveHuffmanAlgorithm Object is created and the first HuffmanAlgorithm published
+@parm long long* [] [counts], frequency for each letter from 'a' to 'z',
+double [rebuildThreshold] bits a rebuild has to save*/
+AdaptiveHuffmanAlgorithm::AdaptiveHuffmanAlgorithm(long long(&counts)[NUM_LETTERS], double rebuildThreshold)
+	:currentBits_(0.0), rebuildThreshold_(rebuildThreshold), rebuildCount_(0) {
+
+	for (int i = 0; i < NUM_LETTERS; ++i) {
+
+		counts_[i] = counts[i];
+
+	} // end for
+
+	std::lock_guard<std::mutex> lock(updateMutex_);
+	publish();
+
+} // End of Constructor
+
+/** addCounts
+@pre all indexes must have a integer value >= 0
+@post counts added to the live counts, codec rebuilt if the savings exceed the threshold
+@parm long long* [] [counts], frequency for each letter from 'a' to 'z'
+@return true if a new codec was published*/
+bool AdaptiveHuffmanAlgorithm::addCounts(const long long(&counts)[NUM_LETTERS]) {
+
+	std::lock_guard<std::mutex> lock(updateMutex_);
+
+	for (int i = 0; i < NUM_LETTERS; ++i) {
+
+		counts_[i] += counts[i];
+		currentBits_ += static_cast<double>(counts[i]) * codeLengths_[i];
+
+	} // end for
+
+	return checkRebuild();
+
+} // End of addCounts
+
+/** addText
+@pre None
+@post every lowercase letter of text counted, codec rebuilt if the savings exceed the threshold
+@parm std::string [text]
+@return true if a new codec was published*/
+bool AdaptiveHuffmanAlgorithm::addText(const std::string& text) {
+
+	long long counts[NUM_LETTERS] = {};
+
+	for (unsigned int i = 0; i < text.size(); ++i) {
+
+		char c = text[i];
+		// only valid char 'a' - 'z'
+		if (c >= 'a' && c <= 'z') {
+
+			++counts[c - 'a'];
+
+		} // end if
+
+	} // end for
+
+	return addCounts(counts);
+
+} // End of addText
+
+/** rebuild
+@pre None
+@post codec rebuilt from the live counts and published, whatever the savings*/
+void AdaptiveHuffmanAlgorithm::rebuild() {
+
+	std::lock_guard<std::mutex> lock(updateMutex_);
+	publish();
+	++rebuildCount_;
+
+} // End of rebuild
+
+/** codec
+@pre None
+@post None
+@return the currently published HuffmanAlgorithm, safe to keep while others are published*/
+std::shared_ptr<const HuffmanAlgorithm> AdaptiveHuffmanAlgorithm::codec() const {
+
+	return std::atomic_load(&codec_);
+
+} // End of codec
+
+/** estimatedSavings
+@pre None
+@post None
+@return bits the current codes spend on the live counts above an optimal Huffman code*/
+double AdaptiveHuffmanAlgorithm::estimatedSavings() const {
+
+	std::lock_guard<std::mutex> lock(updateMutex_);
+	return currentBits_ - optimalBits(counts_);
+
+} // End of estimatedSavings
+
+/** rebuildCount
+@pre None
+@post None
+@return number of codecs published after the first one*/
+int AdaptiveHuffmanAlgorithm::rebuildCount() const {
+
+	std::lock_guard<std::mutex> lock(updateMutex_);
+	return rebuildCount_;
+
+} // End of rebuildCount
+
+/** checkRebuild
+@pre updateMutex_ held
+@post codec rebuilt if the savings over the live counts exceed the threshold
+@return true if a new codec was published*/
+bool AdaptiveHuffmanAlgorithm::checkRebuild() {
+
+	bool rebuilt = false;
+
+	// no code beats the entropy, so the cheap bound rules out most checks
+	if (currentBits_ - entropyBits(counts_) > rebuildThreshold_) {
+
+		if (currentBits_ - optimalBits(counts_) > rebuildThreshold_) {
+
+			publish();
+			++rebuildCount_;
+			rebuilt = true;
+
+		} // end if
+
+	} // end if
+
+	return rebuilt;
+
+} // End of checkRebuild
+
+/** publish
+@pre updateMutex_ held
+@post codec built from the live counts, its code lengths recorded and it is published*/
+void AdaptiveHuffmanAlgorithm::publish() {
+
+	std::shared_ptr<const HuffmanAlgorithm> built = std::make_shared<const HuffmanAlgorithm>(counts_);
+
+	currentBits_ = 0.0;
+	char letter = 'a';
+	for (int i = 0; i < NUM_LETTERS; ++i) {
+
+		codeLengths_[i] = built->codeLength(letter);
+		currentBits_ += static_cast<double>(counts_[i]) * codeLengths_[i];
+		++letter;
+
+	} // end for
+
+	std::atomic_store(&codec_, built);
+
+} // End of publish
+
+/** optimalBits
+@pre None
+@post None
+@parm long long* [] [counts]
+@return bits an optimal Huffman code spends on counts, the sum of its internal node weights*/
+double AdaptiveHuffmanAlgorithm::optimalBits(const long long(&counts)[NUM_LETTERS]) {
+
+	std::priority_queue<double, std::vector<double>, std::greater<double>> weights;
+
+	for (int i = 0; i < NUM_LETTERS; ++i) {
+
+		weights.push(static_cast<double>(counts[i]));
+
+	} // end for
+
+	double bits = 0.0;
+
+	// every merge adds one bit to each count below it
+	while (weights.size() > 1) {
+
+		double first = weights.top();
+		weights.pop();
+		double second = weights.top();
+		weights.pop();
+
+		bits += first + second;
+		weights.push(first + second);
+
+	} // end while
+
+	return bits;
+
+} // End of optimalBits
+
+/** entropyBits
+@pre None
+@post None
+@parm long long* [] [counts]
+@return Shannon entropy of counts in bits, a lower bound of optimalBits*/
+double AdaptiveHuffmanAlgorithm::entropyBits(const long long(&counts)[NUM_LETTERS]) {
+
+	double total = 0.0;
+	for (int i = 0; i < NUM_LETTERS; ++i) {
+
+		total += counts[i];
+
+	} // end for
+
+	double bits = 0.0;
+	for (int i = 0; i < NUM_LETTERS; ++i) {
+
+		if (counts[i] > 0) {
+
+			bits += counts[i] * std::log2(total / counts[i]);
+
+		} // end if
+
+	} // end for
+
+	return bits;
+
+} // End of entropyBits
@@ -0,0 +1,136 @@
+/** @file AdaptiveHuffmanAlgorithm.h
+ @author Anthony Campos
+ @date 10/19/2026
+ This header class file implements an AdaptiveHuffmanAlgorithm object, a live HuffmanAlgorithm
+ whose counts keep growing and whose codebook is rebuilt only when it pays off */
+
+	//---------------------------------------------------------------------------
+	// AdaptiveHuffmanAlgorithm class:  Huffman Coding with incremental counts
+	//   included features:
+	//   -- allows construction by 64 bit array that represents char counts for 'a' - 'z'
+	//   -- allows for adding observed counts or text to the live counts
+	//   -- tracks the bits the current codes spend on the live counts against the
+	//			bits an optimal Huffman code would spend
+	//   -- rebuilds the HuffmanAlgorithm only when the estimated savings exceed
+	//			the rebuild threshold
+	//   -- publishes each rebuilt HuffmanAlgorithm atomically, readers holding the
+	//			previous one keep using it until they let it go
+	//
+	// Assumptions:
+	//   --  index 0-25 represents 'a' - 'z' .
+	//   --  any number of threads may call codec, updates are serialized
+	//---------------------------------------------------------------------------
+
+#pragma once
+
+// Included libraries
+#include <memory>
+#include <mutex>
+#include <string>
+
+// included .h files
+#include "HuffmanAlgorithm.h"
+
+// Default number of bits a rebuild has to save
+const double DEFAULT_REBUILD_THRESHOLD = 4096.0;
+
+
+class AdaptiveHuffmanAlgorithm {
+
+public:
+
+	/** Constructors */
+
+	/** Constructor
+	@pre all indexes must have a integer value >= 0, rebuildThreshold >= 0
+	@post AdaptiveHuffmanAlgorithm Object is created and the first HuffmanAlgorithm published
+	@parm long long* [] [counts], frequency for each letter from 'a' to 'z',
+	double [rebuildThreshold] bits a rebuild has to save*/
+	AdaptiveHuffmanAlgorithm(long long(&counts)[NUM_LETTERS], double rebuildThreshold = DEFAULT_REBUILD_THRESHOLD);
+
+	/** Copy Constructor & Assignment disabled, the published codec is shared with readers */
+	AdaptiveHuffmanAlgorithm(const AdaptiveHuffmanAlgorithm& sourceCodec) = delete;
+	AdaptiveHuffmanAlgorithm& operator=(const AdaptiveHuffmanAlgorithm& rhsCodec) = delete;
+
+	/** Public Methods */
+
+	/** addCounts
+	@pre all indexes must have a integer value >= 0
+	@post counts added to the live counts, codec rebuilt if the savings exceed the threshold
+	@parm long long* [] [counts], frequency for each letter from 'a' to 'z'
+	@return true if a new codec was published*/
+	bool addCounts(const long long(&counts)[NUM_LETTERS]);
+
+	/** addText
+	@pre None
+	@post every lowercase letter of text counted, codec rebuilt if the savings exceed the threshold
+	@parm std::string [text]
+	@return true if a new codec was published*/
+	bool addText(const std::string& text);
+
+	/** rebuild
+	@pre None
+	@post codec rebuilt from the live counts and published, whatever the savings*/
+	void rebuild();
+
+	/** Accessor Methods */
+
+	/** codec
+	@pre None
+	@post None
+	@return the currently published HuffmanAlgorithm, safe to keep while others are published*/
+	std::shared_ptr<const HuffmanAlgorithm> codec() const;
+
+	/** estimatedSavings
+	@pre None
+	@post None
+	@return bits the current codes spend on the live counts above an optimal Huffman code*/
+	double estimatedSavings() const;
+
+	/** rebuildCount
+	@pre None
+	@post None
+	@return number of codecs published after the first one*/
+	int rebuildCount() const;
+
+private:
+
+	/** Private Attributes */
+
+	mutable std::mutex updateMutex_; // serializes updates, readers never take it
+	std::shared_ptr<const HuffmanAlgorithm> codec_; // published codec, atomic access only
+
+	long long counts_[NUM_LETTERS]; // live counts
+	int codeLengths_[NUM_LETTERS]; // code lengths of the published codec
+	double currentBits_; // bits the published codes spend on the live counts
+	double rebuildThreshold_;
+	int rebuildCount_;
+
+	/** Private Methods */
+
+	/** checkRebuild
+	@pre updateMutex_ held
+	@post codec rebuilt if the savings over the live counts exceed the threshold
+	@return true if a new codec was published*/
+	bool checkRebuild();
+
+	/** publish
+	@pre updateMutex_ held
+	@post codec built from the live counts, its code lengths recorded and it is published*/
+	void publish();
+
+	/** optimalBits
+	@pre None
+	@post None
+	@parm long long* [] [counts]
+	@return bits an optimal Huffman code spends on counts, the sum of its internal node weights*/
+	static double optimalBits(const long long(&counts)[NUM_LETTERS]);
+
+	/** entropyBits
+	@pre None
+	@post None
+	@parm long long* [] [counts]
+	@return Shannon entropy of counts in bits, a lower bound of optimalBits*/
+	static double entropyBits(const long long(&counts)[NUM_LETTERS]);
+
+}; // End of AdaptiveHuffmanAlgorithm
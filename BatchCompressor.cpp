@@ -0,0 +1,673 @@
+/** @file BatchCompressor.cpp
+ @author Anthony Campos
+ @date 10/19/2026
+ This implementation file implements a BatchCompressor, which compresses many files at once with
+ HuffmanAlgorithm codes on a work stealing pool of threads, into a single archive */
+
+//---------------------------------------------------------------------------
+// BatchCompressor class:  multi threaded many file compressor
+//   included features:
+//   -- files up to smallFileBytes are grouped into tasks of about blockBytes
+//			that share one codebook, larger files are split into blocks of
+//			blockBytes, each its own task with its own codebook
+//   -- tasks are dealt round robin to one WorkStealingDeque per worker, a
+//			worker that runs dry steals from the others
+//   -- each worker reuses its input buffer and BitWriter, code buffers are
+//			handed back by the writer once written
+//   -- the calling thread writes the tasks to the archive in order as they
+//			finish, so the archive is the same for any number of threads
+//   -- a worker waits before running a task more than BATCH_TASKS_AHEAD_PER_THREAD
+//			x threads past the next one to write, so one slow task cannot let
+//			the rest of the archive pile up in memory
+//   -- allows for listing an archive and extracting a file from it
+//
+// Archive layout (little endian):
+//   --  "HUFA", 4 byte format version
+//   --  per task: NUM_LETTERS 8 byte counts, then the packed code of each
+//			piece of the task, every piece starting on a byte
+//   --  manifest: 8 byte file count, per file: 4 byte path length, path,
+//			8 byte input bytes, 4 byte piece count, per piece: 8 byte
+//			counts offset, 8 byte code offset, 8 byte bit count
+//   --  8 byte manifest offset, "HUFA"
+//
+// Assumptions:
+//   --  like HuffmanAlgorithm::getWord, only 'a' - 'z' are compressed,
+//			every other byte of the input is skipped
+//   --  files do not change while they are compressed
+//---------------------------------------------------------------------------
+
+
+// included .h files
+#include "BatchCompressor.h"
+#include "WorkStealingDeque.h"
+#include "ByteOrder.h"
+
+// Included libraries
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#ifndef _WIN32
+#include <dirent.h>
+#include <sys/stat.h>
+#endif
+
+namespace {
+
+	// magic bytes at the start and the end of every archive
+	const char ARCHIVE_MAGIC[4] = { 'H', 'U', 'F', 'A' };
+
+	// longest path the manifest reader accepts
+	const std::uint32_t MAX_ARCHIVE_PATH = 1 << 16;
+
+#ifndef _WIN32
+	/** collectFiles adds the regular files below directory to paths */
+	void collectFiles(const std::string& directory, std::vector<std::string>& paths) {
+
+		DIR* handle = opendir(directory.c_str());
+
+		if (handle != nullptr) {
+
+			struct dirent* item = nullptr;
+			while ((item = readdir(handle)) != nullptr) {
+
+				const std::string name = item->d_name;
+
+				if (name != "." && name != "..") {
+
+					const std::string path = directory + "/" + name;
+					struct stat info;
+
+					// symbolic links are not followed, so a link cycle cannot recurse forever
+					if (lstat(path.c_str(), &info) == 0) {
+
+						if (S_ISDIR(info.st_mode)) {
+							collectFiles(path, paths);
+						}
+						else if (S_ISREG(info.st_mode)) {
+							paths.push_back(path);
+						} // end if
+
+					} // end if
+
+				} // end if
+
+			} // end while
+
+			closedir(handle);
+
+		} // end if
+
+	} // End of collectFiles
+#endif
+
+} // end of namespace
+
+
+/** Constructor
+@pre threads >= 0, smallFileBytes <= blockBytes, blockBytes > 0
+@post BatchCompressor Object created
+@parm int [threads] worker threads, 0 for one per core, std::size_t [smallFileBytes],
+std::size_t [blockBytes]*/
+BatchCompressor::BatchCompressor(int threads, std::size_t smallFileBytes, std::size_t blockBytes)
+	:threads_(threads), smallFileBytes_(smallFileBytes), blockBytes_(blockBytes > 0 ? blockBytes : DEFAULT_BATCH_BLOCK_BYTES),
+	bytesRead_(0), bitsWritten_(0), taskCount_(0), steals_(0) {
+
+	if (threads_ <= 0) {
+		threads_ = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+	} // end if
+
+} // End of Constructor
+
+/** compress
+@pre None
+@post archivePath holds every readable file of paths
+@parm std::vector<std::string> [paths], std::string [archivePath]
+@return true if every file could be read and the archive written, otherwise false*/
+bool BatchCompressor::compress(const std::vector<std::string>& paths, const std::string& archivePath) {
+
+	bytesRead_ = 0;
+	bitsWritten_ = 0;
+	taskCount_ = 0;
+	steals_ = 0;
+
+	bool allRead = true;
+
+	// sizes decide the plan, files that cannot be opened are left out
+	std::vector<std::string> readable;
+	std::vector<std::uint64_t> sizes;
+
+	for (std::size_t i = 0; i < paths.size(); ++i) {
+
+		std::ifstream in(paths[i], std::ios::binary | std::ios::ate);
+		const std::istream::pos_type end = in ? in.tellg() : std::istream::pos_type(-1);
+
+		if (end != std::istream::pos_type(-1)) {
+
+			readable.push_back(paths[i]);
+			sizes.push_back(static_cast<std::uint64_t>(end));
+
+		}
+		else {
+
+			allRead = false;
+
+		} // end if
+
+	} // end for
+
+	std::ofstream out(archivePath, std::ios::binary | std::ios::trunc);
+	if (!out) {
+		return false;
+	} // end if
+
+	out.write(ARCHIVE_MAGIC, sizeof(ARCHIVE_MAGIC));
+	writeUint(out, BATCH_FORMAT_VERSION, 4);
+
+	std::vector<Task> tasks;
+	plan(sizes, tasks);
+	taskCount_ = tasks.size();
+
+	// deal the tasks round robin, pushed last first so each owner pops its earliest task
+	std::vector<std::unique_ptr<WorkStealingDeque<std::size_t>>> deques;
+	for (int w = 0; w < threads_; ++w) {
+		deques.emplace_back(new WorkStealingDeque<std::size_t>());
+	} // end for
+
+	for (std::size_t t = tasks.size(); t > 0; --t) {
+
+		std::size_t task = t - 1;
+		deques[task % threads_]->push(task);
+
+	} // end for
+
+	std::vector<TaskResult> results(tasks.size());
+	std::vector<std::vector<unsigned char>> freeBuffers; // code buffers handed back by the writer
+	std::size_t nextToWrite = 0;
+	const std::size_t tasksAhead = static_cast<std::size_t>(BATCH_TASKS_AHEAD_PER_THREAD) * threads_;
+	std::mutex resultMutex;
+	std::condition_variable resultReady;
+	std::atomic<std::uint64_t> steals(0);
+
+	std::vector<std::thread> workers;
+	for (int w = 0; w < threads_; ++w) {
+
+		workers.emplace_back([&, w]() {
+
+			Scratch scratch;
+			std::size_t task = 0;
+			bool working = true;
+
+			while (working) {
+
+				bool found = deques[w]->pop(task);
+
+				for (int victim = 1; !found && victim < threads_; ++victim) {
+
+					found = deques[(w + victim) % threads_]->steal(task);
+					if (found) {
+						++steals;
+					} // end if
+
+				} // end for
+
+				// no task is ever added once workers start, every deque empty means done
+				working = found;
+
+				if (working) {
+
+					TaskResult result;
+					{
+						// an owner pops its tasks in order, so the next task to write is
+						// always popped by a worker that is not waiting here
+						std::unique_lock<std::mutex> lock(resultMutex);
+						resultReady.wait(lock, [&]() { return task < nextToWrite + tasksAhead; });
+
+						if (!freeBuffers.empty()) {
+
+							result.code_.swap(freeBuffers.back());
+							freeBuffers.pop_back();
+
+						} // end if
+					}
+
+					runTask(tasks[task], readable, scratch, result);
+
+					{
+						std::lock_guard<std::mutex> lock(resultMutex);
+						results[task] = std::move(result);
+						results[task].done_ = true;
+					}
+					resultReady.notify_all();
+
+				} // end if
+
+			} // end while
+
+		});
+
+	} // end for
+
+	// write the tasks in order as they finish, recording where every piece went
+	std::vector<BatchEntry> entries(readable.size());
+	for (std::size_t i = 0; i < readable.size(); ++i) {
+
+		entries[i].path_ = readable[i];
+		entries[i].inputBytes_ = sizes[i];
+
+	} // end for
+
+	for (std::size_t t = 0; t < tasks.size(); ++t) {
+
+		TaskResult result;
+		{
+			std::unique_lock<std::mutex> lock(resultMutex);
+			resultReady.wait(lock, [&]() { return results[t].done_; });
+			result = std::move(results[t]);
+		}
+
+		allRead = allRead && result.read_;
+
+		const std::uint64_t countsOffset = static_cast<std::uint64_t>(out.tellp());
+		for (int i = 0; i < NUM_LETTERS; ++i) {
+
+			writeUint(out, static_cast<std::uint64_t>(result.counts_[i]), 8);
+
+		} // end for
+
+		const std::uint64_t codeOffset = static_cast<std::uint64_t>(out.tellp());
+		out.write(reinterpret_cast<const char*>(result.code_.data()), static_cast<std::streamsize>(result.code_.size()));
+
+		for (std::size_t p = 0; p < tasks[t].pieces_.size(); ++p) {
+
+			BatchPiece piece;
+			piece.countsOffset_ = countsOffset;
+			piece.codeOffset_ = codeOffset + result.pieceBytes_[p];
+			piece.bitCount_ = result.pieceBits_[p];
+
+			entries[tasks[t].pieces_[p].file_].pieces_.push_back(piece);
+			bytesRead_ += tasks[t].pieces_[p].length_;
+			bitsWritten_ += piece.bitCount_;
+
+		} // end for
+
+		result.code_.clear();
+		{
+			std::lock_guard<std::mutex> lock(resultMutex);
+			freeBuffers.push_back(std::move(result.code_));
+			nextToWrite = t + 1;
+		}
+		resultReady.notify_all();
+
+	} // end for
+
+	for (std::size_t w = 0; w < workers.size(); ++w) {
+		workers[w].join();
+	} // end for
+
+	steals_ = steals;
+
+	// manifest, then its offset so a reader can find it from the end
+	const std::uint64_t manifestOffset = static_cast<std::uint64_t>(out.tellp());
+	writeUint(out, entries.size(), 8);
+
+	for (std::size_t i = 0; i < entries.size(); ++i) {
+
+		writeUint(out, entries[i].path_.size(), 4);
+		out.write(entries[i].path_.data(), static_cast<std::streamsize>(entries[i].path_.size()));
+		writeUint(out, entries[i].inputBytes_, 8);
+		writeUint(out, entries[i].pieces_.size(), 4);
+
+		for (std::size_t p = 0; p < entries[i].pieces_.size(); ++p) {
+
+			writeUint(out, entries[i].pieces_[p].countsOffset_, 8);
+			writeUint(out, entries[i].pieces_[p].codeOffset_, 8);
+			writeUint(out, entries[i].pieces_[p].bitCount_, 8);
+
+		} // end for
+
+	} // end for
+
+	writeUint(out, manifestOffset, 8);
+	out.write(ARCHIVE_MAGIC, sizeof(ARCHIVE_MAGIC));
+	out.flush();
+
+	return allRead && static_cast<bool>(out);
+
+} // End of compress
+
+/** plan
+@pre sizes[i] is the size of file i
+@post tasks holds the groups of small files and the blocks of large files, in file order
+@parm std::vector<std::uint64_t> [sizes], std::vector<Task> [tasks] passed by reference*/
+void BatchCompressor::plan(const std::vector<std::uint64_t>& sizes, std::vector<Task>& tasks) const {
+
+	tasks.clear();
+
+	Task group;
+	std::uint64_t groupBytes = 0;
+
+	for (std::size_t file = 0; file < sizes.size(); ++file) {
+
+		Piece piece;
+		piece.file_ = file;
+
+		if (sizes[file] <= smallFileBytes_) {
+
+			if (!group.pieces_.empty() && groupBytes + sizes[file] > blockBytes_) {
+
+				tasks.push_back(group);
+				group.pieces_.clear();
+				groupBytes = 0;
+
+			} // end if
+
+			piece.length_ = sizes[file];
+			group.pieces_.push_back(piece);
+			groupBytes += sizes[file];
+
+		}
+		else {
+
+			for (std::uint64_t offset = 0; offset < sizes[file]; offset += blockBytes_) {
+
+				Task block;
+				piece.offset_ = offset;
+				piece.length_ = std::min<std::uint64_t>(blockBytes_, sizes[file] - offset);
+				block.pieces_.push_back(piece);
+				tasks.push_back(block);
+
+			} // end for
+
+		} // end if
+
+	} // end for
+
+	if (!group.pieces_.empty()) {
+		tasks.push_back(group);
+	} // end if
+
+} // End of plan
+
+/** runTask
+@pre None
+@post result holds the counts and code of task, read_ false if a piece could not be read
+@parm Task [task], std::vector<std::string> [paths], Scratch [scratch] & TaskResult [result]
+passed by reference*/
+void BatchCompressor::runTask(const Task& task, const std::vector<std::string>& paths, Scratch& scratch,
+	TaskResult& result) const {
+
+	// read every piece into the scratch buffer, one after the other
+	std::size_t total = 0;
+	for (std::size_t p = 0; p < task.pieces_.size(); ++p) {
+		total += static_cast<std::size_t>(task.pieces_[p].length_);
+	} // end for
+
+	if (scratch.input_.size() < total) {
+		scratch.input_.resize(total);
+	} // end if
+
+	result.read_ = true;
+	std::size_t filled = 0;
+	std::vector<std::size_t> starts;
+
+	for (std::size_t p = 0; p < task.pieces_.size(); ++p) {
+
+		const Piece& piece = task.pieces_[p];
+		starts.push_back(filled);
+
+		std::ifstream in(paths[piece.file_], std::ios::binary);
+		in.seekg(static_cast<std::istream::off_type>(piece.offset_));
+		in.read(scratch.input_.data() + filled, static_cast<std::streamsize>(piece.length_));
+
+		const std::size_t read = static_cast<std::size_t>(in.gcount());
+		result.read_ = result.read_ && read == piece.length_;
+
+		// a short read is coded as the bytes that were there
+		std::fill(scratch.input_.begin() + filled + read, scratch.input_.begin() + filled + piece.length_, 0);
+		filled += static_cast<std::size_t>(piece.length_);
+
+	} // end for
+
+	starts.push_back(filled);
+
+	for (std::size_t i = 0; i < filled; ++i) {
+
+		const char c = scratch.input_[i];
+		// only valid char 'a' - 'z'
+		if (c >= 'a' && c <= 'z') {
+			++result.counts_[c - 'a'];
+		} // end if
+
+	} // end for
+
+	HuffmanAlgorithm codec(result.counts_);
+
+	// 26 letters give codes of at most 25 bits
+	std::uint64_t codeBits[NUM_LETTERS];
+	int codeLengths[NUM_LETTERS];
+	char letter = 'a';
+
+	for (int i = 0; i < NUM_LETTERS; ++i) {
+
+		codeBits[i] = codec.codeBits(letter);
+		codeLengths[i] = codec.codeLength(letter);
+		++letter;
+
+	} // end for
+
+	// the writer is byte aligned between pieces, its bit count keeps running across tasks
+	BitWriter& writer = scratch.writer_;
+
+	for (std::size_t p = 0; p < task.pieces_.size(); ++p) {
+
+		result.pieceBytes_.push_back(writer.bytes().size());
+		const std::uint64_t startBits = writer.bitCount();
+
+		for (std::size_t i = starts[p]; i < starts[p + 1]; ++i) {
+
+			const char c = scratch.input_[i];
+			if (c >= 'a' && c <= 'z') {
+				writer.writeBits(codeBits[c - 'a'], codeLengths[c - 'a']);
+			} // end if
+
+		} // end for
+
+		result.pieceBits_.push_back(writer.bitCount() - startBits);
+		writer.finish();
+
+	} // end for
+
+	writer.swapBytes(result.code_);
+
+} // End of runTask
+
+/** list
+@pre None
+@post entries holds the manifest of archivePath
+@parm std::string [archivePath], std::vector<BatchEntry> [entries] passed by reference
+@return true if archivePath is an archive with a readable manifest, every piece before it*/
+bool BatchCompressor::list(const std::string& archivePath, std::vector<BatchEntry>& entries) {
+
+	entries.clear();
+
+	std::ifstream in(archivePath, std::ios::binary | std::ios::ate);
+	const std::istream::pos_type end = in ? in.tellg() : std::istream::pos_type(-1);
+	bool valid = end != std::istream::pos_type(-1) && static_cast<std::uint64_t>(end) >= 8 + 12;
+
+	char magic[4] = {};
+
+	if (valid) {
+
+		in.seekg(0);
+		in.read(magic, sizeof(magic));
+		valid = std::equal(magic, magic + 4, ARCHIVE_MAGIC) && readUint(in, 4) == BATCH_FORMAT_VERSION;
+
+	} // end if
+
+	std::uint64_t manifestOffset = 0;
+	if (valid) {
+
+		in.seekg(end - static_cast<std::istream::off_type>(12));
+		manifestOffset = readUint(in, 8);
+		in.read(magic, sizeof(magic));
+		valid = in && std::equal(magic, magic + 4, ARCHIVE_MAGIC) && manifestOffset < static_cast<std::uint64_t>(end);
+
+	} // end if
+
+	if (valid) {
+
+		in.seekg(static_cast<std::istream::off_type>(manifestOffset));
+		const std::uint64_t fileCount = readUint(in, 8);
+
+		for (std::uint64_t i = 0; valid && i < fileCount; ++i) {
+
+			BatchEntry entry;
+			const std::uint32_t pathLength = static_cast<std::uint32_t>(readUint(in, 4));
+			valid = in && pathLength <= MAX_ARCHIVE_PATH;
+
+			if (valid) {
+
+				entry.path_.resize(pathLength);
+				in.read(&entry.path_[0], pathLength);
+				entry.inputBytes_ = readUint(in, 8);
+
+				const std::uint32_t pieceCount = static_cast<std::uint32_t>(readUint(in, 4));
+				for (std::uint32_t p = 0; valid && p < pieceCount; ++p) {
+
+					BatchPiece piece;
+					piece.countsOffset_ = readUint(in, 8);
+					piece.codeOffset_ = readUint(in, 8);
+					piece.bitCount_ = readUint(in, 8);
+
+					// every piece lies before the manifest, sums kept from wrapping near 2^64
+					const std::uint64_t codeBytes = (piece.bitCount_ >> 3) + ((piece.bitCount_ & 7) != 0 ? 1 : 0);
+					valid = in && piece.countsOffset_ <= manifestOffset && NUM_LETTERS * 8 <= manifestOffset - piece.countsOffset_
+						&& piece.codeOffset_ <= manifestOffset && codeBytes <= manifestOffset - piece.codeOffset_;
+
+					entry.pieces_.push_back(piece);
+
+				} // end for
+
+				valid = valid && static_cast<bool>(in);
+				entries.push_back(entry);
+
+			} // end if
+
+		} // end for
+
+	} // end if
+
+	return valid;
+
+} // End of list
+
+/** extract
+@pre entry was listed from archivePath
+@post the letters of entry's file written to out
+@parm std::string [archivePath], BatchEntry [entry], std::ostream [out] passed by reference
+@return true if every piece could be read and out written*/
+bool BatchCompressor::extract(const std::string& archivePath, const BatchEntry& entry, std::ostream& out) {
+
+	std::ifstream in(archivePath, std::ios::binary);
+	bool extracted = static_cast<bool>(in);
+
+	for (std::size_t p = 0; extracted && p < entry.pieces_.size(); ++p) {
+
+		const BatchPiece& piece = entry.pieces_[p];
+
+		long long counts[NUM_LETTERS];
+		in.seekg(static_cast<std::istream::off_type>(piece.countsOffset_));
+		for (int i = 0; i < NUM_LETTERS; ++i) {
+
+			counts[i] = static_cast<long long>(readUint(in, 8));
+
+		} // end for
+
+		PackedCode code;
+		code.bitCount_ = piece.bitCount_;
+		code.bytes_.resize(static_cast<std::size_t>((piece.bitCount_ >> 3) + ((piece.bitCount_ & 7) != 0 ? 1 : 0)));
+
+		in.seekg(static_cast<std::istream::off_type>(piece.codeOffset_));
+		in.read(reinterpret_cast<char*>(code.bytes_.data()), static_cast<std::streamsize>(code.bytes_.size()));
+		extracted = static_cast<bool>(in);
+
+		if (extracted) {
+
+			HuffmanAlgorithm codec(counts);
+			const std::string text = codec.decode(code);
+			out.write(text.data(), static_cast<std::streamsize>(text.size()));
+			extracted = static_cast<bool>(out);
+
+		} // end if
+
+	} // end for
+
+	return extracted;
+
+} // End of extract
+
+/** listDirectory
+@pre None
+@post None
+@parm std::string [directory]
+@return path of every regular file below directory, sorted. Empty where POSIX
+directory functions are not available*/
+std::vector<std::string> BatchCompressor::listDirectory(const std::string& directory) {
+
+	std::vector<std::string> paths;
+
+#ifndef _WIN32
+	collectFiles(directory, paths);
+	std::sort(paths.begin(), paths.end());
+#else
+	(void)directory;
+#endif
+
+	return paths;
+
+} // End of listDirectory
+
+/** threads
+@return number of worker threads*/
+int BatchCompressor::threads() const {
+
+	return threads_;
+
+} // End of threads
+
+/** bytesRead
+@return bytes of input read by the last compress*/
+std::uint64_t BatchCompressor::bytesRead() const {
+
+	return bytesRead_;
+
+} // End of bytesRead
+
+/** bitsWritten
+@return code bits written by the last compress, headers and padding excluded*/
+std::uint64_t BatchCompressor::bitsWritten() const {
+
+	return bitsWritten_;
+
+} // End of bitsWritten
+
+/** taskCount
+@return number of tasks of the last compress*/
+std::size_t BatchCompressor::taskCount() const {
+
+	return taskCount_;
+
+} // End of taskCount
+
+/** steals
+@return number of tasks of the last compress run by a worker they were not dealt to*/
+std::uint64_t BatchCompressor::steals() const {
+
+	return steals_;
+
+} // End of steals
@@ -0,0 +1,217 @@
+/** @file BatchCompressor.h
+ @author Anthony Campos
+ @date 10/19/2026
+ This header class file implements a BatchCompressor, which compresses many files at once with
+ HuffmanAlgorithm codes on a work stealing pool of threads, into a single archive */
+
+	//---------------------------------------------------------------------------
+	// BatchCompressor class:  multi threaded many file compressor
+	//   included features:
+	//   -- files up to smallFileBytes are grouped into tasks of about blockBytes
+	//			that share one codebook, larger files are split into blocks of
+	//			blockBytes, each its own task with its own codebook
+	//   -- tasks are dealt round robin to one WorkStealingDeque per worker, a
+	//			worker that runs dry steals from the others
+	//   -- each worker reuses its input buffer and BitWriter, code buffers are
+	//			handed back by the writer once written
+	//   -- the calling thread writes the tasks to the archive in order as they
+	//			finish, so the archive is the same for any number of threads
+	//   -- a worker waits before running a task more than BATCH_TASKS_AHEAD_PER_THREAD
+	//			x threads past the next one to write, so one slow task cannot let
+	//			the rest of the archive pile up in memory
+	//   -- allows for listing an archive and extracting a file from it
+	//
+	// Archive layout (little endian):
+	//   --  "HUFA", 4 byte format version
+	//   --  per task: NUM_LETTERS 8 byte counts, then the packed code of each
+	//			piece of the task, every piece starting on a byte
+	//   --  manifest: 8 byte file count, per file: 4 byte path length, path,
+	//			8 byte input bytes, 4 byte piece count, per piece: 8 byte
+	//			counts offset, 8 byte code offset, 8 byte bit count
+	//   --  8 byte manifest offset, "HUFA"
+	//
+	// Assumptions:
+	//   --  like HuffmanAlgorithm::getWord, only 'a' - 'z' are compressed,
+	//			every other byte of the input is skipped
+	//   --  files do not change while they are compressed
+	//---------------------------------------------------------------------------
+
+#pragma once
+
+// Included libraries
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// included .h files
+#include "HuffmanAlgorithm.h"
+#include "BitStream.h"
+
+// Files up to this size are grouped with others under one codebook
+const std::size_t DEFAULT_SMALL_FILE_BYTES = 1 << 16;
+
+// Size of each block of a large file, and about the size of a group of small files
+const std::size_t DEFAULT_BATCH_BLOCK_BYTES = 1 << 22;
+
+// Tasks per worker that may finish ahead of the task being written, so at most this
+// many blocks per worker wait in memory however slow one task is
+const int BATCH_TASKS_AHEAD_PER_THREAD = 4;
+
+// Current archive format version
+const std::uint32_t BATCH_FORMAT_VERSION = 1;
+
+
+// Where one piece of a file is in an archive
+struct BatchPiece {
+
+	std::uint64_t countsOffset_ = 0; // the counts its codebook is built from
+	std::uint64_t codeOffset_ = 0; // its packed code
+	std::uint64_t bitCount_ = 0; // code bits, padding excluded
+
+}; // end of BatchPiece
+
+
+// Manifest entry of one file of an archive
+struct BatchEntry {
+
+	std::string path_;
+	std::uint64_t inputBytes_ = 0;
+	std::vector<BatchPiece> pieces_; // in file order
+
+}; // end of BatchEntry
+
+
+class BatchCompressor {
+
+public:
+
+	/** Constructors */
+
+	/** Constructor
+	@pre threads >= 0, smallFileBytes <= blockBytes, blockBytes > 0
+	@post BatchCompressor Object created
+	@parm int [threads] worker threads, 0 for one per core, std::size_t [smallFileBytes],
+	std::size_t [blockBytes]*/
+	explicit BatchCompressor(int threads = 0, std::size_t smallFileBytes = DEFAULT_SMALL_FILE_BYTES,
+		std::size_t blockBytes = DEFAULT_BATCH_BLOCK_BYTES);
+
+	/** Public Methods */
+
+	/** compress
+	@pre None
+	@post archivePath holds every readable file of paths
+	@parm std::vector<std::string> [paths], std::string [archivePath]
+	@return true if every file could be read and the archive written, otherwise false*/
+	bool compress(const std::vector<std::string>& paths, const std::string& archivePath);
+
+	/** list
+	@pre None
+	@post entries holds the manifest of archivePath
+	@parm std::string [archivePath], std::vector<BatchEntry> [entries] passed by reference
+	@return true if archivePath is an archive with a readable manifest, every piece before it*/
+	static bool list(const std::string& archivePath, std::vector<BatchEntry>& entries);
+
+	/** extract
+	@pre entry was listed from archivePath
+	@post the letters of entry's file written to out
+	@parm std::string [archivePath], BatchEntry [entry], std::ostream [out] passed by reference
+	@return true if every piece could be read and out written*/
+	static bool extract(const std::string& archivePath, const BatchEntry& entry, std::ostream& out);
+
+	/** listDirectory
+	@pre None
+	@post None
+	@parm std::string [directory]
+	@return path of every regular file below directory, sorted. Empty where POSIX
+	directory functions are not available*/
+	static std::vector<std::string> listDirectory(const std::string& directory);
+
+	/** Accessor Methods */
+
+	/** threads
+	@return number of worker threads*/
+	int threads() const;
+
+	/** bytesRead
+	@return bytes of input read by the last compress*/
+	std::uint64_t bytesRead() const;
+
+	/** bitsWritten
+	@return code bits written by the last compress, headers and padding excluded*/
+	std::uint64_t bitsWritten() const;
+
+	/** taskCount
+	@return number of tasks of the last compress*/
+	std::size_t taskCount() const;
+
+	/** steals
+	@return number of tasks of the last compress run by a worker they were not dealt to*/
+	std::uint64_t steals() const;
+
+private:
+
+	/** Private Attributes */
+
+	// a range of one file
+	struct Piece {
+
+		std::size_t file_ = 0; // index into the readable files
+		std::uint64_t offset_ = 0;
+		std::uint64_t length_ = 0;
+
+	}; // end of Piece
+
+	// pieces coded with one codebook
+	struct Task {
+
+		std::vector<Piece> pieces_;
+
+	}; // end of Task
+
+	// output of a task, filled by a worker and written by the calling thread
+	struct TaskResult {
+
+		long long counts_[NUM_LETTERS] = {};
+		std::vector<unsigned char> code_; // every piece, each starting on a byte
+		std::vector<std::uint64_t> pieceBytes_; // start of each piece in code_
+		std::vector<std::uint64_t> pieceBits_;
+		bool read_ = false; // every piece could be read
+		bool done_ = false;
+
+	}; // end of TaskResult
+
+	// per worker buffers, kept across tasks
+	struct Scratch {
+
+		std::vector<char> input_;
+		BitWriter writer_;
+
+	}; // end of Scratch
+
+	int threads_;
+	std::size_t smallFileBytes_;
+	std::size_t blockBytes_;
+	std::uint64_t bytesRead_;
+	std::uint64_t bitsWritten_;
+	std::size_t taskCount_;
+	std::uint64_t steals_;
+
+	/** Private Methods */
+
+	/** plan
+	@pre sizes[i] is the size of file i
+	@post tasks holds the groups of small files and the blocks of large files, in file order
+	@parm std::vector<std::uint64_t> [sizes], std::vector<Task> [tasks] passed by reference*/
+	void plan(const std::vector<std::uint64_t>& sizes, std::vector<Task>& tasks) const;
+
+	/** runTask
+	@pre None
+	@post result holds the counts and code of task, read_ false if a piece could not be read
+	@parm Task [task], std::vector<std::string> [paths], Scratch [scratch] & TaskResult [result]
+	passed by reference*/
+	void runTask(const Task& task, const std::vector<std::string>& paths, Scratch& scratch,
+		TaskResult& result) const;
+
+}; // End of BatchCompressor
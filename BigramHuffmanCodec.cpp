@@ -0,0 +1,384 @@
+/** @file BigramHuffmanCodec.cpp
+ @author Anthony Campos
+ @date 10/19/2026
+ This implementation file implements a BigramHuffmanCodec, Huffman Coding over the extended
+ alphabet of letter pairs, so text is coded and decoded two letters at a time */
+
+//---------------------------------------------------------------------------
+// BigramHuffmanCodec class:  extended alphabet Huffman Coding
+//   included features:
+//   -- the letters of the text are split into pairs, each of the
+//			NUM_LETTERS x NUM_LETTERS pairs is one symbol, so a dominant
+//			letter costs well under the one bit an order-0 code spends on it
+//   -- a text of odd length ends with a single letter symbol, one of
+//			NUM_LETTERS more symbols
+//   -- allows construction by pair counts or by a sample text
+//   -- every symbol gets a code (counts are smoothed by 1), so any text
+//			can be encoded with any codebook
+//   -- codes are canonical, a BIGRAM_LOOKUP_BITS table lookup decodes a
+//			whole pair, long and rare codes use the first-code per length search
+//
+// Assumptions:
+//   --  like HuffmanAlgorithm::encode, chars other than 'a' - 'z' are skipped
+//---------------------------------------------------------------------------
+
+
+// included .h files
+#include "BigramHuffmanCodec.h"
+#include "SparseHuffmanCodec.h"
+
+// Included libraries
+#include <algorithm>
+
+
+/** Constructor
+@pre all counts >= 0 & their sum < 2^62
+@post BigramHuffmanCodec Object created, pairCounts[i][j] is the weight of the pair
+('a' + i, 'a' + j). Single letters, used at most once per text, get the smallest weight
+@parm long long* [][] [pairCounts]*/
+BigramHuffmanCodec::BigramHuffmanCodec(const long long(&pairCounts)[NUM_LETTERS][NUM_LETTERS])
+	:minLength_(0), maxLength_(0), bitsPerLetter_(0.0) {
+
+	build(pairCounts);
+
+} // End of Constructor
+
+/** Constructor
+@pre None
+@post BigramHuffmanCodec Object created from the pairs of sample, as countPairs counts them
+@parm std::string [sample]*/
+BigramHuffmanCodec::BigramHuffmanCodec(const std::string& sample)
+	:minLength_(0), maxLength_(0), bitsPerLetter_(0.0) {
+
+	long long pairCounts[NUM_LETTERS][NUM_LETTERS] = {};
+	countPairs(sample, pairCounts);
+
+	build(pairCounts);
+
+} // End of Constructor
+
+/** countPairs
+@pre None
+@post counts updated with every pair the codec would code text as: the 1st and 2nd
+lowercase letter, the 3rd and 4th, and so on. Other chars are skipped
+@parm std::string [text], long long* [][] [counts] passed by reference*/
+void BigramHuffmanCodec::countPairs(const std::string& text, long long(&counts)[NUM_LETTERS][NUM_LETTERS]) {
+
+	int first = -1;
+
+	for (unsigned int i = 0; i < text.size(); ++i) {
+
+		// only valid char 'a' - 'z'
+		if (text[i] >= 'a' && text[i] <= 'z') {
+
+			if (first < 0) {
+
+				first = text[i] - 'a';
+
+			}
+			else {
+
+				++counts[first][text[i] - 'a'];
+				first = -1;
+
+			} // end if
+
+		} // end if
+
+	} // end for
+
+} // End of countPairs
+
+/** build
+@pre all counts >= 0 & their sum < 2^62
+@post codebook and decode tables built
+@parm long long* [][] [pairCounts]*/
+void BigramHuffmanCodec::build(const long long(&pairCounts)[NUM_LETTERS][NUM_LETTERS]) {
+
+	std::vector<long long> counts(BIGRAM_SYMBOLS, 1);
+	long long pairTotal = 0;
+
+	for (int i = 0; i < NUM_LETTERS; ++i) {
+
+		for (int j = 0; j < NUM_LETTERS; ++j) {
+
+			counts[i * NUM_LETTERS + j] += pairCounts[i][j];
+			pairTotal += pairCounts[i][j];
+
+		} // end for
+
+	} // end for
+
+	std::vector<int> treeLengths = SparseHuffmanCodec::codeLengths(counts, MAX_BIGRAM_CODE_LENGTH);
+
+	// canonical order, shorter codes first, ties by symbol
+	sorted_.resize(BIGRAM_SYMBOLS);
+	for (int i = 0; i < BIGRAM_SYMBOLS; ++i) {
+
+		sorted_[i] = i;
+
+	} // end for
+
+	std::sort(sorted_.begin(), sorted_.end(), [&](int lhs, int rhs) {
+
+		return (treeLengths[lhs] != treeLengths[rhs]) ? treeLengths[lhs] < treeLengths[rhs] : lhs < rhs;
+
+	});
+
+	minLength_ = treeLengths[sorted_.front()];
+	maxLength_ = treeLengths[sorted_.back()];
+
+	firstCode_.assign(maxLength_ + 1, 0);
+	firstIndex_.assign(maxLength_ + 1, 0);
+	lengthCount_.assign(maxLength_ + 1, 0);
+
+	// canonical codes, each length starts one past the last code of the previous length
+	std::uint32_t code = 0;
+	int previousLength = minLength_;
+
+	for (int i = 0; i < BIGRAM_SYMBOLS; ++i) {
+
+		const int symbol = sorted_[i];
+		const int length = treeLengths[symbol];
+
+		if (i > 0) {
+
+			code = (code + 1) << (length - previousLength);
+			previousLength = length;
+
+		} // end if
+
+		codes_[symbol] = code;
+		lengths_[symbol] = length;
+
+		if (lengthCount_[length] == 0) {
+
+			firstCode_[length] = code;
+			firstIndex_[length] = i;
+
+		} // end if
+
+		++lengthCount_[length];
+
+	} // end for
+
+	// every BIGRAM_LOOKUP_BITS pattern that starts with a short code maps to its letters
+	lookup_.assign(1u << BIGRAM_LOOKUP_BITS, LookupEntry());
+
+	for (int i = 0; i < BIGRAM_SYMBOLS && lengths_[sorted_[i]] <= BIGRAM_LOOKUP_BITS; ++i) {
+
+		const int symbol = sorted_[i];
+		const int freeBits = BIGRAM_LOOKUP_BITS - lengths_[symbol];
+		const std::uint32_t start = codes_[symbol] << freeBits;
+
+		LookupEntry entry;
+		entry.letterCount_ = static_cast<unsigned char>(symbolLetters(symbol, entry.letters_));
+		entry.length_ = static_cast<unsigned char>(lengths_[symbol]);
+
+		for (std::uint32_t pattern = 0; pattern < (1u << freeBits); ++pattern) {
+
+			lookup_[start | pattern] = entry;
+
+		} // end for
+
+	} // end for
+
+	// expected cost of the counted pairs, the single letter symbols are left out
+	long long pairBits = 0;
+	for (int symbol = 0; symbol < BIGRAM_PAIRS; ++symbol) {
+
+		pairBits += (counts[symbol] - 1) * lengths_[symbol];
+
+	} // end for
+
+	bitsPerLetter_ = (pairTotal > 0) ? static_cast<double>(pairBits) / (2.0 * pairTotal) : 0.0;
+
+} // End of build
+
+/** symbolLetters
+@pre 0 <= symbol < BIGRAM_SYMBOLS
+@post letters holds the letters of symbol
+@parm int [symbol], char* [] [letters] passed by reference
+@return number of letters of symbol, 1 or 2*/
+int BigramHuffmanCodec::symbolLetters(int symbol, char(&letters)[2]) {
+
+	int letterCount = 2;
+
+	if (symbol < BIGRAM_PAIRS) {
+
+		letters[0] = static_cast<char>('a' + symbol / NUM_LETTERS);
+		letters[1] = static_cast<char>('a' + symbol % NUM_LETTERS);
+
+	}
+	else {
+
+		letters[0] = static_cast<char>('a' + symbol - BIGRAM_PAIRS);
+		letters[1] = '\0';
+		letterCount = 1;
+
+	} // end if
+
+	return letterCount;
+
+} // End of symbolLetters
+
+/** encode
+@pre None
+@post the lowercase letters of in are encoded a pair at a time, 8 code bits per byte
+@parm std::string [in]
+@return packed code of in*/
+PackedCode BigramHuffmanCodec::encode(const std::string& in) const {
+
+	BitWriter writer;
+	int first = -1;
+
+	for (unsigned int i = 0; i < in.size(); ++i) {
+
+		// only valid char 'a' - 'z'
+		if (in[i] >= 'a' && in[i] <= 'z') {
+
+			if (first < 0) {
+
+				first = in[i] - 'a';
+
+			}
+			else {
+
+				const int symbol = first * NUM_LETTERS + (in[i] - 'a');
+				writer.writeBits(codes_[symbol], lengths_[symbol]);
+				first = -1;
+
+			} // end if
+
+		} // end if
+
+	} // end for
+
+	// odd number of letters, the last one is coded on its own
+	if (first >= 0) {
+
+		writer.writeBits(codes_[BIGRAM_PAIRS + first], lengths_[BIGRAM_PAIRS + first]);
+
+	} // end if
+
+	writer.finish();
+
+	PackedCode code;
+	code.bitCount_ = writer.bitCount();
+	writer.swapBytes(code.bytes_);
+
+	return code;
+
+} // End of encode
+
+/** decode
+@pre code was made by encode of the current codebook
+@post text representation of the packed code is computed, a trailing incomplete
+code is ignored
+@parm PackedCode [code]
+@return decoded text*/
+std::string BigramHuffmanCodec::decode(const PackedCode& code) const {
+
+	// every code is at least minLength_ bits and yields at most two letters
+	std::string text(static_cast<std::size_t>(code.bitCount_ / minLength_) * 2, '\0');
+	std::size_t size = 0;
+
+	BitReader reader(code.bytes_.data(), code.bitCount_);
+	bool decoding = true;
+
+	while (decoding && reader.remaining() > 0) {
+
+		const LookupEntry& entry = lookup_[reader.peekBits(BIGRAM_LOOKUP_BITS)];
+		decoding = false;
+
+		if (entry.length_ > 0) {
+
+			// short code, one lookup gives both letters. Bits past the end peek as 0
+			if (entry.length_ <= reader.remaining()) {
+
+				text[size] = entry.letters_[0];
+				text[size + 1] = entry.letters_[1];
+				size += entry.letterCount_;
+
+				reader.skipBits(entry.length_);
+				decoding = true;
+
+			} // end if
+
+		}
+		else {
+
+			// long code, find the length whose canonical range holds the prefix
+			for (int length = BIGRAM_LOOKUP_BITS + 1; length <= maxLength_
+				&& static_cast<std::uint64_t>(length) <= reader.remaining() && !decoding; ++length) {
+
+				if (lengthCount_[length] > 0) {
+
+					const std::uint32_t prefix = static_cast<std::uint32_t>(reader.peekBits(length));
+
+					if (prefix >= firstCode_[length] && prefix - firstCode_[length] < static_cast<std::uint32_t>(lengthCount_[length])) {
+
+						char letters[2];
+						const int letterCount = symbolLetters(sorted_[firstIndex_[length] + (prefix - firstCode_[length])], letters);
+
+						text[size] = letters[0];
+						text[size + 1] = letters[1];
+						size += letterCount;
+
+						reader.skipBits(length);
+						decoding = true;
+
+					} // end if
+
+				} // end if
+
+			} // end for
+
+		} // end if
+
+	} // end while
+
+	text.resize(size);
+
+	return text;
+
+} // End of decode
+
+/** codeLength
+@pre None
+@parm char [first], char [second] 'a' - 'z', or '\0' for the single letter symbol of first
+@return code length of the symbol, 0 if first or second is not valid*/
+int BigramHuffmanCodec::codeLength(char first, char second) const {
+
+	int length = 0;
+
+	if (first >= 'a' && first <= 'z') {
+
+		if (second >= 'a' && second <= 'z') {
+			length = lengths_[(first - 'a') * NUM_LETTERS + (second - 'a')];
+		}
+		else if (second == '\0') {
+			length = lengths_[BIGRAM_PAIRS + (first - 'a')];
+		} // end if
+
+	} // end if
+
+	return length;
+
+} // End of codeLength
+
+/** maxCodeLength
+@return length of the longest code*/
+int BigramHuffmanCodec::maxCodeLength() const {
+
+	return maxLength_;
+
+} // End of maxCodeLength
+
+/** bitsPerLetter
+@return average code bits per letter for the pair counts the codec was built from*/
+double BigramHuffmanCodec::bitsPerLetter() const {
+
+	return bitsPerLetter_;
+
+} // End of bitsPerLetter
@@ -0,0 +1,149 @@
+/** @file BigramHuffmanCodec.h
+ @author Anthony Campos
+ @date 10/19/2026
+ This header class file implements a BigramHuffmanCodec, Huffman Coding over the extended
+ alphabet of letter pairs, so text is coded and decoded two letters at a time */
+
+	//---------------------------------------------------------------------------
+	// BigramHuffmanCodec class:  extended alphabet Huffman Coding
+	//   included features:
+	//   -- the letters of the text are split into pairs, each of the
+	//			NUM_LETTERS x NUM_LETTERS pairs is one symbol, so a dominant
+	//			letter costs well under the one bit an order-0 code spends on it
+	//   -- a text of odd length ends with a single letter symbol, one of
+	//			NUM_LETTERS more symbols
+	//   -- allows construction by pair counts or by a sample text
+	//   -- every symbol gets a code (counts are smoothed by 1), so any text
+	//			can be encoded with any codebook
+	//   -- codes are canonical, a BIGRAM_LOOKUP_BITS table lookup decodes a
+	//			whole pair, long and rare codes use the first-code per length search
+	//
+	// Assumptions:
+	//   --  like HuffmanAlgorithm::encode, chars other than 'a' - 'z' are skipped
+	//---------------------------------------------------------------------------
+
+#pragma once
+
+// Included libraries
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// included .h files
+#include "HuffmanTree.h"
+#include "BitStream.h"
+
+// Number of pair symbols, the single letter symbols follow them
+const int BIGRAM_PAIRS = NUM_LETTERS * NUM_LETTERS;
+
+// Number of symbols of the extended alphabet
+const int BIGRAM_SYMBOLS = BIGRAM_PAIRS + NUM_LETTERS;
+
+// Number of bits decoded by a single lookup
+const int BIGRAM_LOOKUP_BITS = 12;
+
+// Longest code BigramHuffmanCodec assigns, longer trees are flattened
+const int MAX_BIGRAM_CODE_LENGTH = 32;
+
+
+class BigramHuffmanCodec {
+
+public:
+
+	/** Constructors */
+
+	/** Constructor
+	@pre all counts >= 0 & their sum < 2^62
+	@post BigramHuffmanCodec Object created, pairCounts[i][j] is the weight of the pair
+	('a' + i, 'a' + j). Single letters, used at most once per text, get the smallest weight
+	@parm long long* [][] [pairCounts]*/
+	explicit BigramHuffmanCodec(const long long(&pairCounts)[NUM_LETTERS][NUM_LETTERS]);
+
+	/** Constructor
+	@pre None
+	@post BigramHuffmanCodec Object created from the pairs of sample, as countPairs counts them
+	@parm std::string [sample]*/
+	explicit BigramHuffmanCodec(const std::string& sample);
+
+	/** Public Methods */
+
+	/** countPairs
+	@pre None
+	@post counts updated with every pair the codec would code text as: the 1st and 2nd
+	lowercase letter, the 3rd and 4th, and so on. Other chars are skipped
+	@parm std::string [text], long long* [][] [counts] passed by reference*/
+	static void countPairs(const std::string& text, long long(&counts)[NUM_LETTERS][NUM_LETTERS]);
+
+	/** encode
+	@pre None
+	@post the lowercase letters of in are encoded a pair at a time, 8 code bits per byte
+	@parm std::string [in]
+	@return packed code of in*/
+	PackedCode encode(const std::string& in) const;
+
+	/** decode
+	@pre code was made by encode of the current codebook
+	@post text representation of the packed code is computed, a trailing incomplete
+	code is ignored
+	@parm PackedCode [code]
+	@return decoded text*/
+	std::string decode(const PackedCode& code) const;
+
+	/** Accessor Methods */
+
+	/** codeLength
+	@pre None
+	@parm char [first], char [second] 'a' - 'z', or '\0' for the single letter symbol of first
+	@return code length of the symbol, 0 if first or second is not valid*/
+	int codeLength(char first, char second) const;
+
+	/** maxCodeLength
+	@return length of the longest code*/
+	int maxCodeLength() const;
+
+	/** bitsPerLetter
+	@return average code bits per letter for the pair counts the codec was built from*/
+	double bitsPerLetter() const;
+
+private:
+
+	/** Private Attributes */
+
+	// single lookup decode entry, length 0 when the code is longer than BIGRAM_LOOKUP_BITS
+	struct LookupEntry {
+
+		char letters_[2] = { '\0', '\0' };
+		unsigned char letterCount_ = 0;
+		unsigned char length_ = 0;
+
+	}; // end of LookupEntry
+
+	std::uint32_t codes_[BIGRAM_SYMBOLS]; // symbol -> code, right aligned
+	int lengths_[BIGRAM_SYMBOLS]; // symbol -> code length
+	std::vector<LookupEntry> lookup_; // first BIGRAM_LOOKUP_BITS bits -> symbol
+
+	// canonical tables, per code length
+	std::vector<std::uint32_t> firstCode_; // code of the first symbol of each length
+	std::vector<int> firstIndex_; // index into sorted_ of the first symbol of each length
+	std::vector<int> lengthCount_; // symbols of each length
+	std::vector<int> sorted_; // symbols in canonical order
+	int minLength_;
+	int maxLength_;
+	double bitsPerLetter_;
+
+	/** Private Methods */
+
+	/** build
+	@pre all counts >= 0 & their sum < 2^62
+	@post codebook and decode tables built
+	@parm long long* [][] [pairCounts]*/
+	void build(const long long(&pairCounts)[NUM_LETTERS][NUM_LETTERS]);
+
+	/** symbolLetters
+	@pre 0 <= symbol < BIGRAM_SYMBOLS
+	@post letters holds the letters of symbol
+	@parm int [symbol], char* [] [letters] passed by reference
+	@return number of letters of symbol, 1 or 2*/
+	static int symbolLetters(int symbol, char(&letters)[2]);
+
+}; // End of BigramHuffmanCodec
@@ -0,0 +1,246 @@
+/** @file BitPacking.cpp
+ @author Anthony Campos
+ @date 10/19/2026
+ This implementation file implements the conversions between the legacy text code made by
+ HuffmanAlgorithm::getWord, one '0'/'1' char per bit, and packed bits */
+
+//---------------------------------------------------------------------------
+// BitPacking functions:  '0'/'1' text <-> packed bits
+//   included features:
+//   -- packAsciiBits, 32 chars per AVX2 instruction or 16 per SSE2 instruction,
+//			scalar for the tail and on other targets
+//   -- unpackAsciiBits, the reverse, 32 or 16 chars per instruction
+//   -- PackedCode helpers for whole strings
+//
+// Assumptions:
+//   --  like HuffmanTree::decode, any char other than '0' is a 1 bit
+//   --  packed bits are most significant bit first, as written by BitWriter
+//   --  the instruction set is picked at compile time (__AVX2__, __SSE2__,
+//			or x64 / SSE2 MSVC targets)
+//---------------------------------------------------------------------------
+
+
+// included .h files
+#include "BitPacking.h"
+
+// Included libraries
+#include <cstring>
+
+#if defined(__AVX2__)
+#define HUFFMAN_BITPACK_AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HUFFMAN_BITPACK_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+	/** packByte packs 8 chars, the first one becomes the most significant bit */
+	inline unsigned char packByte(const char* text, std::size_t length) {
+
+		unsigned int byte = 0;
+
+		for (std::size_t i = 0; i < 8; ++i) {
+
+			byte <<= 1;
+			if (i < length && text[i] != '0') {
+				byte |= 1;
+			} // end if
+
+		} // end for
+
+		return static_cast<unsigned char>(byte);
+
+	} // End of packByte
+
+	/** unpackByte writes the first length bits of byte, most significant first */
+	inline void unpackByte(unsigned char byte, int length, char* out) {
+
+		for (int i = 0; i < length; ++i) {
+
+			out[i] = ((byte >> (7 - i)) & 1) ? '1' : '0';
+
+		} // end for
+
+	} // End of unpackByte
+
+#if defined(HUFFMAN_BITPACK_SSE2)
+
+	/** reverseBits of a byte, movemask puts the first char in the least significant bit */
+	inline unsigned char reverseBits(unsigned int byte) {
+
+		byte = ((byte & 0xF0) >> 4) | ((byte & 0x0F) << 4);
+		byte = ((byte & 0xCC) >> 2) | ((byte & 0x33) << 2);
+		byte = ((byte & 0xAA) >> 1) | ((byte & 0x55) << 1);
+
+		return static_cast<unsigned char>(byte);
+
+	} // End of reverseBits
+
+#endif
+
+} // end of namespace
+
+
+/** packAsciiBits
+@pre out holds at least (length + 7) / 8 bytes
+@post out holds one bit per char of text, the unused bits of the last byte are 0
+@parm char* [text], std::size_t [length] chars of text, unsigned char* [out]*/
+void packAsciiBits(const char* text, std::size_t length, unsigned char* out) {
+
+	std::size_t i = 0;
+
+#if defined(HUFFMAN_BITPACK_AVX2)
+
+	const __m256i zeros = _mm256_set1_epi8('0');
+	// reverse the chars of each group of 8 so the first char lands in bit 7 of its byte
+	const __m256i reverse = _mm256_setr_epi8(
+		7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+		7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+
+	for (; i + 32 <= length; i += 32) {
+
+		__m256i chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i));
+		chars = _mm256_shuffle_epi8(chars, reverse);
+		std::uint32_t zeroMask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chars, zeros)));
+		std::uint32_t bits = ~zeroMask;
+
+		// byte k of the mask is output byte k on little endian x86
+		std::memcpy(out + i / 8, &bits, 4);
+
+	} // end for
+
+#elif defined(HUFFMAN_BITPACK_SSE2)
+
+	const __m128i zeros = _mm_set1_epi8('0');
+
+	for (; i + 16 <= length; i += 16) {
+
+		__m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i));
+		unsigned int bits = ~static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(chars, zeros)));
+
+		out[i / 8] = reverseBits(bits & 0xFF);
+		out[i / 8 + 1] = reverseBits((bits >> 8) & 0xFF);
+
+	} // end for
+
+#endif
+
+	// scalar tail, and the whole text on other targets
+	for (; i < length; i += 8) {
+
+		out[i / 8] = packByte(text + i, length - i);
+
+	} // end for
+
+} // End of packAsciiBits
+
+/** unpackAsciiBits
+@pre bytes holds at least (bitCount + 7) / 8 bytes, out holds at least bitCount chars
+@post out holds one '0'/'1' char per bit of bytes
+@parm unsigned char* [bytes], std::uint64_t [bitCount], char* [out]*/
+void unpackAsciiBits(const unsigned char* bytes, std::uint64_t bitCount, char* out) {
+
+	std::uint64_t i = 0;
+
+#if defined(HUFFMAN_BITPACK_AVX2)
+
+	// lanes 0-7 of each 16 take the first byte of their half, lanes 8-15 the second
+	const __m256i spread = _mm256_setr_epi8(
+		0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+		2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3);
+	const __m256i bitMasks = _mm256_set1_epi64x(static_cast<long long>(0x0102040810204080ULL));
+	const __m256i zeros = _mm256_set1_epi8('0');
+
+	for (; i + 32 <= bitCount; i += 32) {
+
+		std::uint32_t word = 0;
+		std::memcpy(&word, bytes + i / 8, 4);
+
+		__m256i spreadBytes = _mm256_shuffle_epi8(_mm256_set1_epi32(static_cast<int>(word)), spread);
+		__m256i isSet = _mm256_cmpeq_epi8(_mm256_and_si256(spreadBytes, bitMasks), bitMasks);
+
+		// isSet is -1 for a 1 bit, so '0' - isSet is '1'
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_sub_epi8(zeros, isSet));
+
+	} // end for
+
+#elif defined(HUFFMAN_BITPACK_SSE2)
+
+	const __m128i bitMasks = _mm_set1_epi64x(static_cast<long long>(0x0102040810204080ULL));
+	const __m128i zeros = _mm_set1_epi8('0');
+
+	for (; i + 16 <= bitCount; i += 16) {
+
+		int pair = bytes[i / 8] | (bytes[i / 8 + 1] << 8);
+
+		// b0 b1 -> b0 x8, b1 x8
+		__m128i spreadBytes = _mm_cvtsi32_si128(pair);
+		spreadBytes = _mm_unpacklo_epi8(spreadBytes, spreadBytes);
+		spreadBytes = _mm_unpacklo_epi16(spreadBytes, spreadBytes);
+		spreadBytes = _mm_unpacklo_epi32(spreadBytes, spreadBytes);
+
+		__m128i isSet = _mm_cmpeq_epi8(_mm_and_si128(spreadBytes, bitMasks), bitMasks);
+
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_sub_epi8(zeros, isSet));
+
+	} // end for
+
+#endif
+
+	// scalar tail, and the whole code on other targets
+	for (; i < bitCount; i += 8) {
+
+		int length = (bitCount - i < 8) ? static_cast<int>(bitCount - i) : 8;
+		unpackByte(bytes[i / 8], length, out + i);
+
+	} // end for
+
+} // End of unpackAsciiBits
+
+/** packAscii
+@pre None
+@post None
+@parm std::string [text] '0'/'1' code
+@return packed bits of text*/
+PackedCode packAscii(const std::string& text) {
+
+	PackedCode code;
+	code.bitCount_ = text.size();
+	code.bytes_.resize((text.size() + 7) / 8);
+
+	packAsciiBits(text.data(), text.size(), code.bytes_.data());
+
+	return code;
+
+} // End of packAscii
+
+/** unpackAscii
+@pre None
+@post None
+@parm PackedCode [code]
+@return '0'/'1' text of code*/
+std::string unpackAscii(const PackedCode& code) {
+
+	std::string text(static_cast<std::size_t>(code.bitCount_), '0');
+
+	unpackAsciiBits(code.bytes_.data(), code.bitCount_, &text[0]);
+
+	return text;
+
+} // End of unpackAscii
+
+/** bitPackingInstructionSet
+@return name of the instruction set the conversions were compiled for*/
+const char* bitPackingInstructionSet() {
+
+#if defined(HUFFMAN_BITPACK_AVX2)
+	return "AVX2";
+#elif defined(HUFFMAN_BITPACK_SSE2)
+	return "SSE2";
+#else
+	return "scalar";
+#endif
+
+} // End of bitPackingInstructionSet
@@ -0,0 +1,61 @@
+/** @file BitPacking.h
+ @author Anthony Campos
+ @date 10/19/2026
+ This header file declares the conversions between the legacy text code made by
+ HuffmanAlgorithm::getWord, one '0'/'1' char per bit, and packed bits */
+
+	//---------------------------------------------------------------------------
+	// BitPacking functions:  '0'/'1' text <-> packed bits
+	//   included features:
+	//   -- packAsciiBits, 32 chars per AVX2 instruction or 16 per SSE2 instruction,
+	//			scalar for the tail and on other targets
+	//   -- unpackAsciiBits, the reverse, 32 or 16 chars per instruction
+	//   -- PackedCode helpers for whole strings
+	//
+	// Assumptions:
+	//   --  like HuffmanTree::decode, any char other than '0' is a 1 bit
+	//   --  packed bits are most significant bit first, as written by BitWriter
+	//   --  the instruction set is picked at compile time (__AVX2__, __SSE2__,
+	//			or x64 / SSE2 MSVC targets)
+	//---------------------------------------------------------------------------
+
+#pragma once
+
+// Included libraries
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// included .h files
+#include "BitStream.h"
+
+
+/** packAsciiBits
+@pre out holds at least (length + 7) / 8 bytes
+@post out holds one bit per char of text, the unused bits of the last byte are 0
+@parm char* [text], std::size_t [length] chars of text, unsigned char* [out]*/
+void packAsciiBits(const char* text, std::size_t length, unsigned char* out);
+
+/** unpackAsciiBits
+@pre bytes holds at least (bitCount + 7) / 8 bytes, out holds at least bitCount chars
+@post out holds one '0'/'1' char per bit of bytes
+@parm unsigned char* [bytes], std::uint64_t [bitCount], char* [out]*/
+void unpackAsciiBits(const unsigned char* bytes, std::uint64_t bitCount, char* out);
+
+/** packAscii
+@pre None
+@post None
+@parm std::string [text] '0'/'1' code
+@return packed bits of text*/
+PackedCode packAscii(const std::string& text);
+
+/** unpackAscii
+@pre None
+@post None
+@parm PackedCode [code]
+@return '0'/'1' text of code*/
+std::string unpackAscii(const PackedCode& code);
+
+/** bitPackingInstructionSet
+@return name of the instruction set the conversions were compiled for*/
+const char* bitPackingInstructionSet();
@@ -0,0 +1,221 @@
+/** @file BitStream.cpp
+ @author Anthony Campos
+ @date 10/19/2026
+ This implementation file implements a BitWriter and BitReader that pack Huffman codes
+ into bytes, most significant bit first, instead of one '0'/'1' char per bit */
+
+//---------------------------------------------------------------------------
+// BitWriter class:  appends codes to a byte buffer
+// BitReader class:  reads bits back out of a byte buffer
+//
+// Assumptions:
+//   --  bit 0 of a buffer is the most significant bit of byte 0
+//---------------------------------------------------------------------------
+
+
+// included .h files
+#include "BitStream.h"
+
+// Included libraries
+#include <utility>
+
+
+/** BitWriter */
+
+/** Defualt Constructor
+@pre None
+@post Empty BitWriter Object created*/
+BitWriter::BitWriter()
+	:accumulator_(0), accumulatorBits_(0), bitCount_(0)
+{} // End of Constructor
+
+/** writeBits appends the low length bits of bits, most significant first
+@pre 0 <= length <= 64
+@post bits appended, complete bytes moved to the byte buffer
+@parm std::uint64_t [bits], int [length]*/
+void BitWriter::writeBits(std::uint64_t bits, int length) {
+
+	bitCount_ += length;
+
+	// at most 32 bits at a time so the accumulator (< 8 pending bits) cannot overflow
+	while (length > 0) {
+
+		int chunk = (length > 32) ? 32 : length;
+		length -= chunk;
+
+		std::uint64_t chunkBits = (bits >> length) & ((std::uint64_t(1) << chunk) - 1);
+		accumulator_ = (accumulator_ << chunk) | chunkBits;
+		accumulatorBits_ += chunk;
+
+		while (accumulatorBits_ >= 8) {
+
+			accumulatorBits_ -= 8;
+			bytes_.push_back(static_cast<unsigned char>(accumulator_ >> accumulatorBits_));
+
+		} // end while
+
+		accumulator_ &= (std::uint64_t(1) << accumulatorBits_) - 1;
+
+	} // end while
+
+} // End of writeBits
+
+/** finish pads the partial byte with 0 bits and moves it to the byte buffer
+@pre None
+@post every written bit is in the byte buffer*/
+void BitWriter::finish() {
+
+	if (accumulatorBits_ > 0) {
+
+		bytes_.push_back(static_cast<unsigned char>(accumulator_ << (8 - accumulatorBits_)));
+		accumulator_ = 0;
+		accumulatorBits_ = 0;
+
+	} // end if
+
+} // End of finish
+
+/** swapBytes hands the complete bytes to the caller
+@pre None
+@post out holds the complete bytes, the byte buffer takes over the (cleared) memory
+of out. The partial byte stays in the BitWriter
+@parm std::vector<unsigned char> [out] passed by reference*/
+void BitWriter::swapBytes(std::vector<unsigned char>& out) {
+
+	out.clear();
+	std::swap(bytes_, out);
+
+} // End of swapBytes
+
+/** bytes
+@pre None
+@post None
+@return complete bytes written so far, the partial byte excluded until finish*/
+const std::vector<unsigned char>& BitWriter::bytes() const {
+
+	return bytes_;
+
+} // End of bytes
+
+/** bitCount
+@pre None
+@post None
+@return number of bits written since construction, padding excluded*/
+std::uint64_t BitWriter::bitCount() const {
+
+	return bitCount_;
+
+} // End of bitCount
+
+
+/** BitReader */
+
+/** Constructor
+@pre data holds at least (bitCount + 7) / 8 bytes
+@post BitReader Object created, positioned at startBit
+@parm unsigned char* [data], std::uint64_t [bitCount] bits in data, std::uint64_t [startBit]*/
+BitReader::BitReader(const unsigned char* data, std::uint64_t bitCount, std::uint64_t startBit)
+	:data_(data), bitCount_(bitCount), position_(startBit)
+{} // End of Constructor
+
+/** readBit
+@pre position() < bitCount
+@post position moved forward one bit
+@return next bit*/
+int BitReader::readBit() {
+
+	int bit = 0;
+
+	if (position_ < bitCount_) {
+
+		bit = (data_[position_ >> 3] >> (7 - (position_ & 7))) & 1;
+
+	} // end if
+
+	++position_;
+
+	return bit;
+
+} // End of readBit
+
+/** readBits
+@pre 0 <= length <= 64
+@post position moved forward length bits
+@return next length bits, right aligned. Bits past the end read as 0*/
+std::uint64_t BitReader::readBits(int length) {
+
+	std::uint64_t bits = peekBits(length);
+	position_ += length;
+
+	return bits;
+
+} // End of readBits
+
+/** peekBits
+@pre 0 <= length <= 64
+@post None
+@return next length bits, right aligned, position unchanged. Bits past the end read as 0*/
+std::uint64_t BitReader::peekBits(int length) const {
+
+	std::uint64_t bits = 0;
+	std::uint64_t position = position_;
+
+	// whole bytes at a time while aligned, single bits at the edges
+	while (length > 0) {
+
+		int offset = static_cast<int>(position & 7);
+		int take = 8 - offset;
+		if (take > length) {
+			take = length;
+		} // end if
+
+		unsigned int byte = 0;
+		if (position < bitCount_) {
+			byte = data_[position >> 3];
+		} // end if
+
+		unsigned int chunk = (byte >> (8 - offset - take)) & ((1u << take) - 1);
+
+		// bits of the last byte past bitCount read as 0
+		if (position + take > bitCount_) {
+
+			int valid = (position < bitCount_) ? static_cast<int>(bitCount_ - position) : 0;
+			chunk &= ~((1u << (take - valid)) - 1);
+
+		} // end if
+
+		bits = (bits << take) | chunk;
+		position += take;
+		length -= take;
+
+	} // end while
+
+	return bits;
+
+} // End of peekBits
+
+/** skipBits
+@pre None
+@post position moved forward length bits
+@parm std::uint64_t [length]*/
+void BitReader::skipBits(std::uint64_t length) {
+
+	position_ += length;
+
+} // End of skipBits
+
+/** position
+@return index of the next bit to read*/
+std::uint64_t BitReader::position() const {
+
+	return position_;
+
+} // End of position
+
+/** remaining
+@return number of bits left to read, 0 once past the end*/
+std::uint64_t BitReader::remaining() const {
+
+	return (position_ < bitCount_) ? bitCount_ - position_ : 0;
+
+} // End of remaining
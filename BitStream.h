@@ -0,0 +1,153 @@
+/** @file BitStream.h
+ @author Anthony Campos
+ @date 10/19/2026
+ This header class file implements a BitWriter and BitReader that pack Huffman codes
+ into bytes, most significant bit first, instead of one '0'/'1' char per bit */
+
+	//---------------------------------------------------------------------------
+	// BitWriter class:  appends codes to a byte buffer
+	//   included features:
+	//   -- allows for writing 1 to 64 bits at a time
+	//   -- keeps the partial last byte between writes, so complete bytes can be
+	//			handed off (swapBytes) while encoding continues
+	//   -- finish pads the partial byte with 0 bits
+	//
+	// PackedCode struct:  packed bytes with the number of code bits in them
+	//
+	// BitReader class:  reads bits back out of a byte buffer
+	//   included features:
+	//   -- allows for reading, peeking and skipping 1 to 64 bits at a time
+	//   -- peeking past the end reads 0 bits
+	//
+	// Assumptions:
+	//   --  bit 0 of a buffer is the most significant bit of byte 0
+	//---------------------------------------------------------------------------
+
+#pragma once
+
+// Included libraries
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+
+struct PackedCode {
+
+	std::vector<unsigned char> bytes_; // code bits, last byte padded with 0 bits
+	std::uint64_t bitCount_ = 0; // number of code bits, padding excluded
+
+}; // end of PackedCode
+
+
+class BitWriter {
+
+public:
+
+	/** Constructors */
+
+	/** Defualt Constructor
+	@pre None
+	@post Empty BitWriter Object created*/
+	BitWriter();
+
+	/** Public Methods */
+
+	/** writeBits appends the low length bits of bits, most significant first
+	@pre 0 <= length <= 64
+	@post bits appended, complete bytes moved to the byte buffer
+	@parm std::uint64_t [bits], int [length]*/
+	void writeBits(std::uint64_t bits, int length);
+
+	/** finish pads the partial byte with 0 bits and moves it to the byte buffer
+	@pre None
+	@post every written bit is in the byte buffer*/
+	void finish();
+
+	/** swapBytes hands the complete bytes to the caller
+	@pre None
+	@post out holds the complete bytes, the byte buffer takes over the (cleared) memory
+	of out. The partial byte stays in the BitWriter
+	@parm std::vector<unsigned char> [out] passed by reference*/
+	void swapBytes(std::vector<unsigned char>& out);
+
+	/** Accessor Methods */
+
+	/** bytes
+	@pre None
+	@post None
+	@return complete bytes written so far, the partial byte excluded until finish*/
+	const std::vector<unsigned char>& bytes() const;
+
+	/** bitCount
+	@pre None
+	@post None
+	@return number of bits written since construction, padding excluded*/
+	std::uint64_t bitCount() const;
+
+private:
+
+	/** Private Attributes */
+	std::vector<unsigned char> bytes_; // complete bytes
+	std::uint64_t accumulator_; // pending bits, right aligned
+	int accumulatorBits_; // number of pending bits, always < 8 between calls
+	std::uint64_t bitCount_; // total bits written
+
+}; // end of BitWriter
+
+
+class BitReader {
+
+public:
+
+	/** Constructors */
+
+	/** Constructor
+	@pre data holds at least (bitCount + 7) / 8 bytes
+	@post BitReader Object created, positioned at startBit
+	@parm unsigned char* [data], std::uint64_t [bitCount] bits in data, std::uint64_t [startBit]*/
+	BitReader(const unsigned char* data, std::uint64_t bitCount, std::uint64_t startBit = 0);
+
+	/** Public Methods */
+
+	/** readBit
+	@pre position() < bitCount
+	@post position moved forward one bit
+	@return next bit*/
+	int readBit();
+
+	/** readBits
+	@pre 0 <= length <= 64
+	@post position moved forward length bits
+	@return next length bits, right aligned. Bits past the end read as 0*/
+	std::uint64_t readBits(int length);
+
+	/** peekBits
+	@pre 0 <= length <= 64
+	@post None
+	@return next length bits, right aligned, position unchanged. Bits past the end read as 0*/
+	std::uint64_t peekBits(int length) const;
+
+	/** skipBits
+	@pre None
+	@post position moved forward length bits
+	@parm std::uint64_t [length]*/
+	void skipBits(std::uint64_t length);
+
+	/** Accessor Methods */
+
+	/** position
+	@return index of the next bit to read*/
+	std::uint64_t position() const;
+
+	/** remaining
+	@return number of bits left to read, 0 once past the end*/
+	std::uint64_t remaining() const;
+
+private:
+
+	/** Private Attributes */
+	const unsigned char* data_;
+	std::uint64_t bitCount_;
+	std::uint64_t position_;
+
+}; // end of BitReader
@@ -0,0 +1,686 @@
+/** @file BlockTransformCodec.cpp
+ @author Anthony Campos
+ @date 10/19/2026
+ This implementation file implements a BlockTransformCodec, which runs a Burrows-Wheeler
+ transform, move-to-front and zero run length coding ahead of Huffman coding */
+
+//---------------------------------------------------------------------------
+// BlockTransformCodec class:  BWT + MTF + zero runs + Huffman
+//   included features:
+//   -- splits the text into blocks of at most blockSize bytes, memory use is
+//			bounded by the block size, not the text size
+//   -- sorts the suffixes of a block by induced sorting (SA-IS), O(n) time
+//			whatever the repeats, about 9 bytes per byte
+//   -- move-to-front turns the runs of the transform into runs of 0
+//   -- each run of 0 becomes its length in bijective base 2 (RUNA / RUNB),
+//			other move-to-front values v become v + 1
+//   -- codes the symbols of each block with its own SparseHuffmanCodec
+//   -- each stage and its inverse is public, so stages can be checked alone
+//
+// Assumptions:
+//   --  every byte value is coded, text is treated as raw bytes
+//---------------------------------------------------------------------------
+
+
+// included .h files
+#include "BlockTransformCodec.h"
+#include "ByteOrder.h"
+
+// Included libraries
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+	const char TRANSFORM_MAGIC[4] = { 'H', 'U', 'F', 'B' };
+
+	// largest symbol made by encodeZeroRuns, move-to-front value 255 + 1
+	const std::uint32_t MAX_RUN_SYMBOL = 256;
+
+	/** takeUint reads byteCount little endian bytes at at, if there are enough
+	@post at moved past them
+	@return false if data ends first*/
+	bool takeUint(const std::vector<unsigned char>& data, std::size_t& at, int byteCount, std::uint64_t& value) {
+
+		bool complete = data.size() - at >= static_cast<std::size_t>(byteCount);
+
+		if (complete) {
+
+			value = loadUint(data.data() + at, byteCount);
+			at += byteCount;
+
+		} // end if
+
+		return complete;
+
+	} // End of takeUint
+
+	/** bucketBounds sets bucket[c] to the first (or one past the last) slot of c */
+	void bucketBounds(const int* text, int n, int alphabetSize, std::vector<int>& bucket, bool ends) {
+
+		std::fill(bucket.begin(), bucket.end(), 0);
+		for (int i = 0; i < n; ++i) {
+
+			++bucket[text[i]];
+
+		} // end for
+
+		int total = 0;
+		for (int c = 0; c < alphabetSize; ++c) {
+
+			total += bucket[c];
+			bucket[c] = ends ? total : total - bucket[c];
+
+		} // end for
+
+	} // End of bucketBounds
+
+	/** induceSort places the L type suffixes left to right, then the S type suffixes right to
+	left, from the LMS suffixes already in suffixes */
+	void induceSort(const int* text, int* suffixes, int n, int alphabetSize,
+		const std::vector<bool>& sType, std::vector<int>& bucket) {
+
+		bucketBounds(text, n, alphabetSize, bucket, false);
+		for (int i = 0; i < n; ++i) {
+
+			int j = suffixes[i] - 1;
+			if (suffixes[i] > 0 && !sType[j]) {
+				suffixes[bucket[text[j]]++] = j;
+			} // end if
+
+		} // end for
+
+		bucketBounds(text, n, alphabetSize, bucket, true);
+		for (int i = n - 1; i >= 0; --i) {
+
+			int j = suffixes[i] - 1;
+			if (suffixes[i] > 0 && sType[j]) {
+				suffixes[--bucket[text[j]]] = j;
+			} // end if
+
+		} // end for
+
+	} // End of induceSort
+
+	/** suffixArray by induced sorting (SA-IS), O(n) time
+	@pre text[n - 1] is 0 and the only 0, every text[i] < alphabetSize
+	@post suffixes holds the start of every suffix of text in sorted order*/
+	void suffixArray(const int* text, int* suffixes, int n, int alphabetSize) {
+
+		// S type: smaller than the suffix after it. LMS: S type right after an L type
+		std::vector<bool> sType(n, false);
+		sType[n - 1] = true;
+		for (int i = n - 2; i >= 0; --i) {
+
+			sType[i] = text[i] < text[i + 1] || (text[i] == text[i + 1] && sType[i + 1]);
+
+		} // end for
+
+		std::vector<int> bucket(alphabetSize);
+		auto isLms = [&sType](int i) { return i > 0 && sType[i] && !sType[i - 1]; };
+
+		// sort the LMS substrings: drop the LMS suffixes at their bucket ends and induce
+		std::fill(suffixes, suffixes + n, -1);
+		bucketBounds(text, n, alphabetSize, bucket, true);
+		for (int i = 1; i < n; ++i) {
+
+			if (isLms(i)) {
+				suffixes[--bucket[text[i]]] = i;
+			} // end if
+
+		} // end for
+
+		induceSort(text, suffixes, n, alphabetSize, sType, bucket);
+
+		// gather the sorted LMS substrings and name them, equal substrings share a name
+		int lmsCount = 0;
+		for (int i = 0; i < n; ++i) {
+
+			if (isLms(suffixes[i])) {
+				suffixes[lmsCount++] = suffixes[i];
+			} // end if
+
+		} // end for
+
+		std::fill(suffixes + lmsCount, suffixes + n, -1);
+
+		int names = 0;
+		int previous = -1;
+		for (int i = 0; i < lmsCount; ++i) {
+
+			int position = suffixes[i];
+			bool different = false;
+
+			for (int d = 0; d < n; ++d) {
+
+				if (previous == -1 || text[position + d] != text[previous + d]
+					|| sType[position + d] != sType[previous + d]) {
+
+					different = true;
+					break;
+
+				}
+				else if (d > 0 && (isLms(position + d) || isLms(previous + d))) {
+
+					break;
+
+				} // end if
+
+			} // end for
+
+			if (different) {
+				++names;
+				previous = position;
+			} // end if
+
+			// LMS positions are at least 2 apart, so position / 2 is a free, unique slot
+			suffixes[lmsCount + position / 2] = names - 1;
+
+		} // end for
+
+		for (int i = n - 1, j = n - 1; i >= lmsCount; --i) {
+
+			if (suffixes[i] >= 0) {
+				suffixes[j--] = suffixes[i];
+			} // end if
+
+		} // end for
+
+		// sort the LMS suffixes: recurse on the names unless they are already unique
+		int* reduced = suffixes + n - lmsCount;
+		if (names < lmsCount) {
+
+			suffixArray(reduced, suffixes, lmsCount, names);
+
+		}
+		else {
+
+			for (int i = 0; i < lmsCount; ++i) {
+				suffixes[reduced[i]] = i;
+			} // end for
+
+		} // end if
+
+		for (int i = 1, j = 0; i < n; ++i) {
+
+			if (isLms(i)) {
+				reduced[j++] = i;
+			} // end if
+
+		} // end for
+
+		for (int i = 0; i < lmsCount; ++i) {
+
+			suffixes[i] = reduced[suffixes[i]];
+
+		} // end for
+
+		// induce every suffix from the sorted LMS suffixes
+		std::fill(suffixes + lmsCount, suffixes + n, -1);
+		bucketBounds(text, n, alphabetSize, bucket, true);
+		for (int i = lmsCount - 1; i >= 0; --i) {
+
+			int j = suffixes[i];
+			suffixes[i] = -1;
+			suffixes[--bucket[text[j]]] = j;
+
+		} // end for
+
+		induceSort(text, suffixes, n, alphabetSize, sType, bucket);
+
+	} // End of suffixArray
+
+} // end of namespace
+
+
+/** Constructor
+@pre blockSize > 0
+@post BlockTransformCodec Object created
+@parm int [blockSize] largest block in bytes*/
+BlockTransformCodec::BlockTransformCodec(int blockSize)
+	:blockSize_(blockSize > 0 ? blockSize : DEFAULT_TRANSFORM_BLOCK_SIZE)
+{} // End of Constructor
+
+/** compress
+@pre None
+@post None
+@parm std::string [text]
+@return compressed text*/
+std::vector<unsigned char> BlockTransformCodec::compress(const std::string& text) const {
+
+	std::vector<unsigned char> out(TRANSFORM_MAGIC, TRANSFORM_MAGIC + sizeof(TRANSFORM_MAGIC));
+	const unsigned char* bytes = reinterpret_cast<const unsigned char*>(text.data());
+
+	for (std::size_t start = 0; start < text.size(); start += blockSize_) {
+
+		std::size_t length = text.size() - start;
+		if (length > static_cast<std::size_t>(blockSize_)) {
+			length = blockSize_;
+		} // end if
+
+		compressBlock(bytes + start, length, out);
+
+	} // end for
+
+	return out;
+
+} // End of compress
+
+/** decompress
+@pre None
+@post text holds every block decoded before the first malformed one
+@parm std::vector<unsigned char> [data], std::string [text] passed by reference
+@return true if all of data was well formed*/
+bool BlockTransformCodec::decompress(const std::vector<unsigned char>& data, std::string& text) const {
+
+	text.clear();
+
+	bool valid = data.size() >= sizeof(TRANSFORM_MAGIC)
+		&& std::memcmp(data.data(), TRANSFORM_MAGIC, sizeof(TRANSFORM_MAGIC)) == 0;
+	std::size_t at = sizeof(TRANSFORM_MAGIC);
+
+	while (valid && at < data.size()) {
+
+		valid = decompressBlock(data, at, text);
+
+	} // end while
+
+	return valid;
+
+} // End of decompress
+
+/** compressBlock
+@pre None
+@post block appended to out
+@parm unsigned char* [block], std::size_t [length], std::vector<unsigned char> [out] passed by reference*/
+void BlockTransformCodec::compressBlock(const unsigned char* block, std::size_t length, std::vector<unsigned char>& out) {
+
+	std::vector<unsigned char> transformed;
+	std::uint32_t primaryIndex = 0;
+
+	burrowsWheeler(block, length, transformed, primaryIndex);
+	moveToFront(transformed);
+	std::vector<std::uint32_t> symbols = encodeZeroRuns(transformed);
+
+	// the codebook travels as counts, decode rebuilds the same codes from them
+	std::vector<long long> counts(MAX_RUN_SYMBOL + 1, 0);
+	for (std::size_t i = 0; i < symbols.size(); ++i) {
+
+		++counts[symbols[i]];
+
+	} // end for
+
+	std::vector<std::uint32_t> usedSymbols;
+	std::vector<long long> usedCounts;
+	for (std::uint32_t symbol = 0; symbol <= MAX_RUN_SYMBOL; ++symbol) {
+
+		if (counts[symbol] > 0) {
+
+			usedSymbols.push_back(symbol);
+			usedCounts.push_back(counts[symbol]);
+
+		} // end if
+
+	} // end for
+
+	SparseHuffmanCodec codec(usedSymbols, usedCounts);
+	std::uint64_t bitCount = 0;
+	std::vector<unsigned char> code = codec.encode(symbols, bitCount);
+
+	appendUint(out, length, 4);
+	appendUint(out, primaryIndex, 4);
+	appendUint(out, usedSymbols.size(), 2);
+	for (std::size_t i = 0; i < usedSymbols.size(); ++i) {
+
+		appendUint(out, usedSymbols[i], 2);
+		appendUint(out, static_cast<std::uint64_t>(usedCounts[i]), 4);
+
+	} // end for
+
+	appendUint(out, bitCount, 8);
+	out.insert(out.end(), code.begin(), code.end());
+
+} // End of compressBlock
+
+/** decompressBlock
+@pre None
+@post at moved past the block, block appended to text if it is well formed
+@parm std::vector<unsigned char> [data], std::size_t [at] passed by reference,
+std::string [text] passed by reference
+@return true if the block was well formed*/
+bool BlockTransformCodec::decompressBlock(const std::vector<unsigned char>& data, std::size_t& at, std::string& text) {
+
+	std::uint64_t length = 0;
+	std::uint64_t primaryIndex = 0;
+	std::uint64_t symbolCount = 0;
+
+	bool valid = takeUint(data, at, 4, length) && takeUint(data, at, 4, primaryIndex)
+		&& takeUint(data, at, 2, symbolCount) && symbolCount <= MAX_RUN_SYMBOL + 1;
+
+	std::vector<std::uint32_t> usedSymbols;
+	std::vector<long long> usedCounts;
+
+	for (std::uint64_t i = 0; valid && i < symbolCount; ++i) {
+
+		std::uint64_t symbol = 0;
+		std::uint64_t count = 0;
+		valid = takeUint(data, at, 2, symbol) && takeUint(data, at, 4, count);
+
+		usedSymbols.push_back(static_cast<std::uint32_t>(symbol));
+		usedCounts.push_back(static_cast<long long>(count));
+
+	} // end for
+
+	std::uint64_t bitCount = 0;
+	// code bytes as (bitCount >> 3) plus a partial byte, (bitCount + 7) / 8 wraps near 2^64
+	valid = valid && takeUint(data, at, 8, bitCount)
+		&& (bitCount >> 3) + ((bitCount & 7) != 0 ? 1 : 0) <= data.size() - at;
+
+	if (valid) {
+
+		std::size_t codeBytes = static_cast<std::size_t>((bitCount + 7) / 8);
+		std::vector<unsigned char> code(data.begin() + at, data.begin() + at + codeBytes);
+		at += codeBytes;
+
+		SparseHuffmanCodec codec(usedSymbols, usedCounts);
+		std::vector<unsigned char> positions;
+
+		valid = decodeZeroRuns(codec.decode(code, bitCount), length, positions)
+			&& positions.size() == length && (length == 0 || (primaryIndex >= 1 && primaryIndex <= length));
+
+		if (valid) {
+
+			inverseMoveToFront(positions);
+			std::vector<unsigned char> block = inverseBurrowsWheeler(positions, static_cast<std::uint32_t>(primaryIndex));
+			text.append(block.begin(), block.end());
+
+		} // end if
+
+	} // end if
+
+	return valid;
+
+} // End of decompressBlock
+
+/** burrowsWheeler
+@pre length < 2^31
+@post primaryIndex holds the row of the sentinel, which is left out of out
+@parm unsigned char* [block], std::size_t [length], std::vector<unsigned char> [out]
+passed by reference, std::uint32_t [primaryIndex] passed by reference*/
+void BlockTransformCodec::burrowsWheeler(const unsigned char* block, std::size_t length,
+	std::vector<unsigned char>& out, std::uint32_t& primaryIndex) {
+
+	const int n = static_cast<int>(length);
+	out.clear();
+	out.reserve(length);
+	primaryIndex = 0;
+
+	if (n > 0) {
+
+		// bytes shifted up by one so 0 is free for the sentinel
+		std::vector<int> text(n + 1);
+		for (int i = 0; i < n; ++i) {
+
+			text[i] = block[i] + 1;
+
+		} // end for
+
+		text[n] = 0;
+
+		std::vector<int> suffixes(n + 1);
+		suffixArray(text.data(), suffixes.data(), n + 1, 257);
+
+		// last column: the byte before each sorted suffix, the sentinel before suffix 0
+		for (int row = 0; row <= n; ++row) {
+
+			if (suffixes[row] == 0) {
+
+				primaryIndex = static_cast<std::uint32_t>(row);
+
+			}
+			else {
+
+				out.push_back(block[suffixes[row] - 1]);
+
+			} // end if
+
+		} // end for
+
+	} // end if
+
+} // End of burrowsWheeler
+
+/** inverseBurrowsWheeler
+@pre 1 <= primaryIndex <= transformed.size(), or transformed is empty
+@post None
+@parm std::vector<unsigned char> [transformed], std::uint32_t [primaryIndex]
+@return the block*/
+std::vector<unsigned char> BlockTransformCodec::inverseBurrowsWheeler(const std::vector<unsigned char>& transformed,
+	std::uint32_t primaryIndex) {
+
+	const std::size_t n = transformed.size();
+	std::vector<unsigned char> block(n);
+
+	if (n > 0) {
+
+		// first row of each byte in the sorted first column, row 0 is the sentinel
+		std::size_t firstRow[256] = {};
+		for (std::size_t i = 0; i < n; ++i) {
+
+			++firstRow[transformed[i]];
+
+		} // end for
+
+		std::size_t total = 1;
+		for (int b = 0; b < 256; ++b) {
+
+			std::size_t count = firstRow[b];
+			firstRow[b] = total;
+			total += count;
+
+		} // end for
+
+		// last to first mapping over the n + 1 rows, the sentinel row never gets followed.
+		// Row r continues (backwards) at previous[r] >> 8 with its byte in the low 8 bits,
+		// so each step is one cache miss, not two
+		const bool packed = n < (static_cast<std::size_t>(1) << 24);
+		std::vector<std::uint32_t> previous(n + 1, 0);
+		for (std::size_t row = 0; row <= n; ++row) {
+
+			if (row != primaryIndex) {
+
+				unsigned char byte = transformed[row < primaryIndex ? row : row - 1];
+				std::uint32_t next = static_cast<std::uint32_t>(firstRow[byte]++);
+				previous[row] = packed ? ((next << 8) | byte) : next;
+
+			} // end if
+
+		} // end for
+
+		std::uint32_t row = 0;
+		for (std::size_t i = n; i > 0; --i) {
+
+			if (packed) {
+
+				std::uint32_t link = previous[row];
+				block[i - 1] = static_cast<unsigned char>(link);
+				row = link >> 8;
+
+			}
+			else {
+
+				block[i - 1] = transformed[row < primaryIndex ? row : row - 1];
+				row = previous[row];
+
+			} // end if
+
+		} // end for
+
+	} // end if
+
+	return block;
+
+} // End of inverseBurrowsWheeler
+
+/** moveToFront
+@pre None
+@post bytes replaced by their positions in a recently used list
+@parm std::vector<unsigned char> [bytes] passed by reference*/
+void BlockTransformCodec::moveToFront(std::vector<unsigned char>& bytes) {
+
+	unsigned char recent[256];
+	for (int i = 0; i < 256; ++i) {
+
+		recent[i] = static_cast<unsigned char>(i);
+
+	} // end for
+
+	for (std::size_t i = 0; i < bytes.size(); ++i) {
+
+		unsigned char byte = bytes[i];
+		int position = 0;
+		while (recent[position] != byte) {
+			++position;
+		} // end while
+
+		std::memmove(recent + 1, recent, position);
+		recent[0] = byte;
+		bytes[i] = static_cast<unsigned char>(position);
+
+	} // end for
+
+} // End of moveToFront
+
+/** inverseMoveToFront
+@pre None
+@post positions replaced by the bytes they stand for
+@parm std::vector<unsigned char> [positions] passed by reference*/
+void BlockTransformCodec::inverseMoveToFront(std::vector<unsigned char>& positions) {
+
+	unsigned char recent[256];
+	for (int i = 0; i < 256; ++i) {
+
+		recent[i] = static_cast<unsigned char>(i);
+
+	} // end for
+
+	for (std::size_t i = 0; i < positions.size(); ++i) {
+
+		int position = positions[i];
+		unsigned char byte = recent[position];
+
+		std::memmove(recent + 1, recent, position);
+		recent[0] = byte;
+		positions[i] = byte;
+
+	} // end for
+
+} // End of inverseMoveToFront
+
+/** encodeZeroRuns
+@pre None
+@post None
+@parm std::vector<unsigned char> [positions]
+@return symbols 0 - 256, runs of 0 as RUN_A / RUN_B digits, v as v + 1*/
+std::vector<std::uint32_t> BlockTransformCodec::encodeZeroRuns(const std::vector<unsigned char>& positions) {
+
+	std::vector<std::uint32_t> symbols;
+	symbols.reserve(positions.size());
+
+	std::size_t i = 0;
+	while (i < positions.size()) {
+
+		if (positions[i] == 0) {
+
+			std::size_t run = 0;
+			while (i < positions.size() && positions[i] == 0) {
+				++run;
+				++i;
+			} // end while
+
+			// bijective base 2, least significant digit first: RUN_A is 1, RUN_B is 2
+			while (run > 0) {
+
+				if (run & 1) {
+					symbols.push_back(RUN_A);
+					run = (run - 1) / 2;
+				}
+				else {
+					symbols.push_back(RUN_B);
+					run = (run - 2) / 2;
+				} // end if
+
+			} // end while
+
+		}
+		else {
+
+			symbols.push_back(positions[i] + 1u);
+			++i;
+
+		} // end if
+
+	} // end while
+
+	return symbols;
+
+} // End of encodeZeroRuns
+
+/** decodeZeroRuns
+@pre None
+@post positions holds the decoded positions
+@parm std::vector<std::uint32_t> [symbols], std::uint64_t [length] of the block,
+std::vector<unsigned char> [positions] passed by reference
+@return false if a symbol is above 256 or the positions would pass length, checked before
+a run is expanded so corrupt runs cannot allocate past the block*/
+bool BlockTransformCodec::decodeZeroRuns(const std::vector<std::uint32_t>& symbols, std::uint64_t length,
+	std::vector<unsigned char>& positions) {
+
+	positions.clear();
+	bool valid = true;
+
+	std::uint64_t run = 0;
+	std::uint64_t digit = 1;
+
+	for (std::size_t i = 0; valid && i < symbols.size(); ++i) {
+
+		std::uint32_t symbol = symbols[i];
+
+		if (symbol == RUN_A || symbol == RUN_B) {
+
+			run += (symbol == RUN_A) ? digit : 2 * digit;
+			digit <<= 1;
+
+			valid = positions.size() + run <= length;
+
+		}
+		else {
+
+			positions.insert(positions.end(), static_cast<std::size_t>(run), 0);
+			run = 0;
+			digit = 1;
+
+			valid = symbol <= MAX_RUN_SYMBOL && positions.size() < length;
+			if (valid) {
+				positions.push_back(static_cast<unsigned char>(symbol - 1));
+			} // end if
+
+		} // end if
+
+	} // end for
+
+	if (valid) {
+		positions.insert(positions.end(), static_cast<std::size_t>(run), 0);
+	} // end if
+
+	return valid;
+
+} // End of decodeZeroRuns
+
+/** blockSize
+@return largest block in bytes*/
+int BlockTransformCodec::blockSize() const {
+
+	return blockSize_;
+
+} // End of blockSize
@@ -0,0 +1,149 @@
+/** @file BlockTransformCodec.h
+ @author Anthony Campos
+ @date 10/19/2026
+ This header class file implements a BlockTransformCodec, which runs a Burrows-Wheeler
+ transform, move-to-front and zero run length coding ahead of Huffman coding */
+
+	//---------------------------------------------------------------------------
+	// BlockTransformCodec class:  BWT + MTF + zero runs + Huffman
+	//   included features:
+	//   -- splits the text into blocks of at most blockSize bytes, memory use is
+	//			bounded by the block size, not the text size
+	//   -- sorts the suffixes of a block by induced sorting (SA-IS), O(n) time
+	//			whatever the repeats, about 9 bytes per byte
+	//   -- move-to-front turns the runs of the transform into runs of 0
+	//   -- each run of 0 becomes its length in bijective base 2 (RUNA / RUNB),
+	//			other move-to-front values v become v + 1
+	//   -- codes the symbols of each block with its own SparseHuffmanCodec
+	//   -- each stage and its inverse is public, so stages can be checked alone
+	//
+	// Compressed layout (little endian):
+	//   --  "HUFB", then for each block: uint32 block length, uint32 primary
+	//			index, uint16 symbol count, symbol count x { uint16 symbol,
+	//			uint32 count }, uint64 bit count, packed code
+	//
+	// Assumptions:
+	//   --  every byte value is coded, text is treated as raw bytes
+	//---------------------------------------------------------------------------
+
+#pragma once
+
+// Included libraries
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// included .h files
+#include "SparseHuffmanCodec.h"
+
+// Default block size, each block costs about 16 bytes of working memory per byte
+const int DEFAULT_TRANSFORM_BLOCK_SIZE = 1 << 20;
+
+// Zero run digits, move-to-front value v is coded as v + 1
+const std::uint32_t RUN_A = 0;
+const std::uint32_t RUN_B = 1;
+
+
+class BlockTransformCodec {
+
+public:
+
+	/** Constructors */
+
+	/** Constructor
+	@pre blockSize > 0
+	@post BlockTransformCodec Object created
+	@parm int [blockSize] largest block in bytes*/
+	explicit BlockTransformCodec(int blockSize = DEFAULT_TRANSFORM_BLOCK_SIZE);
+
+	/** Public Methods */
+
+	/** compress
+	@pre None
+	@post None
+	@parm std::string [text]
+	@return compressed text*/
+	std::vector<unsigned char> compress(const std::string& text) const;
+
+	/** decompress
+	@pre None
+	@post text holds every block decoded before the first malformed one
+	@parm std::vector<unsigned char> [data], std::string [text] passed by reference
+	@return true if all of data was well formed*/
+	bool decompress(const std::vector<unsigned char>& data, std::string& text) const;
+
+	/** burrowsWheeler
+	@pre length < 2^31
+	@post primaryIndex holds the row of the sentinel, which is left out of out
+	@parm unsigned char* [block], std::size_t [length], std::vector<unsigned char> [out]
+	passed by reference, std::uint32_t [primaryIndex] passed by reference*/
+	static void burrowsWheeler(const unsigned char* block, std::size_t length,
+		std::vector<unsigned char>& out, std::uint32_t& primaryIndex);
+
+	/** inverseBurrowsWheeler
+	@pre 1 <= primaryIndex <= transformed.size(), or transformed is empty
+	@post None
+	@parm std::vector<unsigned char> [transformed], std::uint32_t [primaryIndex]
+	@return the block*/
+	static std::vector<unsigned char> inverseBurrowsWheeler(const std::vector<unsigned char>& transformed,
+		std::uint32_t primaryIndex);
+
+	/** moveToFront
+	@pre None
+	@post bytes replaced by their positions in a recently used list
+	@parm std::vector<unsigned char> [bytes] passed by reference*/
+	static void moveToFront(std::vector<unsigned char>& bytes);
+
+	/** inverseMoveToFront
+	@pre None
+	@post positions replaced by the bytes they stand for
+	@parm std::vector<unsigned char> [positions] passed by reference*/
+	static void inverseMoveToFront(std::vector<unsigned char>& positions);
+
+	/** encodeZeroRuns
+	@pre None
+	@post None
+	@parm std::vector<unsigned char> [positions]
+	@return symbols 0 - 256, runs of 0 as RUN_A / RUN_B digits, v as v + 1*/
+	static std::vector<std::uint32_t> encodeZeroRuns(const std::vector<unsigned char>& positions);
+
+	/** decodeZeroRuns
+	@pre None
+	@post positions holds the decoded positions
+	@parm std::vector<std::uint32_t> [symbols], std::uint64_t [length] of the block,
+	std::vector<unsigned char> [positions] passed by reference
+	@return false if a symbol is above 256 or the positions would pass length, checked before
+	a run is expanded so corrupt runs cannot allocate past the block*/
+	static bool decodeZeroRuns(const std::vector<std::uint32_t>& symbols, std::uint64_t length,
+		std::vector<unsigned char>& positions);
+
+	/** Accessor Methods */
+
+	/** blockSize
+	@return largest block in bytes*/
+	int blockSize() const;
+
+private:
+
+	/** Private Attributes */
+
+	int blockSize_;
+
+	/** Private Methods */
+
+	/** compressBlock
+	@pre None
+	@post block appended to out
+	@parm unsigned char* [block], std::size_t [length], std::vector<unsigned char> [out] passed by reference*/
+	static void compressBlock(const unsigned char* block, std::size_t length, std::vector<unsigned char>& out);
+
+	/** decompressBlock
+	@pre None
+	@post at moved past the block, block appended to text if it is well formed
+	@parm std::vector<unsigned char> [data], std::size_t [at] passed by reference,
+	std::string [text] passed by reference
+	@return true if the block was well formed*/
+	static bool decompressBlock(const std::vector<unsigned char>& data, std::size_t& at, std::string& text);
+
+}; // End of BlockTransformCodec
@@ -0,0 +1,226 @@
+/** @file BlockedDecodeTree.cpp
+ @author Anthony Campos
+ @date 10/19/2026
+ This implementation file implements a BlockedDecodeTree, a HuffmanTree laid out for decoding in
+ blocks of DECODE_BLOCK_BITS levels, each block the size of one cache line */
+
+//---------------------------------------------------------------------------
+// BlockedDecodeTree class:  cache aware tree walk decoder
+//   included features:
+//   -- built from a HuffmanTree after construction (through flatten), for
+//			trees too deep for a full decode table such as large alphabets
+//   -- each block covers DECODE_BLOCK_BITS levels of the tree as a table of
+//			2^DECODE_BLOCK_BITS 32 bit entries, 64 bytes, indexed by the next
+//			bits of the code. An entry is a leaf (symbol and the bits of it
+//			inside the block) or the index of the block below
+//   -- blocks are stored in breadth first order in 64 byte aligned memory,
+//			so the top blocks share few lines and a code costs one cache
+//			line per DECODE_BLOCK_BITS bits instead of one node per bit
+//
+// Assumptions:
+//   --  0 is a left branch and 1 a right branch, as in HuffmanTree::encode
+//   --  symbols (or chars) are >= 0 and below 2^28
+//---------------------------------------------------------------------------
+
+
+// included .h files
+#include "BlockedDecodeTree.h"
+
+// Included libraries
+#include <algorithm>
+#include <utility>
+
+
+namespace {
+
+	const int BLOCK_ENTRIES = 1 << DECODE_BLOCK_BITS;
+	const std::size_t CACHE_LINE_BYTES = 64;
+
+	// entry layout: leaf flag, then for a leaf the bits it uses (1 - DECODE_BLOCK_BITS) and its symbol
+	const std::uint32_t LEAF_FLAG = 0x80000000u;
+	const int LEAF_LENGTH_SHIFT = 28;
+	const std::uint32_t LEAF_SYMBOL_MASK = (1u << LEAF_LENGTH_SHIFT) - 1;
+
+} // end of namespace
+
+
+/** Constructor
+@pre tree is not empty
+@post BlockedDecodeTree Object created with the shape and symbols of tree
+@parm HuffmanTree [tree]*/
+BlockedDecodeTree::BlockedDecodeTree(const HuffmanTree& tree)
+	:blocks_(nullptr), blockCount_(0) {
+
+	std::vector<int> left;
+	std::vector<int> right;
+	std::vector<int> items;
+	tree.flatten(left, right, items);
+
+	std::vector<std::uint32_t> entries;
+
+	if (!items.empty() && left[0] < 0) {
+
+		// lone leaf, it still takes a one bit code
+		entries.assign(BLOCK_ENTRIES, LEAF_FLAG | (1u << LEAF_LENGTH_SHIFT) | static_cast<std::uint32_t>(items[0]));
+		blockCount_ = 1;
+
+	}
+	else if (!items.empty()) {
+
+		// blocks in breadth first order: block b has its root node in roots[b]
+		std::vector<int> roots(1, 0);
+
+		for (std::size_t b = 0; b < roots.size(); ++b) {
+
+			entries.resize(entries.size() + BLOCK_ENTRIES, 0);
+
+			// nodes of this block, with their depth below the block root and their bits so far
+			std::vector<std::pair<int, int>> pending(1, std::make_pair(roots[b], 0));
+			std::vector<int> prefixes(1, 0);
+
+			for (std::size_t i = 0; i < pending.size(); ++i) {
+
+				const int node = pending[i].first;
+				const int depth = pending[i].second;
+				const int prefix = prefixes[i];
+
+				if (depth > 0 && left[node] < 0) {
+
+					// a leaf fills every entry that starts with its bits
+					const int span = 1 << (DECODE_BLOCK_BITS - depth);
+					for (int e = 0; e < span; ++e) {
+
+						entries[b * BLOCK_ENTRIES + (prefix << (DECODE_BLOCK_BITS - depth)) + e] = LEAF_FLAG
+							| (static_cast<std::uint32_t>(depth) << LEAF_LENGTH_SHIFT) | static_cast<std::uint32_t>(items[node]);
+
+					} // end for
+
+				}
+				else if (depth == DECODE_BLOCK_BITS) {
+
+					entries[b * BLOCK_ENTRIES + prefix] = static_cast<std::uint32_t>(roots.size());
+					roots.push_back(node);
+
+				}
+				else {
+
+					pending.push_back(std::make_pair(left[node], depth + 1));
+					prefixes.push_back(prefix << 1);
+					pending.push_back(std::make_pair(right[node], depth + 1));
+					prefixes.push_back((prefix << 1) | 1);
+
+				} // end if
+
+			} // end for
+
+		} // end for
+
+		blockCount_ = roots.size();
+
+	} // end if
+
+	// copy into storage that starts on a cache line
+	const std::size_t slack = CACHE_LINE_BYTES / sizeof(std::uint32_t);
+	storage_.assign(entries.size() + slack, 0);
+
+	std::size_t offset = 0;
+	while (reinterpret_cast<std::uintptr_t>(storage_.data() + offset) % CACHE_LINE_BYTES != 0) {
+		++offset;
+	} // end while
+
+	std::copy(entries.begin(), entries.end(), storage_.begin() + offset);
+	blocks_ = storage_.data() + offset;
+
+} // End of Constructor
+
+/** decodeSymbol
+@pre reader is at the start of a code of the tree
+@post reader moved past the code if it is complete
+@parm BitReader [reader] passed by reference, int [symbol] passed by reference
+@return true if a symbol was decoded, false if the bits left are not a complete code*/
+bool BlockedDecodeTree::decodeSymbol(BitReader& reader, int& symbol) const {
+
+	bool decoded = false;
+	BitReader lookAhead = reader;
+	const std::uint32_t* block = blockCount_ > 0 ? blocks_ : nullptr;
+
+	while (block != nullptr) {
+
+		// bits past the end peek as 0, the leaf length says whether they were real
+		const std::uint32_t entry = block[lookAhead.peekBits(DECODE_BLOCK_BITS)];
+
+		if (entry & LEAF_FLAG) {
+
+			const std::uint64_t length = (entry >> LEAF_LENGTH_SHIFT) & 7;
+
+			if (length <= lookAhead.remaining()) {
+
+				lookAhead.skipBits(length);
+				symbol = static_cast<int>(entry & LEAF_SYMBOL_MASK);
+				decoded = true;
+
+			} // end if
+
+			block = nullptr;
+
+		}
+		else if (lookAhead.remaining() >= static_cast<std::uint64_t>(DECODE_BLOCK_BITS)) {
+
+			lookAhead.skipBits(DECODE_BLOCK_BITS);
+			block = blocks_ + static_cast<std::size_t>(entry) * BLOCK_ENTRIES;
+
+		}
+		else {
+
+			block = nullptr;
+
+		} // end if
+
+	} // end while
+
+	if (decoded) {
+
+		reader = lookAhead;
+
+	} // end if
+
+	return decoded;
+
+} // End of decodeSymbol
+
+/** decode
+@pre data holds codes of the tree
+@post None, decoding stops at the first incomplete code
+@parm unsigned char* [data], std::uint64_t [bitCount]
+@return the decoded symbols*/
+std::vector<int> BlockedDecodeTree::decode(const unsigned char* data, std::uint64_t bitCount) const {
+
+	std::vector<int> symbols;
+	BitReader reader(data, bitCount);
+	int symbol = 0;
+
+	while (decodeSymbol(reader, symbol)) {
+
+		symbols.push_back(symbol);
+
+	} // end while
+
+	return symbols;
+
+} // End of decode
+
+/** blockCount
+@return number of blocks*/
+std::size_t BlockedDecodeTree::blockCount() const {
+
+	return blockCount_;
+
+} // End of blockCount
+
+/** sizeInBytes
+@return bytes taken by the blocks*/
+std::size_t BlockedDecodeTree::sizeInBytes() const {
+
+	return blockCount_ * BLOCK_ENTRIES * sizeof(std::uint32_t);
+
+} // End of sizeInBytes
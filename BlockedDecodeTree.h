@@ -0,0 +1,89 @@
+/** @file BlockedDecodeTree.h
+ @author Anthony Campos
+ @date 10/19/2026
+ This header class file implements a BlockedDecodeTree, a HuffmanTree laid out for decoding in
+ blocks of DECODE_BLOCK_BITS levels, each block the size of one cache line */
+
+	//---------------------------------------------------------------------------
+	// BlockedDecodeTree class:  cache aware tree walk decoder
+	//   included features:
+	//   -- built from a HuffmanTree after construction (through flatten), for
+	//			trees too deep for a full decode table such as large alphabets
+	//   -- each block covers DECODE_BLOCK_BITS levels of the tree as a table of
+	//			2^DECODE_BLOCK_BITS 32 bit entries, 64 bytes, indexed by the next
+	//			bits of the code. An entry is a leaf (symbol and the bits of it
+	//			inside the block) or the index of the block below
+	//   -- blocks are stored in breadth first order in 64 byte aligned memory,
+	//			so the top blocks share few lines and a code costs one cache
+	//			line per DECODE_BLOCK_BITS bits instead of one node per bit
+	//
+	// Assumptions:
+	//   --  0 is a left branch and 1 a right branch, as in HuffmanTree::encode
+	//   --  symbols (or chars) are >= 0 and below 2^28
+	//---------------------------------------------------------------------------
+
+#pragma once
+
+// Included libraries
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// included .h files
+#include "HuffmanTree.h"
+#include "BitStream.h"
+
+// Tree levels resolved per block, 2^DECODE_BLOCK_BITS 4 byte entries fill a 64 byte cache line
+const int DECODE_BLOCK_BITS = 4;
+
+
+class BlockedDecodeTree {
+
+public:
+
+	/** Constructors */
+
+	/** Constructor
+	@pre tree is not empty
+	@post BlockedDecodeTree Object created with the shape and symbols of tree
+	@parm HuffmanTree [tree]*/
+	explicit BlockedDecodeTree(const HuffmanTree& tree);
+
+	/** Copy Constructor & Assignment disabled, blocks_ points into the object's own storage */
+	BlockedDecodeTree(const BlockedDecodeTree& sourceTree) = delete;
+	BlockedDecodeTree& operator=(const BlockedDecodeTree& rhsTree) = delete;
+
+	/** Public Methods */
+
+	/** decodeSymbol
+	@pre reader is at the start of a code of the tree
+	@post reader moved past the code if it is complete
+	@parm BitReader [reader] passed by reference, int [symbol] passed by reference
+	@return true if a symbol was decoded, false if the bits left are not a complete code*/
+	bool decodeSymbol(BitReader& reader, int& symbol) const;
+
+	/** decode
+	@pre data holds codes of the tree
+	@post None, decoding stops at the first incomplete code
+	@parm unsigned char* [data], std::uint64_t [bitCount]
+	@return the decoded symbols*/
+	std::vector<int> decode(const unsigned char* data, std::uint64_t bitCount) const;
+
+	/** Accessor Methods */
+
+	/** blockCount
+	@return number of blocks*/
+	std::size_t blockCount() const;
+
+	/** sizeInBytes
+	@return bytes taken by the blocks*/
+	std::size_t sizeInBytes() const;
+
+private:
+
+	/** Private Attributes */
+	std::vector<std::uint32_t> storage_; // blocks, with room to start them on a 64 byte boundary
+	const std::uint32_t* blocks_; // first entry of block 0, 64 byte aligned
+	std::size_t blockCount_;
+
+}; // End of BlockedDecodeTree
@@ -0,0 +1,147 @@
+//--------------------------------------------------------------------
+// BOUNDEDQUEUE.H
+// Declaration and definition of the template BoundedQueue class
+// Author: Anthony Campos
+//--------------------------------------------------------------------
+// BoundedQueue class:
+//	Implements a fixed capacity, lock-free single producer / single
+//	consumer queue with the following methods:
+//		tryPush, tryPop, push, pop, close
+//  The items are stored in a ring buffer, head_ is only written by the
+//  consumer and tail_ only by the producer.
+//  Assumptions:
+//	 Exactly one thread pushes and exactly one thread pops
+//	 Item must be default constructible and movable
+//--------------------------------------------------------------------
+
+#pragma once
+#include <atomic>
+#include <thread>
+#include <vector>
+
+template <typename Item>
+class BoundedQueue {
+
+public:
+
+	/** Constructors */
+
+	/** Constructor
+	@pre capacity > 0
+	@post empty BoundedQueue Object created that holds up to capacity items
+	@parm int [capacity]*/
+	explicit BoundedQueue(int capacity)
+		:items_(capacity + 1), head_(0), tail_(0), closed_(false) {
+
+	} // End of Constructor
+
+	/** Copy Constructor & Assignment disabled, queue is shared between two threads */
+	BoundedQueue(const BoundedQueue& sourceQueue) = delete;
+	BoundedQueue& operator=(const BoundedQueue& rhsQueue) = delete;
+
+
+	//------------------------------------------------------------------------
+	// tryPush - adds a single item to the back of the queue if there is room
+	// Preconditions: called by the producer thread only
+	// Postconditions: returns false if the queue is full, otherwise the
+	//		item is moved into the queue and true is returned
+	bool tryPush(Item& item) {
+
+		const unsigned int tail = tail_.load(std::memory_order_relaxed);
+		const unsigned int next = advance(tail);
+
+		// full, consumer has not freed the slot yet
+		if (next == head_.load(std::memory_order_acquire)) {
+			return false;
+		} // end if
+
+		items_[tail] = std::move(item);
+		tail_.store(next, std::memory_order_release);
+
+		return true;
+
+	} // end of tryPush
+
+	//------------------------------------------------------------------------
+	// tryPop - removes the item at the front of the queue if there is one
+	// Preconditions: called by the consumer thread only
+	// Postconditions: returns false if the queue is empty, otherwise the
+	//		front item is moved into item and true is returned
+	bool tryPop(Item& item) {
+
+		const unsigned int head = head_.load(std::memory_order_relaxed);
+
+		// empty, producer has not published a slot yet
+		if (head == tail_.load(std::memory_order_acquire)) {
+			return false;
+		} // end if
+
+		item = std::move(items_[head]);
+		head_.store(advance(head), std::memory_order_release);
+
+		return true;
+
+	} // end of tryPop
+
+	//------------------------------------------------------------------------
+	// push - adds a single item, yielding while the queue is full
+	// Preconditions: called by the producer thread only
+	// Postconditions: item is in the queue
+	void push(Item& item) {
+
+		while (!tryPush(item)) {
+			std::this_thread::yield();
+		} // end while
+
+	} // end of push
+
+	//------------------------------------------------------------------------
+	// pop - removes the front item, yielding while the queue is empty
+	// Preconditions: called by the consumer thread only
+	// Postconditions: returns true with the front item moved into item, or
+	//		false once the queue is empty and has been closed
+	bool pop(Item& item) {
+
+		while (!tryPop(item)) {
+
+			if (closed_.load(std::memory_order_acquire)) {
+				// items pushed before close are still delivered
+				return tryPop(item);
+			} // end if
+
+			std::this_thread::yield();
+
+		} // end while
+
+		return true;
+
+	} // end of pop
+
+	//------------------------------------------------------------------------
+	// close - marks that the producer will push no more items
+	// Preconditions: called by the producer thread only
+	// Postconditions: pop returns false once the remaining items are drained
+	void close() {
+
+		closed_.store(true, std::memory_order_release);
+
+	} // end of close
+
+private:
+
+	//------------------------------------------------------------------------
+	// advance - next slot of the ring buffer
+	unsigned int advance(unsigned int position) const {
+
+		++position;
+		return (position == items_.size()) ? 0 : position;
+
+	} // end of advance
+
+	// attributes
+	std::vector<Item> items_;				// ring buffer, one slot always left empty
+	std::atomic<unsigned int> head_;		// next slot to pop, written by consumer
+	std::atomic<unsigned int> tail_;		// next slot to push, written by producer
+	std::atomic<bool> closed_;				// producer is done
+
+}; // End of BoundedQueue
@@ -0,0 +1,101 @@
+/** @file ByteOrder.h
+ @author Anthony Campos
+ @date 10/19/2026
+ This header file defines the little endian integer helpers shared by every file format and
+ wire protocol of the project, next to the BitWriter and BitReader that pack the codes */
+
+	//---------------------------------------------------------------------------
+	// ByteOrder functions:  unsigned integers <-> little endian bytes
+	//   included features:
+	//   -- appendUint / storeUint / loadUint for byte buffers, writeUint / readUint
+	//			for streams
+	//   -- any width from 1 to 8 bytes, values are truncated to the low bytes
+	//   -- byte by byte, so buffers need no alignment and the host byte order
+	//			does not matter
+	//   -- inline, decoders call loadUint once per table entry
+	//
+	// Assumptions:
+	//   --  1 <= byteCount <= 8
+	//   --  callers bounds check buffers, loadUint reads byteCount bytes at at
+	//---------------------------------------------------------------------------
+
+#pragma once
+
+// Included libraries
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+
+/** appendUint
+@pre 1 <= byteCount <= 8
+@post the low byteCount bytes of value appended to out, little endian
+@parm std::vector<unsigned char> [out] passed by reference, std::uint64_t [value], int [byteCount]*/
+inline void appendUint(std::vector<unsigned char>& out, std::uint64_t value, int byteCount) {
+
+	for (int i = 0; i < byteCount; ++i) {
+
+		out.push_back(static_cast<unsigned char>(value >> (8 * i)));
+
+	} // end for
+
+} // End of appendUint
+
+/** storeUint
+@pre at holds at least byteCount bytes, 1 <= byteCount <= 8
+@post the low byteCount bytes of value written at at, little endian
+@parm unsigned char* [at], std::uint64_t [value], int [byteCount]*/
+inline void storeUint(unsigned char* at, std::uint64_t value, int byteCount) {
+
+	for (int i = 0; i < byteCount; ++i) {
+
+		at[i] = static_cast<unsigned char>(value >> (8 * i));
+
+	} // end for
+
+} // End of storeUint
+
+/** loadUint
+@pre at holds at least byteCount bytes, 1 <= byteCount <= 8
+@post None
+@parm unsigned char* [at], int [byteCount]
+@return the little endian value of the byteCount bytes at at*/
+inline std::uint64_t loadUint(const unsigned char* at, int byteCount) {
+
+	std::uint64_t value = 0;
+	for (int i = byteCount - 1; i >= 0; --i) {
+
+		value = (value << 8) | at[i];
+
+	} // end for
+
+	return value;
+
+} // End of loadUint
+
+/** writeUint
+@pre 1 <= byteCount <= 8
+@post the low byteCount bytes of value written to out, little endian
+@parm std::ostream [out] passed by reference, std::uint64_t [value], int [byteCount]*/
+inline void writeUint(std::ostream& out, std::uint64_t value, int byteCount) {
+
+	unsigned char bytes[8];
+	storeUint(bytes, value, byteCount);
+	out.write(reinterpret_cast<const char*>(bytes), byteCount);
+
+} // End of writeUint
+
+/** readUint
+@pre 1 <= byteCount <= 8
+@post byteCount bytes consumed from in
+@parm std::istream [in] passed by reference, int [byteCount]
+@return the little endian value read, bytes past the end of in read as 0*/
+inline std::uint64_t readUint(std::istream& in, int byteCount) {
+
+	unsigned char bytes[8] = {};
+	in.read(reinterpret_cast<char*>(bytes), byteCount);
+
+	return loadUint(bytes, byteCount);
+
+} // End of readUint
@@ -0,0 +1,251 @@
+/** @file CodeTranscoder.cpp
+ @author Anthony Campos
+ @date 10/19/2026
+ This implementation file implements a CodeTranscoder, which rewrites packed code of one
+ HuffmanAlgorithm codebook as packed code of another without decoding it to text first */
+
+//---------------------------------------------------------------------------
+// CodeTranscoder class:  codebook to codebook re-encoding
+//   included features:
+//   -- an automaton over the code tree of the old codebook steps a whole
+//			input byte per table lookup, each entry holds the next tree node
+//			and the new codes of the letters completed in the byte, already
+//			concatenated when they fit in 64 bits
+//   -- the last, partial byte of the input steps one bit at a time
+//   -- allows for transcoding a PackedCode in memory, or a stream of code
+//			in chunks of bufferSize bytes to a ByteSink, so memory use does
+//			not grow with the input
+//
+// Assumptions:
+//   --  code was made with the old codebook, a trailing incomplete code is
+//			dropped like HuffmanAlgorithm::decode drops it
+//   --  both HuffmanAlgorithm objects only need to live through the constructor
+//---------------------------------------------------------------------------
+
+
+// included .h files
+#include "CodeTranscoder.h"
+
+
+/** Constructor
+@pre None
+@post CodeTranscoder Object created, mapping codes of oldCodec to codes of newCodec
+@parm HuffmanAlgorithm [oldCodec], HuffmanAlgorithm [newCodec]*/
+CodeTranscoder::CodeTranscoder(const HuffmanAlgorithm& oldCodec, const HuffmanAlgorithm& newCodec) {
+
+	// old code tree as internal nodes, node 0 is the root
+	oldCodec.branches(children_);
+
+	// the new codes as right aligned bits
+	char letter = 'a';
+	for (int i = 0; i < NUM_LETTERS; ++i) {
+
+		codeBits_[i] = newCodec.codeBits(letter);
+		codeLengths_[i] = newCodec.codeLength(letter);
+		++letter;
+
+	} // end for
+
+	const int states = stateCount();
+	byteTable_.resize(static_cast<std::size_t>(states) * 256);
+
+	for (int state = 0; state < states; ++state) {
+
+		for (int byte = 0; byte < 256; ++byte) {
+
+			ByteStep& step = byteTable_[static_cast<std::size_t>(state) * 256 + byte];
+			int current = state;
+			int length = 0;
+
+			for (int bit = 7; bit >= 0; --bit) {
+
+				const int child = children_[(byte >> bit) & 1][current];
+
+				if (child < 0) {
+
+					const int completed = -1 - child;
+					step.letters_[step.letterCount_] = static_cast<unsigned char>(completed);
+					++step.letterCount_;
+
+					// past 64 bits the letters are written one code at a time instead
+					length += codeLengths_[completed];
+					step.packed_ = step.packed_ && length <= 64;
+
+					if (step.packed_) {
+						step.bits_ = (step.bits_ << codeLengths_[completed]) | codeBits_[completed];
+					} // end if
+
+					current = 0;
+
+				}
+				else {
+
+					current = child;
+
+				} // end if
+
+			} // end for
+
+			step.length_ = static_cast<unsigned char>(step.packed_ ? length : 0);
+			step.next_ = static_cast<unsigned char>(current);
+
+		} // end for
+
+	} // end for
+
+} // End of Constructor
+
+/** transcodeBits
+@pre 0 < bitCount <= 8
+@post the first bitCount bits of byte stepped one at a time from state, the new codes
+of the completed letters written to writer
+@parm unsigned char [byte], int [bitCount], int [state] & BitWriter [writer] passed by reference*/
+void CodeTranscoder::transcodeBits(unsigned char byte, int bitCount, int& state, BitWriter& writer) const {
+
+	for (int bit = 7; bit > 7 - bitCount; --bit) {
+
+		const int child = children_[(byte >> bit) & 1][state];
+
+		if (child < 0) {
+
+			writer.writeBits(codeBits_[-1 - child], codeLengths_[-1 - child]);
+			state = 0;
+
+		}
+		else {
+
+			state = child;
+
+		} // end if
+
+	} // end for
+
+} // End of transcodeBits
+
+/** transcodeBytes
+@pre None
+@post size whole bytes stepped from state through the byte table, the new codes of the
+completed letters written to writer
+@parm unsigned char* [data], std::size_t [size], int [state] & BitWriter [writer] passed by reference*/
+void CodeTranscoder::transcodeBytes(const unsigned char* data, std::size_t size, int& state, BitWriter& writer) const {
+
+	for (std::size_t i = 0; i < size; ++i) {
+
+		const ByteStep& step = byteTable_[static_cast<std::size_t>(state) * 256 + data[i]];
+
+		if (step.packed_) {
+
+			if (step.length_ > 0) {
+				writer.writeBits(step.bits_, step.length_);
+			} // end if
+
+		}
+		else {
+
+			for (int j = 0; j < step.letterCount_; ++j) {
+
+				writer.writeBits(codeBits_[step.letters_[j]], codeLengths_[step.letters_[j]]);
+
+			} // end for
+
+		} // end if
+
+		state = step.next_;
+
+	} // end for
+
+} // End of transcodeBytes
+
+/** transcode
+@pre code was made with the old codebook
+@post None
+@parm PackedCode [code]
+@return the same letters as packed code of the new codebook*/
+PackedCode CodeTranscoder::transcode(const PackedCode& code) const {
+
+	BitWriter writer;
+	int state = 0;
+
+	const std::size_t wholeBytes = static_cast<std::size_t>(code.bitCount_ / 8);
+	transcodeBytes(code.bytes_.data(), wholeBytes, state, writer);
+
+	if (code.bitCount_ % 8 != 0) {
+		transcodeBits(code.bytes_[wholeBytes], static_cast<int>(code.bitCount_ % 8), state, writer);
+	} // end if
+
+	writer.finish();
+
+	PackedCode result;
+	result.bitCount_ = writer.bitCount();
+	writer.swapBytes(result.bytes_);
+
+	return result;
+
+} // End of transcode
+
+/** transcode
+@pre in holds at least (bitCount + 7) / 8 bytes of code made with the old codebook,
+bufferSize > 0
+@post the code read a chunk at a time and written to sink as code of the new codebook,
+last byte padded with 0 bits and sink flushed
+@parm std::istream [in] passed by reference, std::uint64_t [bitCount] bits of code in in,
+ByteSink [sink] & std::uint64_t [newBitCount] passed by reference, std::size_t [bufferSize]
+@return false if in ended early or sink failed, newBitCount holds the code bits written*/
+bool CodeTranscoder::transcode(std::istream& in, std::uint64_t bitCount, ByteSink& sink, std::uint64_t& newBitCount,
+	std::size_t bufferSize) const {
+
+	std::vector<unsigned char> chunk(bufferSize);
+	std::vector<unsigned char> output;
+	BitWriter writer;
+
+	int state = 0;
+	bool good = true;
+	std::uint64_t remaining = (bitCount >> 3) + ((bitCount & 7) != 0 ? 1 : 0);
+
+	while (good && remaining > 0) {
+
+		const std::size_t size = static_cast<std::size_t>(remaining < bufferSize ? remaining : bufferSize);
+		in.read(reinterpret_cast<char*>(chunk.data()), static_cast<std::streamsize>(size));
+		good = static_cast<std::size_t>(in.gcount()) == size;
+
+		if (good) {
+
+			remaining -= size;
+
+			// the last byte of the code may be partial
+			const int tailBits = (remaining == 0) ? static_cast<int>(bitCount % 8) : 0;
+			transcodeBytes(chunk.data(), (tailBits > 0) ? size - 1 : size, state, writer);
+
+			if (tailBits > 0) {
+				transcodeBits(chunk[size - 1], tailBits, state, writer);
+			} // end if
+
+			// hand complete bytes on once a buffer's worth has built up
+			if (writer.bytes().size() >= bufferSize) {
+
+				writer.swapBytes(output);
+				good = sink.write(output.data(), output.size());
+
+			} // end if
+
+		} // end if
+
+	} // end while
+
+	writer.finish();
+	writer.swapBytes(output);
+	good = sink.write(output.data(), output.size()) && sink.flush() && good;
+
+	newBitCount = writer.bitCount();
+
+	return good;
+
+} // End of transcode
+
+/** stateCount
+@return number of automaton states, the internal nodes of the old code tree*/
+int CodeTranscoder::stateCount() const {
+
+	return static_cast<int>(children_[0].size());
+
+} // End of stateCount
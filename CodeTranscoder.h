@@ -0,0 +1,114 @@
+/** @file CodeTranscoder.h
+ @author Anthony Campos
+ @date 10/19/2026
+ This header class file implements a CodeTranscoder, which rewrites packed code of one
+ HuffmanAlgorithm codebook as packed code of another without decoding it to text first */
+
+	//---------------------------------------------------------------------------
+	// CodeTranscoder class:  codebook to codebook re-encoding
+	//   included features:
+	//   -- an automaton over the code tree of the old codebook steps a whole
+	//			input byte per table lookup, each entry holds the next tree node
+	//			and the new codes of the letters completed in the byte, already
+	//			concatenated when they fit in 64 bits
+	//   -- the last, partial byte of the input steps one bit at a time
+	//   -- allows for transcoding a PackedCode in memory, or a stream of code
+	//			in chunks of bufferSize bytes to a ByteSink, so memory use does
+	//			not grow with the input
+	//
+	// Assumptions:
+	//   --  code was made with the old codebook, a trailing incomplete code is
+	//			dropped like HuffmanAlgorithm::decode drops it
+	//   --  both HuffmanAlgorithm objects only need to live through the constructor
+	//---------------------------------------------------------------------------
+
+#pragma once
+
+// Included libraries
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+// included .h files
+#include "HuffmanAlgorithm.h"
+#include "BitStream.h"
+#include "StreamEncoder.h"
+
+
+class CodeTranscoder {
+
+public:
+
+	/** Constructors */
+
+	/** Constructor
+	@pre None
+	@post CodeTranscoder Object created, mapping codes of oldCodec to codes of newCodec
+	@parm HuffmanAlgorithm [oldCodec], HuffmanAlgorithm [newCodec]*/
+	CodeTranscoder(const HuffmanAlgorithm& oldCodec, const HuffmanAlgorithm& newCodec);
+
+	/** Public Methods */
+
+	/** transcode
+	@pre code was made with the old codebook
+	@post None
+	@parm PackedCode [code]
+	@return the same letters as packed code of the new codebook*/
+	PackedCode transcode(const PackedCode& code) const;
+
+	/** transcode
+	@pre in holds at least (bitCount + 7) / 8 bytes of code made with the old codebook,
+	bufferSize > 0
+	@post the code read a chunk at a time and written to sink as code of the new codebook,
+	last byte padded with 0 bits and sink flushed
+	@parm std::istream [in] passed by reference, std::uint64_t [bitCount] bits of code in in,
+	ByteSink [sink] & std::uint64_t [newBitCount] passed by reference, std::size_t [bufferSize]
+	@return false if in ended early or sink failed, newBitCount holds the code bits written*/
+	bool transcode(std::istream& in, std::uint64_t bitCount, ByteSink& sink, std::uint64_t& newBitCount,
+		std::size_t bufferSize = DEFAULT_STREAM_BUFFER_SIZE) const;
+
+	/** Accessor Methods */
+
+	/** stateCount
+	@return number of automaton states, the internal nodes of the old code tree*/
+	int stateCount() const;
+
+private:
+
+	/** Private Attributes */
+
+	// one byte of old code from one state
+	struct ByteStep {
+
+		std::uint64_t bits_ = 0; // new codes of the completed letters, right aligned
+		unsigned char length_ = 0; // bits in bits_
+		unsigned char next_ = 0; // state after the byte
+		unsigned char letterCount_ = 0; // letters completed in the byte
+		bool packed_ = true; // false when the new codes are longer than 64 bits, see letters_
+		unsigned char letters_[8] = {}; // completed letters, index 0 - 25
+
+	}; // end of ByteStep
+
+	std::vector<int> children_[2]; // old code tree, node 0 the root, leaf -1 - letter
+	std::uint64_t codeBits_[NUM_LETTERS]; // new codes, right aligned
+	int codeLengths_[NUM_LETTERS];
+	std::vector<ByteStep> byteTable_; // state * 256 + byte -> step
+
+	/** Private Methods */
+
+	/** transcodeBits
+	@pre 0 < bitCount <= 8
+	@post the first bitCount bits of byte stepped one at a time from state, the new codes
+	of the completed letters written to writer
+	@parm unsigned char [byte], int [bitCount], int [state] & BitWriter [writer] passed by reference*/
+	void transcodeBits(unsigned char byte, int bitCount, int& state, BitWriter& writer) const;
+
+	/** transcodeBytes
+	@pre None
+	@post size whole bytes stepped from state through the byte table, the new codes of the
+	completed letters written to writer
+	@parm unsigned char* [data], std::size_t [size], int [state] & BitWriter [writer] passed by reference*/
+	void transcodeBytes(const unsigned char* data, std::size_t size, int& state, BitWriter& writer) const;
+
+}; // End of CodeTranscoder
@@ -0,0 +1,841 @@
+/** @file CodebookDictionary.cpp
+ @author Anthony Campos
+ @date 10/19/2026
+ This implementation file implements a CodebookDictionary, a pre-trained 'a' - 'z' codebook
+ and its decode tables stored in one compact, versioned, position independent binary blob */
+
+//---------------------------------------------------------------------------
+// CodebookDictionary class:  persistent Huffman codebook
+//   included features:
+//   -- allows for training a blob from a sample text or a HuffmanAlgorithm
+//   -- allows for loading a blob from a file (memory mapped where available),
+//			from a std::vector, or attaching to memory owned by the caller
+//   -- decodes straight from the blob, loading validates the header and
+//			bounds checks every code, table entry and tree node once
+//   -- allows for publishing a blob into a named POSIX shared memory segment
+//			and attaching to it read only, so every process on a host decodes
+//			from one copy of the tables. Only segments of the expected publisher
+//			that others cannot write are attached
+//   -- allows for encoding and decoding messages that carry the dictionary
+//			ID and version instead of their own table
+//
+// Assumptions:
+//   --  only 'a' - 'z' are encoded, other chars are skipped
+//   --  a published segment is never changed, a new dictionary version is
+//			published under a new name (see sharedName) and the old name unlinked
+//---------------------------------------------------------------------------
+
+
+// included .h files
+#include "CodebookDictionary.h"
+#include "ByteOrder.h"
+
+// Included libraries
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+	// header field offsets
+	const std::size_t MAGIC_AT = 0;
+	const std::size_t FORMAT_AT = 4;
+	const std::size_t ID_AT = 8;
+	const std::size_t VERSION_AT = 12;
+	const std::size_t LETTERS_AT = 16;
+	const std::size_t TABLE_BITS_AT = 20;
+	const std::size_t CODES_AT = 24;
+	const std::size_t TABLE_AT = 28;
+	const std::size_t TREE_AT = 32;
+	const std::size_t TREE_NODES_AT = 36;
+	const std::size_t SIZE_AT = 40;
+	const std::size_t CHECKSUM_AT = 44;
+	const std::size_t HEADER_SIZE = 48;
+
+	const char BLOB_MAGIC[4] = { 'H', 'U', 'F', 'D' };
+	const std::uint16_t LEAF_MARK = 0xFFFF;
+
+	/** readU16, readU32, readU64 read the fixed width fields of the blob and messages */
+	inline std::uint16_t readU16(const unsigned char* at) {
+
+		return static_cast<std::uint16_t>(loadUint(at, 2));
+
+	} // End of readU16
+
+	inline std::uint32_t readU32(const unsigned char* at) {
+
+		return static_cast<std::uint32_t>(loadUint(at, 4));
+
+	} // End of readU32
+
+	inline std::uint64_t readU64(const unsigned char* at) {
+
+		return loadUint(at, 8);
+
+	} // End of readU64
+
+	/** writeU16, writeU32, writeU64 write them */
+	inline void writeU16(unsigned char* at, std::uint16_t value) {
+
+		storeUint(at, value, 2);
+
+	} // End of writeU16
+
+	inline void writeU32(unsigned char* at, std::uint32_t value) {
+
+		storeUint(at, value, 4);
+
+	} // End of writeU32
+
+	inline void writeU64(unsigned char* at, std::uint64_t value) {
+
+		storeUint(at, value, 8);
+
+	} // End of writeU64
+
+	/** checksum, 32 bit FNV-1a */
+	std::uint32_t checksum(const unsigned char* data, std::size_t size) {
+
+		std::uint32_t hash = 2166136261u;
+
+		for (std::size_t i = 0; i < size; ++i) {
+
+			hash = (hash ^ data[i]) * 16777619u;
+
+		} // end for
+
+		return hash;
+
+	} // End of checksum
+
+	/** alignTo8 rounds offset up to a multiple of 8 */
+	inline std::size_t alignTo8(std::size_t offset) {
+
+		return (offset + 7) & ~static_cast<std::size_t>(7);
+
+	} // End of alignTo8
+
+} // end of namespace
+
+
+/** Defualt Constructor
+@pre None
+@post Empty CodebookDictionary Object created, isLoaded is false*/
+CodebookDictionary::CodebookDictionary()
+	:mapping_(nullptr), mappingSize_(0), blob_(nullptr), blobSize_(0),
+	codes_(nullptr), table_(nullptr), tree_(nullptr), tableBits_(0)
+{} // End of Constructor
+
+/** Destructor
+@pre None
+@post blob memory or mapping released*/
+CodebookDictionary::~CodebookDictionary() {
+
+	release();
+
+} // End of Destructor
+
+/** serialize
+@pre None
+@post None
+@parm HuffmanAlgorithm [codec], std::uint32_t [dictionaryId], std::uint32_t [dictionaryVersion]
+@return blob holding the codebook and decode tables of codec*/
+std::vector<unsigned char> CodebookDictionary::serialize(const HuffmanAlgorithm& codec,
+	std::uint32_t dictionaryId, std::uint32_t dictionaryVersion) {
+
+	// the code tree as flat nodes, children by index, node 0 the root
+	std::vector<int> left;
+	std::vector<int> right;
+	std::vector<int> items;
+	codec.flatten(left, right, items);
+
+	const int tableBits = DECODE_TABLE_BITS;
+	const std::size_t codesOffset = HEADER_SIZE;
+	const std::size_t tableOffset = alignTo8(codesOffset + NUM_LETTERS * 8);
+	const std::size_t treeOffset = alignTo8(tableOffset + (std::size_t(2) << tableBits));
+	const std::size_t blobSize = alignTo8(treeOffset + left.size() * 4);
+
+	std::vector<unsigned char> blob(blobSize, 0);
+	unsigned char* data = blob.data();
+
+	for (int i = 0; i < NUM_LETTERS; ++i) {
+
+		const std::uint32_t bits = static_cast<std::uint32_t>(codec.codeBits(static_cast<char>('a' + i)));
+		const int length = codec.codeLength(static_cast<char>('a' + i));
+
+		writeU32(data + codesOffset + i * 8, bits);
+		writeU32(data + codesOffset + i * 8 + 4, static_cast<std::uint32_t>(length));
+
+		// every table index that starts with a short code decodes to its letter
+		if (length <= tableBits) {
+
+			const int freeBits = tableBits - length;
+			for (std::uint32_t pattern = 0; pattern < (1u << freeBits); ++pattern) {
+
+				std::size_t entry = (static_cast<std::size_t>(bits) << freeBits) | pattern;
+				writeU16(data + tableOffset + entry * 2, static_cast<std::uint16_t>((length << 8) | ('a' + i)));
+
+			} // end for
+
+		} // end if
+
+	} // end for
+
+	for (std::size_t node = 0; node < left.size(); ++node) {
+
+		const bool leaf = left[node] < 0;
+		writeU16(data + treeOffset + node * 4, leaf ? LEAF_MARK : static_cast<std::uint16_t>(left[node]));
+		writeU16(data + treeOffset + node * 4 + 2, static_cast<std::uint16_t>(leaf ? items[node] : right[node]));
+
+	} // end for
+
+	std::memcpy(data + MAGIC_AT, BLOB_MAGIC, sizeof(BLOB_MAGIC));
+	writeU32(data + FORMAT_AT, DICTIONARY_FORMAT_VERSION);
+	writeU32(data + ID_AT, dictionaryId);
+	writeU32(data + VERSION_AT, dictionaryVersion);
+	writeU32(data + LETTERS_AT, NUM_LETTERS);
+	writeU32(data + TABLE_BITS_AT, tableBits);
+	writeU32(data + CODES_AT, static_cast<std::uint32_t>(codesOffset));
+	writeU32(data + TABLE_AT, static_cast<std::uint32_t>(tableOffset));
+	writeU32(data + TREE_AT, static_cast<std::uint32_t>(treeOffset));
+	writeU32(data + TREE_NODES_AT, static_cast<std::uint32_t>(left.size()));
+	writeU32(data + SIZE_AT, static_cast<std::uint32_t>(blobSize));
+	writeU32(data + CHECKSUM_AT, checksum(data + HEADER_SIZE, blobSize - HEADER_SIZE));
+
+	return blob;
+
+} // End of serialize
+
+/** train
+@pre None
+@post None
+@parm std::string [sample] text whose letter counts train the codebook,
+std::uint32_t [dictionaryId], std::uint32_t [dictionaryVersion]
+@return blob of the trained codebook*/
+std::vector<unsigned char> CodebookDictionary::train(const std::string& sample,
+	std::uint32_t dictionaryId, std::uint32_t dictionaryVersion) {
+
+	// every letter gets a count of at least 1, so text beyond the sample stays encodable
+	long long counts[NUM_LETTERS];
+	for (int i = 0; i < NUM_LETTERS; ++i) {
+
+		counts[i] = 1;
+
+	} // end for
+
+	for (unsigned int i = 0; i < sample.size(); ++i) {
+
+		char c = sample[i];
+		// only valid char 'a' - 'z'
+		if (c >= 'a' && c <= 'z') {
+
+			++counts[c - 'a'];
+
+		} // end if
+
+	} // end for
+
+	HuffmanAlgorithm codec(counts);
+
+	return serialize(codec, dictionaryId, dictionaryVersion);
+
+} // End of train
+
+/** save
+@pre None
+@post blob written to path
+@parm std::vector<unsigned char> [blob], std::string [path]
+@return true if the file could be written*/
+bool CodebookDictionary::save(const std::vector<unsigned char>& blob, const std::string& path) {
+
+	std::ofstream out(path, std::ios::binary | std::ios::trunc);
+	out.write(reinterpret_cast<const char*>(blob.data()), static_cast<std::streamsize>(blob.size()));
+
+	return out.good();
+
+} // End of save
+
+/** load maps (or reads) a blob file
+@pre None
+@post dictionary uses the blob of path, any previous blob released
+@parm std::string [path]
+@return true if the file holds a valid blob*/
+bool CodebookDictionary::load(const std::string& path) {
+
+	release();
+
+	bool loaded = false;
+
+#ifndef _WIN32
+
+	int fd = ::open(path.c_str(), O_RDONLY);
+	if (fd >= 0) {
+
+		struct stat info;
+		if (::fstat(fd, &info) == 0 && info.st_size > 0) {
+
+			void* mapped = ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+			if (mapped != MAP_FAILED) {
+
+				mapping_ = mapped;
+				mappingSize_ = static_cast<std::size_t>(info.st_size);
+				loaded = use(static_cast<const unsigned char*>(mapped), mappingSize_);
+
+			} // end if
+
+		} // end if
+
+		::close(fd);
+
+	} // end if
+
+#else
+
+	std::ifstream in(path, std::ios::binary);
+	if (in) {
+
+		owned_.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+		loaded = use(owned_.data(), owned_.size());
+
+	} // end if
+
+#endif
+
+	if (!loaded) {
+		release();
+	} // end if
+
+	return loaded;
+
+} // End of load
+
+/** assign takes over a blob
+@pre None
+@post dictionary owns and uses blob, any previous blob released
+@parm std::vector<unsigned char> [blob]
+@return true if blob is valid*/
+bool CodebookDictionary::assign(std::vector<unsigned char> blob) {
+
+	release();
+
+	owned_.swap(blob);
+	bool loaded = use(owned_.data(), owned_.size());
+
+	if (!loaded) {
+		release();
+	} // end if
+
+	return loaded;
+
+} // End of assign
+
+/** attach uses memory the caller owns
+@pre data stays valid and unchanged while attached
+@post dictionary decodes straight from data, any previous blob released
+@parm unsigned char* [data], std::size_t [size]
+@return true if data holds a valid blob*/
+bool CodebookDictionary::attach(const unsigned char* data, std::size_t size) {
+
+	release();
+
+	bool loaded = use(data, size);
+
+	if (!loaded) {
+		release();
+	} // end if
+
+	return loaded;
+
+} // End of attach
+
+/** sharedName
+@pre None
+@post None
+@parm std::uint32_t [dictionaryId], std::uint32_t [dictionaryVersion]
+@return shared memory segment name for that dictionary version, "/huffman-dictionary-ID-VERSION"*/
+std::string CodebookDictionary::sharedName(std::uint32_t dictionaryId, std::uint32_t dictionaryVersion) {
+
+	return "/huffman-dictionary-" + std::to_string(dictionaryId) + "-" + std::to_string(dictionaryVersion);
+
+} // End of sharedName
+
+/** publishShared copies a blob into a new named shared memory segment
+@pre name starts with '/' and holds no other '/'
+@post segment name created (readable by every user), holding blob. The segment outlives
+the process until unlinkShared
+@parm std::vector<unsigned char> [blob], std::string [name]
+@return true if blob is valid and the segment was created, false if name already exists
+or shared memory is not available*/
+bool CodebookDictionary::publishShared(const std::vector<unsigned char>& blob, const std::string& name) {
+
+	bool published = false;
+
+#ifndef _WIN32
+
+	// O_EXCL, resizing a segment others have mapped would fault their reads
+	int fd = validate(blob.data(), blob.size()) ? ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644) : -1;
+	if (fd >= 0) {
+
+		if (::ftruncate(fd, static_cast<off_t>(blob.size())) == 0) {
+
+			void* mapped = ::mmap(nullptr, blob.size(), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+			if (mapped != MAP_FAILED) {
+
+				// the checksum is only right once every byte is in, early readers fail validate
+				std::memcpy(mapped, blob.data(), blob.size());
+				::munmap(mapped, blob.size());
+				published = true;
+
+			} // end if
+
+		} // end if
+
+		::close(fd);
+
+		if (!published) {
+			::shm_unlink(name.c_str());
+		} // end if
+
+	} // end if
+
+#else
+	(void)blob;
+	(void)name;
+#endif
+
+	return published;
+
+} // End of publishShared
+
+/** attachShared maps a published segment read only
+@pre None
+@post dictionary decodes straight from the segment, any previous blob released
+@parm std::string [name], long [publisherUid] user the segment must belong to,
+SHARED_OWNER_SELF for the effective user of this process
+@return true if the segment exists, belongs to publisherUid, is not writable by its
+group or others, and holds a valid blob. A segment still being published fails the
+checksum, so the caller can retry*/
+bool CodebookDictionary::attachShared(const std::string& name, long publisherUid) {
+
+	release();
+
+	bool loaded = false;
+
+#ifndef _WIN32
+
+	int fd = ::shm_open(name.c_str(), O_RDONLY, 0);
+	if (fd >= 0) {
+
+		// the name is predictable and anyone can recompute the checksum, so only a segment
+		// nobody but its publisher can have written is trusted
+		const uid_t owner = (publisherUid == SHARED_OWNER_SELF) ? ::geteuid() : static_cast<uid_t>(publisherUid);
+
+		struct stat info;
+		if (::fstat(fd, &info) == 0 && info.st_size > 0 && info.st_uid == owner
+			&& (info.st_mode & (S_IWGRP | S_IWOTH)) == 0) {
+
+			void* mapped = ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_SHARED, fd, 0);
+			if (mapped != MAP_FAILED) {
+
+				mapping_ = mapped;
+				mappingSize_ = static_cast<std::size_t>(info.st_size);
+				loaded = use(static_cast<const unsigned char*>(mapped), mappingSize_);
+
+			} // end if
+
+		} // end if
+
+		::close(fd);
+
+	} // end if
+
+#else
+	(void)name;
+	(void)publisherUid;
+#endif
+
+	if (!loaded) {
+		release();
+	} // end if
+
+	return loaded;
+
+} // End of attachShared
+
+/** unlinkShared removes a segment name
+@pre None
+@post name removed, processes attached to it keep their mapping until they release it
+@parm std::string [name]
+@return true if the name existed and was removed*/
+bool CodebookDictionary::unlinkShared(const std::string& name) {
+
+	bool unlinked = false;
+
+#ifndef _WIN32
+	unlinked = ::shm_unlink(name.c_str()) == 0;
+#else
+	(void)name;
+#endif
+
+	return unlinked;
+
+} // End of unlinkShared
+
+/** validate
+@pre None
+@post None
+@parm unsigned char* [data], std::size_t [size]
+@return true if data holds a complete blob of a known format with a matching checksum,
+every section inside the blob, every code, table entry and tree node in range, and
+the codes, table and tree agreeing with each other*/
+bool CodebookDictionary::validate(const unsigned char* data, std::size_t size) {
+
+	bool valid = data != nullptr && size >= HEADER_SIZE
+		&& std::memcmp(data + MAGIC_AT, BLOB_MAGIC, sizeof(BLOB_MAGIC)) == 0
+		&& readU32(data + FORMAT_AT) == DICTIONARY_FORMAT_VERSION
+		&& readU32(data + LETTERS_AT) == static_cast<std::uint32_t>(NUM_LETTERS);
+
+	if (valid) {
+
+		// 64 bit sums, a 32 bit offset plus a section size must not wrap back into the blob
+		const std::uint64_t blobSize = readU32(data + SIZE_AT);
+		const std::uint64_t tableBits = readU32(data + TABLE_BITS_AT);
+		const std::uint64_t treeNodes = readU32(data + TREE_NODES_AT);
+
+		valid = blobSize <= size && blobSize >= HEADER_SIZE && tableBits <= 16
+			&& treeNodes >= 1 && treeNodes < LEAF_MARK
+			&& std::uint64_t(readU32(data + CODES_AT)) + NUM_LETTERS * 8 <= blobSize
+			&& std::uint64_t(readU32(data + TABLE_AT)) + (std::uint64_t(2) << tableBits) <= blobSize
+			&& std::uint64_t(readU32(data + TREE_AT)) + 4 * treeNodes <= blobSize
+			&& readU32(data + CHECKSUM_AT) == checksum(data + HEADER_SIZE, static_cast<std::size_t>(blobSize - HEADER_SIZE));
+
+	} // end if
+
+	// the checksum only catches accidents, the decoder trusts the body, so check all of it
+	if (valid) {
+
+		const unsigned char* codes = data + readU32(data + CODES_AT);
+		const unsigned char* table = data + readU32(data + TABLE_AT);
+		const unsigned char* tree = data + readU32(data + TREE_AT);
+		const std::uint32_t tableBits = readU32(data + TABLE_BITS_AT);
+		const std::uint32_t treeNodes = readU32(data + TREE_NODES_AT);
+
+		// a leaf root would decode a letter from no bits at all
+		valid = readU16(tree) != LEAF_MARK;
+
+		for (std::uint32_t node = 0; valid && node < treeNodes; ++node) {
+
+			const std::uint16_t left = readU16(tree + node * 4);
+			const std::uint16_t right = readU16(tree + node * 4 + 2);
+			valid = (left == LEAF_MARK) ? (right >= 'a' && right <= 'z') : (left < treeNodes && right < treeNodes);
+
+		} // end for
+
+		// every code fits its length and leads through the tree to its own leaf, and no sooner
+		for (int i = 0; valid && i < NUM_LETTERS; ++i) {
+
+			const std::uint32_t bits = readU32(codes + i * 8);
+			const std::uint32_t length = readU32(codes + i * 8 + 4);
+			valid = length >= 1 && length <= 32 && (length == 32 || (bits >> length) == 0);
+
+			std::uint16_t node = 0;
+			for (std::uint32_t depth = 0; valid && depth < length; ++depth) {
+
+				valid = readU16(tree + node * 4) != LEAF_MARK;
+				if (valid) {
+					node = readU16(tree + node * 4 + 2 * ((bits >> (length - 1 - depth)) & 1));
+				} // end if
+
+			} // end for
+
+			valid = valid && readU16(tree + node * 4) == LEAF_MARK && readU16(tree + node * 4 + 2) == 'a' + i;
+
+		} // end for
+
+		// a table entry holds the letter whose code starts its index, with that code's length
+		for (std::uint32_t entry = 0; valid && entry < (1u << tableBits); ++entry) {
+
+			const std::uint16_t value = readU16(table + entry * 2);
+			const std::uint32_t length = value >> 8;
+			const int letter = (value & 0xFF) - 'a';
+
+			valid = length == 0 || (length <= tableBits && letter >= 0 && letter < NUM_LETTERS
+				&& readU32(codes + letter * 8 + 4) == length
+				&& readU32(codes + letter * 8) == (entry >> (tableBits - length)));
+
+		} // end for
+
+	} // end if
+
+	return valid;
+
+} // End of validate
+
+/** use
+@pre None
+@post blob_ and the section views point into data if it is valid
+@parm unsigned char* [data], std::size_t [size]
+@return true if data holds a valid blob*/
+bool CodebookDictionary::use(const unsigned char* data, std::size_t size) {
+
+	bool valid = validate(data, size);
+
+	if (valid) {
+
+		blob_ = data;
+		blobSize_ = readU32(data + SIZE_AT);
+		codes_ = data + readU32(data + CODES_AT);
+		table_ = data + readU32(data + TABLE_AT);
+		tree_ = data + readU32(data + TREE_AT);
+		tableBits_ = static_cast<int>(readU32(data + TABLE_BITS_AT));
+
+	} // end if
+
+	return valid;
+
+} // End of use
+
+/** release
+@pre None
+@post owned blob and mapping released, dictionary empty*/
+void CodebookDictionary::release() {
+
+#ifndef _WIN32
+	if (mapping_ != nullptr) {
+
+		::munmap(mapping_, mappingSize_);
+
+	} // end if
+#endif
+
+	mapping_ = nullptr;
+	mappingSize_ = 0;
+	owned_.clear();
+	blob_ = nullptr;
+	blobSize_ = 0;
+	codes_ = nullptr;
+	table_ = nullptr;
+	tree_ = nullptr;
+	tableBits_ = 0;
+
+} // End of release
+
+/** encode
+@pre isLoaded
+@post all lowercase letters of provided string are encoded
+@parm std::string [in]
+@return packed code of in*/
+PackedCode CodebookDictionary::encode(const std::string& in) const {
+
+	BitWriter writer;
+
+	for (unsigned int i = 0; i < in.size(); ++i) {
+
+		char c = in[i];
+		// only valid char 'a' - 'z'
+		if (c >= 'a' && c <= 'z') {
+
+			const unsigned char* code = codes_ + (c - 'a') * 8;
+			writer.writeBits(readU32(code), static_cast<int>(readU32(code + 4)));
+
+		} // end if
+
+	} // end for
+
+	writer.finish();
+
+	PackedCode code;
+	code.bitCount_ = writer.bitCount();
+	writer.swapBytes(code.bytes_);
+
+	return code;
+
+} // End of encode
+
+/** decode
+@pre isLoaded, code was made with this dictionary
+@post None, a trailing incomplete code is ignored
+@parm unsigned char* [bytes], std::uint64_t [bitCount]
+@return text of the code*/
+std::string CodebookDictionary::decode(const unsigned char* bytes, std::uint64_t bitCount) const {
+
+	std::string text{};
+
+	BitReader reader(bytes, bitCount);
+	bool decoding = true;
+
+	while (decoding && reader.remaining() > 0) {
+
+		const std::uint16_t entry = readU16(table_ + 2 * reader.peekBits(tableBits_));
+		const int length = entry >> 8;
+
+		if (length > 0) {
+
+			// short code, one lookup. Bits past the end peek as 0, so check the length
+			decoding = static_cast<std::uint64_t>(length) <= reader.remaining();
+			if (decoding) {
+
+				text += static_cast<char>(entry & 0xFF);
+				reader.skipBits(length);
+
+			} // end if
+
+		}
+		else {
+
+			char letter = '\0';
+			decoding = walkTree(reader, letter);
+			if (decoding) {
+
+				text += letter;
+
+			} // end if
+
+		} // end if
+
+	} // end while
+
+	return text;
+
+} // End of decode
+
+/** decode
+@pre isLoaded, code was made with this dictionary
+@parm PackedCode [code]
+@return text of the code*/
+std::string CodebookDictionary::decode(const PackedCode& code) const {
+
+	return decode(code.bytes_.data(), code.bitCount_);
+
+} // End of decode
+
+/** walkTree
+@pre reader at the start of a code longer than the table
+@post reader moved past the code if it is complete
+@parm BitReader [reader], char [letter] passed by reference
+@return true if a letter was decoded from at least one bit*/
+bool CodebookDictionary::walkTree(BitReader& reader, char& letter) const {
+
+	BitReader lookAhead = reader;
+	std::uint16_t node = 0;
+	std::uint64_t steps = 0;
+
+	while (readU16(tree_ + node * 4) != LEAF_MARK && lookAhead.remaining() > 0) {
+
+		node = readU16(tree_ + node * 4 + 2 * lookAhead.readBit());
+		++steps;
+
+	} // end while
+
+	// a letter from no bits would never move the reader, validate rules it out, this is a backstop
+	bool decoded = steps > 0 && readU16(tree_ + node * 4) == LEAF_MARK;
+
+	if (decoded) {
+
+		letter = static_cast<char>(readU16(tree_ + node * 4 + 2));
+		reader = lookAhead;
+
+	} // end if
+
+	return decoded;
+
+} // End of walkTree
+
+/** encodeMessage
+@pre isLoaded
+@post None
+@parm std::string [in]
+@return message: uint32 dictionary ID, uint32 dictionary version, uint64 bit count,
+then the packed code, so the message needs no table of its own*/
+std::vector<unsigned char> CodebookDictionary::encodeMessage(const std::string& in) const {
+
+	PackedCode code = encode(in);
+
+	std::vector<unsigned char> message(DICTIONARY_MESSAGE_HEADER_SIZE + code.bytes_.size());
+	writeU32(message.data(), dictionaryId());
+	writeU32(message.data() + 4, dictionaryVersion());
+	writeU64(message.data() + 8, code.bitCount_);
+
+	if (!code.bytes_.empty()) {
+
+		std::memcpy(message.data() + DICTIONARY_MESSAGE_HEADER_SIZE, code.bytes_.data(), code.bytes_.size());
+
+	} // end if
+
+	return message;
+
+} // End of encodeMessage
+
+/** readMessageHeader
+@pre None
+@post dictionaryId, dictionaryVersion and bitCount read from message
+@parm unsigned char* [message], std::size_t [size], std::uint32_t [dictionaryId],
+std::uint32_t [dictionaryVersion], std::uint64_t [bitCount] passed by reference
+@return true if message is long enough for its header and its code*/
+bool CodebookDictionary::readMessageHeader(const unsigned char* message, std::size_t size, std::uint32_t& dictionaryId,
+	std::uint32_t& dictionaryVersion, std::uint64_t& bitCount) {
+
+	bool valid = size >= static_cast<std::size_t>(DICTIONARY_MESSAGE_HEADER_SIZE);
+
+	if (valid) {
+
+		dictionaryId = readU32(message);
+		dictionaryVersion = readU32(message + 4);
+		bitCount = readU64(message + 8);
+
+		// bitCount <= 8 x payload bytes without the sum wrapping for a hostile bitCount near 2^64
+		const std::uint64_t payloadBytes = size - DICTIONARY_MESSAGE_HEADER_SIZE;
+		valid = (bitCount >> 3) + ((bitCount & 7) != 0 ? 1 : 0) <= payloadBytes;
+
+	} // end if
+
+	return valid;
+
+} // End of readMessageHeader
+
+/** isLoaded
+@return true once a valid blob is in use*/
+bool CodebookDictionary::isLoaded() const {
+
+	return blob_ != nullptr;
+
+} // End of isLoaded
+
+/** dictionaryId
+@return ID of the loaded dictionary*/
+std::uint32_t CodebookDictionary::dictionaryId() const {
+
+	return isLoaded() ? readU32(blob_ + ID_AT) : 0;
+
+} // End of dictionaryId
+
+/** dictionaryVersion
+@return version of the loaded dictionary*/
+std::uint32_t CodebookDictionary::dictionaryVersion() const {
+
+	return isLoaded() ? readU32(blob_ + VERSION_AT) : 0;
+
+} // End of dictionaryVersion
+
+/** blob
+@return start of the blob in use, nullptr if none*/
+const unsigned char* CodebookDictionary::blob() const {
+
+	return blob_;
+
+} // End of blob
+
+/** blobSize
+@return bytes of the blob in use*/
+std::size_t CodebookDictionary::blobSize() const {
+
+	return blobSize_;
+
+} // End of blobSize
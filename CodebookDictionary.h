@@ -0,0 +1,267 @@
+/** @file CodebookDictionary.h
+ @author Anthony Campos
+ @date 10/19/2026
+ This header class file implements a CodebookDictionary, a pre-trained 'a' - 'z' codebook
+ and its decode tables stored in one compact, versioned, position independent binary blob */
+
+	//---------------------------------------------------------------------------
+	// CodebookDictionary class:  persistent Huffman codebook
+	//   included features:
+	//   -- allows for training a blob from a sample text or a HuffmanAlgorithm
+	//   -- allows for loading a blob from a file (memory mapped where available),
+	//			from a std::vector, or attaching to memory owned by the caller
+	//   -- decodes straight from the blob, loading validates the header and
+	//			bounds checks every code, table entry and tree node once
+	//   -- allows for publishing a blob into a named POSIX shared memory segment
+	//			and attaching to it read only, so every process on a host decodes
+	//			from one copy of the tables. Only segments of the expected publisher
+	//			that others cannot write are attached
+	//   -- allows for encoding and decoding messages that carry the dictionary
+	//			ID and version instead of their own table
+	//
+	// Blob layout (little endian, every offset from the start of the blob):
+	//   --  48 byte header: "HUFD", format version, dictionary ID, dictionary
+	//			version, letter count, table bits, codes offset, table offset,
+	//			tree offset, tree node count, blob size, FNV-1a checksum of the
+	//			bytes after the header
+	//   --  codes: NUM_LETTERS x { uint32 code bits, uint32 code length }
+	//   --  table: 2^table bits x uint16 (length << 8 | letter), length 0 when
+	//			the code is longer than the table
+	//   --  tree: node count x { uint16 left, uint16 right }, node 0 is the
+	//			root, a leaf has left 0xFFFF and holds its letter in right
+	//
+	// Assumptions:
+	//   --  only 'a' - 'z' are encoded, other chars are skipped
+	//   --  a published segment is never changed, a new dictionary version is
+	//			published under a new name (see sharedName) and the old name unlinked
+	//---------------------------------------------------------------------------
+
+#pragma once
+
+// Included libraries
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// included .h files
+#include "HuffmanAlgorithm.h"
+#include "BitStream.h"
+
+// Current blob format version
+const std::uint32_t DICTIONARY_FORMAT_VERSION = 1;
+
+// publisherUid of attachShared that trusts segments owned by this process's effective user
+const long SHARED_OWNER_SELF = -1;
+
+// Bytes of the message header written by encodeMessage
+const int DICTIONARY_MESSAGE_HEADER_SIZE = 16;
+
+
+class CodebookDictionary {
+
+public:
+
+	/** Constructors & Destructor */
+
+	/** Defualt Constructor
+	@pre None
+	@post Empty CodebookDictionary Object created, isLoaded is false*/
+	CodebookDictionary();
+
+	/** Copy Constructor & Assignment disabled, the object may own a memory mapping */
+	CodebookDictionary(const CodebookDictionary& sourceDictionary) = delete;
+	CodebookDictionary& operator=(const CodebookDictionary& rhsDictionary) = delete;
+
+	/** Destructor
+	@pre None
+	@post blob memory or mapping released*/
+	~CodebookDictionary();
+
+	/** Public Methods */
+
+	/** serialize
+	@pre None
+	@post None
+	@parm HuffmanAlgorithm [codec], std::uint32_t [dictionaryId], std::uint32_t [dictionaryVersion]
+	@return blob holding the codebook and decode tables of codec*/
+	static std::vector<unsigned char> serialize(const HuffmanAlgorithm& codec,
+		std::uint32_t dictionaryId, std::uint32_t dictionaryVersion);
+
+	/** train
+	@pre None
+	@post None
+	@parm std::string [sample] text whose letter counts train the codebook,
+	std::uint32_t [dictionaryId], std::uint32_t [dictionaryVersion]
+	@return blob of the trained codebook*/
+	static std::vector<unsigned char> train(const std::string& sample,
+		std::uint32_t dictionaryId, std::uint32_t dictionaryVersion);
+
+	/** save
+	@pre None
+	@post blob written to path
+	@parm std::vector<unsigned char> [blob], std::string [path]
+	@return true if the file could be written*/
+	static bool save(const std::vector<unsigned char>& blob, const std::string& path);
+
+	/** load maps (or reads) a blob file
+	@pre None
+	@post dictionary uses the blob of path, any previous blob released
+	@parm std::string [path]
+	@return true if the file holds a valid blob*/
+	bool load(const std::string& path);
+
+	/** assign takes over a blob
+	@pre None
+	@post dictionary owns and uses blob, any previous blob released
+	@parm std::vector<unsigned char> [blob]
+	@return true if blob is valid*/
+	bool assign(std::vector<unsigned char> blob);
+
+	/** attach uses memory the caller owns
+	@pre data stays valid and unchanged while attached
+	@post dictionary decodes straight from data, any previous blob released
+	@parm unsigned char* [data], std::size_t [size]
+	@return true if data holds a valid blob*/
+	bool attach(const unsigned char* data, std::size_t size);
+
+	/** sharedName
+	@pre None
+	@post None
+	@parm std::uint32_t [dictionaryId], std::uint32_t [dictionaryVersion]
+	@return shared memory segment name for that dictionary version, "/huffman-dictionary-ID-VERSION"*/
+	static std::string sharedName(std::uint32_t dictionaryId, std::uint32_t dictionaryVersion);
+
+	/** publishShared copies a blob into a new named shared memory segment
+	@pre name starts with '/' and holds no other '/'
+	@post segment name created (readable by every user), holding blob. The segment outlives
+	the process until unlinkShared
+	@parm std::vector<unsigned char> [blob], std::string [name]
+	@return true if blob is valid and the segment was created, false if name already exists
+	or shared memory is not available*/
+	static bool publishShared(const std::vector<unsigned char>& blob, const std::string& name);
+
+	/** attachShared maps a published segment read only
+	@pre None
+	@post dictionary decodes straight from the segment, any previous blob released
+	@parm std::string [name], long [publisherUid] user the segment must belong to,
+	SHARED_OWNER_SELF for the effective user of this process
+	@return true if the segment exists, belongs to publisherUid, is not writable by its
+	group or others, and holds a valid blob. A segment still being published fails the
+	checksum, so the caller can retry*/
+	bool attachShared(const std::string& name, long publisherUid = SHARED_OWNER_SELF);
+
+	/** unlinkShared removes a segment name
+	@pre None
+	@post name removed, processes attached to it keep their mapping until they release it
+	@parm std::string [name]
+	@return true if the name existed and was removed*/
+	static bool unlinkShared(const std::string& name);
+
+	/** encode
+	@pre isLoaded
+	@post all lowercase letters of provided string are encoded
+	@parm std::string [in]
+	@return packed code of in*/
+	PackedCode encode(const std::string& in) const;
+
+	/** decode
+	@pre isLoaded, code was made with this dictionary
+	@post None, a trailing incomplete code is ignored
+	@parm unsigned char* [bytes], std::uint64_t [bitCount]
+	@return text of the code*/
+	std::string decode(const unsigned char* bytes, std::uint64_t bitCount) const;
+
+	/** decode
+	@pre isLoaded, code was made with this dictionary
+	@parm PackedCode [code]
+	@return text of the code*/
+	std::string decode(const PackedCode& code) const;
+
+	/** encodeMessage
+	@pre isLoaded
+	@post None
+	@parm std::string [in]
+	@return message: uint32 dictionary ID, uint32 dictionary version, uint64 bit count,
+	then the packed code, so the message needs no table of its own*/
+	std::vector<unsigned char> encodeMessage(const std::string& in) const;
+
+	/** readMessageHeader
+	@pre None
+	@post dictionaryId, dictionaryVersion and bitCount read from message
+	@parm unsigned char* [message], std::size_t [size], std::uint32_t [dictionaryId],
+	std::uint32_t [dictionaryVersion], std::uint64_t [bitCount] passed by reference
+	@return true if message is long enough for its header and its code*/
+	static bool readMessageHeader(const unsigned char* message, std::size_t size, std::uint32_t& dictionaryId,
+		std::uint32_t& dictionaryVersion, std::uint64_t& bitCount);
+
+	/** Accessor Methods */
+
+	/** isLoaded
+	@return true once a valid blob is in use*/
+	bool isLoaded() const;
+
+	/** dictionaryId
+	@return ID of the loaded dictionary*/
+	std::uint32_t dictionaryId() const;
+
+	/** dictionaryVersion
+	@return version of the loaded dictionary*/
+	std::uint32_t dictionaryVersion() const;
+
+	/** blob
+	@return start of the blob in use, nullptr if none*/
+	const unsigned char* blob() const;
+
+	/** blobSize
+	@return bytes of the blob in use*/
+	std::size_t blobSize() const;
+
+	/** validate
+	@pre None
+	@post None
+	@parm unsigned char* [data], std::size_t [size]
+	@return true if data holds a complete blob of a known format with a matching checksum,
+	every section inside the blob, every code, table entry and tree node in range, and
+	the codes, table and tree agreeing with each other*/
+	static bool validate(const unsigned char* data, std::size_t size);
+
+private:
+
+	/** Private Attributes */
+
+	std::vector<unsigned char> owned_; // blob owned by assign, or read by load
+	void* mapping_; // blob mapped by load or attachShared
+	std::size_t mappingSize_;
+
+	const unsigned char* blob_; // blob in use
+	std::size_t blobSize_;
+
+	// views into blob_, set by use
+	const unsigned char* codes_;
+	const unsigned char* table_;
+	const unsigned char* tree_;
+	int tableBits_;
+
+	/** Private Methods */
+
+	/** use
+	@pre None
+	@post blob_ and the section views point into data if it is valid
+	@parm unsigned char* [data], std::size_t [size]
+	@return true if data holds a valid blob*/
+	bool use(const unsigned char* data, std::size_t size);
+
+	/** release
+	@pre None
+	@post owned blob and mapping released, dictionary empty*/
+	void release();
+
+	/** walkTree
+	@pre reader at the start of a code longer than the table
+	@post reader moved past the code if it is complete
+	@parm BitReader [reader], char [letter] passed by reference
+	@return true if a letter was decoded from at least one bit*/
+	bool walkTree(BitReader& reader, char& letter) const;
+
+}; // End of CodebookDictionary
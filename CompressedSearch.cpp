@@ -0,0 +1,272 @@
+/** @file CompressedSearch.cpp
+ @author Anthony Campos
+ @date 10/19/2026
+ This implementation file implements a CompressedSearch, which finds a pattern in the packed code
+ of a HuffmanAlgorithm without decoding it to text first */
+
+//---------------------------------------------------------------------------
+// CompressedSearch class:  pattern search over packed Huffman code
+//   included features:
+//   -- one automaton tracks both the position in the code tree and the
+//			Knuth-Morris-Pratt state of the pattern, so a match is only
+//			reported where the pattern's codes start on a code boundary.
+//			Bit strings that equal the encoded pattern but straddle other
+//			codes are never matched
+//   -- the automaton steps a whole byte per table lookup, each entry holds
+//			the next state, the letters completed in the byte and a mask of
+//			the letters that completed a match
+//   -- patterns longer than MAX_BYTE_TABLE_PATTERN step one bit at a time
+//			instead, to keep the table small
+//   -- allows for finding every (overlapping) match, counting, or stopping
+//			at the first match
+//
+// Assumptions:
+//   --  code was made by HuffmanAlgorithm::encode (or getWord and packAscii)
+//			with the codebook the search was built from
+//   --  like encode, chars of the pattern other than 'a' - 'z' are skipped
+//---------------------------------------------------------------------------
+
+
+// included .h files
+#include "CompressedSearch.h"
+
+
+/** Constructor
+@pre None
+@post CompressedSearch Object created for the lowercase letters of pattern and the codebook of codec
+@parm HuffmanAlgorithm [codec], std::string [pattern]*/
+CompressedSearch::CompressedSearch(const HuffmanAlgorithm& codec, const std::string& pattern)
+	:states_(0) {
+
+	for (unsigned int i = 0; i < pattern.size(); ++i) {
+
+		// only valid char 'a' - 'z'
+		if (pattern[i] >= 'a' && pattern[i] <= 'z') {
+			pattern_ += pattern[i];
+		} // end if
+
+	} // end for
+
+	// code tree as internal nodes, node 0 is the root
+	codec.branches(children_);
+
+	// Knuth-Morris-Pratt automaton over the letters, position m continues past a match
+	const int m = static_cast<int>(pattern_.size());
+	kmp_.assign((m + 1) * NUM_LETTERS, 0);
+
+	if (m > 0) {
+
+		kmp_[pattern_[0] - 'a'] = 1;
+		int fallback = 0;
+
+		for (int j = 1; j <= m; ++j) {
+
+			for (int c = 0; c < NUM_LETTERS; ++c) {
+
+				kmp_[j * NUM_LETTERS + c] = kmp_[fallback * NUM_LETTERS + c];
+
+			} // end for
+
+			if (j < m) {
+
+				kmp_[j * NUM_LETTERS + (pattern_[j] - 'a')] = j + 1;
+				fallback = kmp_[fallback * NUM_LETTERS + (pattern_[j] - 'a')];
+
+			} // end if
+
+		} // end for
+
+	} // end if
+
+	states_ = static_cast<int>(children_[0].size()) * (m + 1);
+
+	if (m > 0 && m <= MAX_BYTE_TABLE_PATTERN) {
+
+		byteTable_.resize(static_cast<std::size_t>(states_) * 256);
+
+		for (int state = 0; state < states_; ++state) {
+
+			for (int byte = 0; byte < 256; ++byte) {
+
+				ByteStep& step = byteTable_[static_cast<std::size_t>(state) * 256 + byte];
+				int current = state;
+
+				for (int bit = 7; bit >= 0; --bit) {
+
+					bool letterDone = false;
+					bool matched = stepBit(current, (byte >> bit) & 1, letterDone);
+
+					if (matched) {
+						step.matches_ |= static_cast<unsigned char>(1u << step.letters_);
+					} // end if
+
+					if (letterDone) {
+						++step.letters_;
+					} // end if
+
+				} // end for
+
+				step.next_ = static_cast<std::uint32_t>(current);
+
+			} // end for
+
+		} // end for
+
+	} // end if
+
+} // End of Constructor
+
+/** stepBit
+@pre None
+@post state moved by one bit, letterDone set if the bit completed a letter
+@parm int [state] passed by reference, int [bit], bool [letterDone] passed by reference
+@return true if the bit completed a match*/
+bool CompressedSearch::stepBit(int& state, int bit, bool& letterDone) const {
+
+	const int positions = static_cast<int>(pattern_.size()) + 1;
+	const int node = state / positions;
+	int position = state % positions;
+
+	const int child = children_[bit][node];
+	bool matched = false;
+	letterDone = child < 0;
+
+	if (letterDone) {
+
+		position = kmp_[position * NUM_LETTERS + (-1 - child)];
+		matched = position == static_cast<int>(pattern_.size());
+		state = position;
+
+	}
+	else {
+
+		state = child * positions + position;
+
+	} // end if
+
+	return matched;
+
+} // End of stepBit
+
+/** scan
+@pre None
+@post matches appended to starts unless starts is nullptr
+@parm PackedCode [code], std::vector<std::uint64_t> [starts] may be nullptr,
+bool [stopAtFirst]
+@return number of matches found*/
+long long CompressedSearch::scan(const PackedCode& code, std::vector<std::uint64_t>* starts, bool stopAtFirst) const {
+
+	long long found = 0;
+
+	if (!pattern_.empty()) {
+
+		const std::uint64_t m = pattern_.size();
+		const std::uint64_t fullBytes = byteTable_.empty() ? 0 : code.bitCount_ / 8;
+
+		std::uint64_t letters = 0;
+		std::uint32_t state = 0;
+
+		// whole bytes, one lookup each
+		for (std::uint64_t i = 0; i < fullBytes && !(stopAtFirst && found > 0); ++i) {
+
+			const ByteStep& step = byteTable_[static_cast<std::size_t>(state) * 256 + code.bytes_[i]];
+
+			unsigned int matches = step.matches_;
+			while (matches != 0) {
+
+				int k = 0;
+				while (((matches >> k) & 1) == 0) {
+					++k;
+				} // end while
+
+				matches &= matches - 1;
+				++found;
+
+				if (starts != nullptr) {
+					starts->push_back(letters + k + 1 - m);
+				} // end if
+
+			} // end while
+
+			letters += step.letters_;
+			state = step.next_;
+
+		} // end for
+
+		// the rest (the last partial byte, or everything for long patterns), a bit at a time
+		int bitState = static_cast<int>(state);
+		for (std::uint64_t bit = fullBytes * 8; bit < code.bitCount_ && !(stopAtFirst && found > 0); ++bit) {
+
+			bool letterDone = false;
+			int value = (code.bytes_[bit / 8] >> (7 - bit % 8)) & 1;
+
+			if (stepBit(bitState, value, letterDone)) {
+
+				++found;
+				if (starts != nullptr) {
+					starts->push_back(letters + 1 - m);
+				} // end if
+
+			} // end if
+
+			if (letterDone) {
+				++letters;
+			} // end if
+
+		} // end for
+
+	} // end if
+
+	return found;
+
+} // End of scan
+
+/** findAll
+@pre code was made with the codebook of the search
+@post None
+@parm PackedCode [code]
+@return letter index (in the decoded text) of the start of every match, in order*/
+std::vector<std::uint64_t> CompressedSearch::findAll(const PackedCode& code) const {
+
+	std::vector<std::uint64_t> starts;
+	scan(code, &starts, false);
+
+	return starts;
+
+} // End of findAll
+
+/** count
+@pre code was made with the codebook of the search
+@parm PackedCode [code]
+@return number of matches, overlapping ones included*/
+long long CompressedSearch::count(const PackedCode& code) const {
+
+	return scan(code, nullptr, false);
+
+} // End of count
+
+/** contains
+@pre code was made with the codebook of the search
+@parm PackedCode [code]
+@return true if there is a match, the scan stops at the first one*/
+bool CompressedSearch::contains(const PackedCode& code) const {
+
+	return scan(code, nullptr, true) > 0;
+
+} // End of contains
+
+/** patternLength
+@return number of letters in the pattern*/
+int CompressedSearch::patternLength() const {
+
+	return static_cast<int>(pattern_.size());
+
+} // End of patternLength
+
+/** usesByteTable
+@return true if the search steps a byte per lookup, false if it steps a bit*/
+bool CompressedSearch::usesByteTable() const {
+
+	return !byteTable_.empty();
+
+} // End of usesByteTable
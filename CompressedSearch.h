@@ -0,0 +1,127 @@
+/** @file CompressedSearch.h
+ @author Anthony Campos
+ @date 10/19/2026
+ This header class file implements a CompressedSearch, which finds a pattern in the packed code
+ of a HuffmanAlgorithm without decoding it to text first */
+
+	//---------------------------------------------------------------------------
+	// CompressedSearch class:  pattern search over packed Huffman code
+	//   included features:
+	//   -- one automaton tracks both the position in the code tree and the
+	//			Knuth-Morris-Pratt state of the pattern, so a match is only
+	//			reported where the pattern's codes start on a code boundary.
+	//			Bit strings that equal the encoded pattern but straddle other
+	//			codes are never matched
+	//   -- the automaton steps a whole byte per table lookup, each entry holds
+	//			the next state, the letters completed in the byte and a mask of
+	//			the letters that completed a match
+	//   -- patterns longer than MAX_BYTE_TABLE_PATTERN step one bit at a time
+	//			instead, to keep the table small
+	//   -- allows for finding every (overlapping) match, counting, or stopping
+	//			at the first match
+	//
+	// Assumptions:
+	//   --  code was made by HuffmanAlgorithm::encode (or getWord and packAscii)
+	//			with the codebook the search was built from
+	//   --  like encode, chars of the pattern other than 'a' - 'z' are skipped
+	//---------------------------------------------------------------------------
+
+#pragma once
+
+// Included libraries
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// included .h files
+#include "HuffmanAlgorithm.h"
+#include "BitStream.h"
+
+// Longest pattern searched with the byte table, which takes 2 KiB per
+// (code tree node, pattern position) pair
+const int MAX_BYTE_TABLE_PATTERN = 64;
+
+
+class CompressedSearch {
+
+public:
+
+	/** Constructors */
+
+	/** Constructor
+	@pre None
+	@post CompressedSearch Object created for the lowercase letters of pattern and the codebook of codec
+	@parm HuffmanAlgorithm [codec], std::string [pattern]*/
+	CompressedSearch(const HuffmanAlgorithm& codec, const std::string& pattern);
+
+	/** Public Methods */
+
+	/** findAll
+	@pre code was made with the codebook of the search
+	@post None
+	@parm PackedCode [code]
+	@return letter index (in the decoded text) of the start of every match, in order*/
+	std::vector<std::uint64_t> findAll(const PackedCode& code) const;
+
+	/** count
+	@pre code was made with the codebook of the search
+	@parm PackedCode [code]
+	@return number of matches, overlapping ones included*/
+	long long count(const PackedCode& code) const;
+
+	/** contains
+	@pre code was made with the codebook of the search
+	@parm PackedCode [code]
+	@return true if there is a match, the scan stops at the first one*/
+	bool contains(const PackedCode& code) const;
+
+	/** Accessor Methods */
+
+	/** patternLength
+	@return number of letters in the pattern*/
+	int patternLength() const;
+
+	/** usesByteTable
+	@return true if the search steps a byte per lookup, false if it steps a bit*/
+	bool usesByteTable() const;
+
+private:
+
+	// byte table entry
+	struct ByteStep {
+
+		std::uint32_t next_ = 0; // state after the byte
+		unsigned char letters_ = 0; // letters completed in the byte
+		unsigned char matches_ = 0; // bit k set if letter k of the byte completed a match
+
+	}; // end of ByteStep
+
+	/** Private Attributes */
+
+	std::string pattern_; // lowercase letters of the pattern
+	int states_; // internal tree nodes x (pattern length + 1)
+
+	// code tree, child >= 0 is an internal node, child < 0 is the leaf of letter -1 - child
+	std::vector<int> children_[2];
+
+	std::vector<int> kmp_; // (pattern position, letter) -> next pattern position
+	std::vector<ByteStep> byteTable_; // (state, byte) -> step, empty for long patterns
+
+	/** Private Methods */
+
+	/** stepBit
+	@pre None
+	@post state moved by one bit, letterDone set if the bit completed a letter
+	@parm int [state] passed by reference, int [bit], bool [letterDone] passed by reference
+	@return true if the bit completed a match*/
+	bool stepBit(int& state, int bit, bool& letterDone) const;
+
+	/** scan
+	@pre None
+	@post matches appended to starts unless starts is nullptr
+	@parm PackedCode [code], std::vector<std::uint64_t> [starts] may be nullptr,
+	bool [stopAtFirst]
+	@return number of matches found*/
+	long long scan(const PackedCode& code, std::vector<std::uint64_t>* starts, bool stopAtFirst) const;
+
+}; // End of CompressedSearch
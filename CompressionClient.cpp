@@ -0,0 +1,257 @@
+/** @file CompressionClient.cpp
+ @author Anthony Campos
+ @date 10/19/2026
+ This implementation file implements a CompressionClient, the client side of the
+ CompressionDaemon protocol */
+
+//---------------------------------------------------------------------------
+// CompressionClient class:  CompressionDaemon connection
+//   included features:
+//   -- connects to a daemon's Unix domain socket
+//   -- allows for encoding text with the current version of a dictionary,
+//			decoding a message, and reading the daemon's counters
+//   -- one request in flight at a time, each call sends a frame and waits
+//			for the response with the same request ID. Frame buffers are
+//			kept across calls
+//
+// Assumptions:
+//   --  POSIX only, the implementation is compiled out on Windows
+//   --  one thread uses a client at a time, give each thread its own
+//   --  a failed send or receive closes the connection
+//---------------------------------------------------------------------------
+
+
+// included .h files
+#include "CompressionClient.h"
+#include "ByteOrder.h"
+
+#ifndef _WIN32
+
+// Included libraries
+#include <cerrno>
+#include <cstring>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+
+/** Defualt Constructor
+@pre None
+@post CompressionClient Object created, not connected*/
+CompressionClient::CompressionClient()
+	:fd_(-1), nextRequestId_(1), lastStatus_(DAEMON_OK)
+{} // End of Constructor
+
+/** Destructor
+@pre None
+@post connection closed*/
+CompressionClient::~CompressionClient() {
+
+	close();
+
+} // End of Destructor
+
+/** connect
+@pre None
+@post connected to the daemon listening on socketPath, any previous connection closed
+@parm std::string [socketPath]
+@return true if connected*/
+bool CompressionClient::connect(const std::string& socketPath) {
+
+	close();
+
+	sockaddr_un address;
+	std::memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+
+	bool connected = !socketPath.empty() && socketPath.size() < sizeof(address.sun_path);
+
+	if (connected) {
+
+		std::memcpy(address.sun_path, socketPath.c_str(), socketPath.size());
+
+		fd_ = ::socket(AF_UNIX, SOCK_STREAM, 0);
+		connected = fd_ >= 0 && ::connect(fd_, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0;
+
+#ifdef SO_NOSIGPIPE
+		int on = 1;
+		connected = connected && ::setsockopt(fd_, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on)) == 0;
+#endif
+
+	} // end if
+
+	if (!connected) {
+		close();
+	} // end if
+
+	return connected;
+
+} // End of connect
+
+/** close
+@pre None
+@post connection closed*/
+void CompressionClient::close() {
+
+	if (fd_ >= 0) {
+		::close(fd_);
+	} // end if
+
+	fd_ = -1;
+
+} // End of close
+
+/** encode
+@pre connected
+@post None
+@parm std::uint32_t [dictionaryId], std::string [text], std::vector<unsigned char> [message]
+passed by reference
+@return true if the daemon encoded text, message then holds a CodebookDictionary message*/
+bool CompressionClient::encode(std::uint32_t dictionaryId, const std::string& text, std::vector<unsigned char>& message) {
+
+	bool encoded = call(DAEMON_ENCODE, dictionaryId, reinterpret_cast<const unsigned char*>(text.data()), text.size());
+
+	if (encoded) {
+		message.assign(response_.begin(), response_.end());
+	} // end if
+
+	return encoded;
+
+} // End of encode
+
+/** decode
+@pre connected
+@post None
+@parm std::vector<unsigned char> [message], std::string [text] passed by reference
+@return true if the daemon decoded message*/
+bool CompressionClient::decode(const std::vector<unsigned char>& message, std::string& text) {
+
+	bool decoded = call(DAEMON_DECODE, 0, message.data(), message.size());
+
+	if (decoded) {
+		text.assign(response_.begin(), response_.end());
+	} // end if
+
+	return decoded;
+
+} // End of decode
+
+/** stats
+@pre connected
+@post None
+@parm DaemonStats [stats] passed by reference
+@return true if the daemon sent its counters*/
+bool CompressionClient::stats(DaemonStats& stats) {
+
+	bool received = call(DAEMON_STATS, 0, nullptr, 0) && response_.size() >= 9 * 8;
+
+	if (received) {
+
+		const unsigned char* at = response_.data();
+		stats.requests_ = loadUint(at, 8);
+		stats.batches_ = loadUint(at + 8, 8);
+		stats.errors_ = loadUint(at + 16, 8);
+		stats.bytesIn_ = loadUint(at + 24, 8);
+		stats.bytesOut_ = loadUint(at + 32, 8);
+		stats.connections_ = loadUint(at + 40, 8);
+		stats.p50Micros_ = loadUint(at + 48, 8);
+		stats.p99Micros_ = loadUint(at + 56, 8);
+		stats.maxMicros_ = loadUint(at + 64, 8);
+
+	} // end if
+
+	return received;
+
+} // End of stats
+
+/** call
+@pre None
+@post request sent and its response read, lastStatus_ and response_ set
+@parm unsigned char [op], std::uint32_t [dictionaryId], unsigned char* [payload], std::size_t [size]
+@return true if a response came back with status DAEMON_OK*/
+bool CompressionClient::call(unsigned char op, std::uint32_t dictionaryId, const unsigned char* payload, std::size_t size) {
+
+	const std::uint32_t requestId = nextRequestId_++;
+	bool good = fd_ >= 0 && size <= MAX_DAEMON_FRAME - (DAEMON_FRAME_HEADER - 4);
+
+	if (good) {
+
+		frame_.clear();
+		CompressionDaemon::appendFrame(frame_, op, requestId, dictionaryId, payload, size);
+		good = CompressionDaemon::sendAll(fd_, frame_.data(), frame_.size());
+
+	} // end if
+
+	unsigned char header[DAEMON_FRAME_HEADER];
+	std::uint32_t length = 0;
+
+	if (good) {
+
+		good = receiveAll(header, DAEMON_FRAME_HEADER);
+		length = static_cast<std::uint32_t>(loadUint(header, 4));
+		good = good && length >= DAEMON_FRAME_HEADER - 4 && length <= MAX_DAEMON_FRAME
+			&& loadUint(header + 5, 4) == requestId;
+
+	} // end if
+
+	if (good) {
+
+		response_.resize(length - (DAEMON_FRAME_HEADER - 4));
+		good = response_.empty() || receiveAll(response_.data(), response_.size());
+		lastStatus_ = header[4];
+
+	} // end if
+
+	if (!good) {
+		close();
+	} // end if
+
+	return good && lastStatus_ == DAEMON_OK;
+
+} // End of call
+
+/** receiveAll
+@pre connected
+@post size bytes read into data, interrupted and short reads retried
+@parm unsigned char* [data], std::size_t [size]
+@return true if every byte arrived*/
+bool CompressionClient::receiveAll(unsigned char* data, std::size_t size) {
+
+	std::size_t received = 0;
+	bool good = true;
+
+	while (good && received < size) {
+
+		const ssize_t count = ::recv(fd_, data + received, size - received, 0);
+
+		if (count > 0) {
+			received += static_cast<std::size_t>(count);
+		}
+		else {
+			good = count < 0 && errno == EINTR;
+		} // end if
+
+	} // end while
+
+	return good;
+
+} // End of receiveAll
+
+/** isConnected
+@return true while connected*/
+bool CompressionClient::isConnected() const {
+
+	return fd_ >= 0;
+
+} // End of isConnected
+
+/** lastStatus
+@return DaemonStatus of the last response*/
+unsigned char CompressionClient::lastStatus() const {
+
+	return lastStatus_;
+
+} // End of lastStatus
+
+#endif
@@ -0,0 +1,126 @@
+/** @file CompressionClient.h
+ @author Anthony Campos
+ @date 10/19/2026
+ This header class file implements a CompressionClient, the client side of the
+ CompressionDaemon protocol */
+
+	//---------------------------------------------------------------------------
+	// CompressionClient class:  CompressionDaemon connection
+	//   included features:
+	//   -- connects to a daemon's Unix domain socket
+	//   -- allows for encoding text with the current version of a dictionary,
+	//			decoding a message, and reading the daemon's counters
+	//   -- one request in flight at a time, each call sends a frame and waits
+	//			for the response with the same request ID. Frame buffers are
+	//			kept across calls
+	//
+	// Assumptions:
+	//   --  POSIX only, the implementation is compiled out on Windows
+	//   --  one thread uses a client at a time, give each thread its own
+	//   --  a failed send or receive closes the connection
+	//---------------------------------------------------------------------------
+
+#pragma once
+
+// Included libraries
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// included .h files
+#include "CompressionDaemon.h"
+
+
+class CompressionClient {
+
+public:
+
+	/** Constructors & Destructor */
+
+	/** Defualt Constructor
+	@pre None
+	@post CompressionClient Object created, not connected*/
+	CompressionClient();
+
+	/** Copy Constructor & Assignment disabled, the client owns its socket */
+	CompressionClient(const CompressionClient& sourceClient) = delete;
+	CompressionClient& operator=(const CompressionClient& rhsClient) = delete;
+
+	/** Destructor
+	@pre None
+	@post connection closed*/
+	~CompressionClient();
+
+	/** Public Methods */
+
+	/** connect
+	@pre None
+	@post connected to the daemon listening on socketPath, any previous connection closed
+	@parm std::string [socketPath]
+	@return true if connected*/
+	bool connect(const std::string& socketPath);
+
+	/** close
+	@pre None
+	@post connection closed*/
+	void close();
+
+	/** encode
+	@pre connected
+	@post None
+	@parm std::uint32_t [dictionaryId], std::string [text], std::vector<unsigned char> [message]
+	passed by reference
+	@return true if the daemon encoded text, message then holds a CodebookDictionary message*/
+	bool encode(std::uint32_t dictionaryId, const std::string& text, std::vector<unsigned char>& message);
+
+	/** decode
+	@pre connected
+	@post None
+	@parm std::vector<unsigned char> [message], std::string [text] passed by reference
+	@return true if the daemon decoded message*/
+	bool decode(const std::vector<unsigned char>& message, std::string& text);
+
+	/** stats
+	@pre connected
+	@post None
+	@parm DaemonStats [stats] passed by reference
+	@return true if the daemon sent its counters*/
+	bool stats(DaemonStats& stats);
+
+	/** Accessor Methods */
+
+	/** isConnected
+	@return true while connected*/
+	bool isConnected() const;
+
+	/** lastStatus
+	@return DaemonStatus of the last response*/
+	unsigned char lastStatus() const;
+
+private:
+
+	/** Private Attributes */
+	int fd_;
+	std::uint32_t nextRequestId_;
+	unsigned char lastStatus_;
+	std::vector<unsigned char> frame_; // request frame, reused
+	std::vector<unsigned char> response_; // payload of the last response
+
+	/** Private Methods */
+
+	/** call
+	@pre None
+	@post request sent and its response read, lastStatus_ and response_ set
+	@parm unsigned char [op], std::uint32_t [dictionaryId], unsigned char* [payload], std::size_t [size]
+	@return true if a response came back with status DAEMON_OK*/
+	bool call(unsigned char op, std::uint32_t dictionaryId, const unsigned char* payload, std::size_t size);
+
+	/** receiveAll
+	@pre connected
+	@post size bytes read into data, interrupted and short reads retried
+	@parm unsigned char* [data], std::size_t [size]
+	@return true if every byte arrived*/
+	bool receiveAll(unsigned char* data, std::size_t size);
+
+}; // End of CompressionClient
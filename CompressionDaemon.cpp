@@ -0,0 +1,767 @@
+/** @file CompressionDaemon.cpp
+ @author Anthony Campos
+ @date 10/19/2026
+ This implementation file implements a CompressionDaemon, a local server that owns the
+ codebooks of a host and serves encode and decode requests over a Unix domain socket */
+
+//---------------------------------------------------------------------------
+// CompressionDaemon class:  shared codec service
+//   included features:
+//   -- codebooks are CodebookDictionary blobs in a DictionaryRegistry, so
+//			they can be swapped while the daemon runs
+//   -- one I/O thread polls the listening socket and every connection,
+//			reads whole frames and queues the requests of each poll round
+//			in batches of up to MAX_DAEMON_BATCH. Frames are parsed after every
+//			read, and a connection reads a bounded amount per round and never
+//			buffers more than one maximal frame
+//   -- worker threads take a batch at a time, and write the responses for
+//			one connection with a single send
+//   -- counts requests, batches, errors and bytes, and keeps a latency
+//			histogram (receipt of a frame to the send of its response)
+//			for percentiles, also served to clients by DAEMON_STATS
+//
+// Assumptions:
+//   --  POSIX only, the implementation is compiled out on Windows
+//   --  a malformed or oversized frame closes its connection
+//   --  responses of one connection come back in order within a batch, but
+//			two batches may be answered by different workers at once, so
+//			clients with several requests in flight match them by request ID
+//---------------------------------------------------------------------------
+
+
+// included .h files
+#include "CompressionDaemon.h"
+#include "ByteOrder.h"
+
+#ifndef _WIN32
+
+// Included libraries
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+
+	// latency buckets: 1 microsecond wide below LATENCY_LINEAR, then 32 per power of 2
+	const int LATENCY_LINEAR = 64;
+	const int LATENCY_SUB_BITS = 5;
+	const int LATENCY_BUCKETS = LATENCY_LINEAR + (64 - 6) * (1 << LATENCY_SUB_BITS);
+
+	// how long sendAll waits for a peer that stopped reading
+	const int SEND_TIMEOUT_MS = 5000;
+
+	// bytes read from a connection per recv
+	const std::size_t READ_CHUNK = 1 << 16;
+
+	// recv calls per connection per poll round, poll reports the rest next round, so one
+	// busy peer cannot hold the I/O thread
+	const int READS_PER_ROUND = 16;
+
+#ifdef MSG_NOSIGNAL
+	const int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+	const int SEND_FLAGS = 0;
+#endif
+
+	/** latencyBucket
+	@return histogram bucket of a latency in microseconds*/
+	int latencyBucket(std::uint64_t micros) {
+
+		int bucket = static_cast<int>(micros);
+
+		if (micros >= static_cast<std::uint64_t>(LATENCY_LINEAR)) {
+
+			int exponent = 6;
+			while (exponent < 63 && (micros >> (exponent + 1)) != 0) {
+				++exponent;
+			} // end while
+
+			const int sub = static_cast<int>((micros >> (exponent - LATENCY_SUB_BITS)) & ((1 << LATENCY_SUB_BITS) - 1));
+			bucket = LATENCY_LINEAR + (exponent - 6) * (1 << LATENCY_SUB_BITS) + sub;
+
+		} // end if
+
+		return bucket;
+
+	} // End of latencyBucket
+
+	/** bucketMicros
+	@return smallest latency in microseconds of a histogram bucket*/
+	std::uint64_t bucketMicros(int bucket) {
+
+		std::uint64_t micros = static_cast<std::uint64_t>(bucket);
+
+		if (bucket >= LATENCY_LINEAR) {
+
+			const int exponent = (bucket - LATENCY_LINEAR) / (1 << LATENCY_SUB_BITS) + 6;
+			const int sub = (bucket - LATENCY_LINEAR) % (1 << LATENCY_SUB_BITS);
+			micros = static_cast<std::uint64_t>((1 << LATENCY_SUB_BITS) + sub) << (exponent - LATENCY_SUB_BITS);
+
+		} // end if
+
+		return micros;
+
+	} // End of bucketMicros
+
+	/** setNonBlocking
+	@return true if fd was switched to non blocking mode*/
+	bool setNonBlocking(int fd) {
+
+		const int flags = ::fcntl(fd, F_GETFL, 0);
+
+		return flags >= 0 && ::fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+
+	} // End of setNonBlocking
+
+} // end of namespace
+
+
+/** Destructor
+@post fd_ closed*/
+CompressionDaemon::Connection::~Connection() {
+
+	if (fd_ >= 0) {
+		::close(fd_);
+	} // end if
+
+} // End of Destructor
+
+/** Constructor
+@pre workers >= 0
+@post CompressionDaemon Object created, not yet listening
+@parm int [workers] worker threads, 0 for one per core*/
+CompressionDaemon::CompressionDaemon(int workers)
+	:workers_(workers), listenFd_(-1), running_(false), draining_(false),
+	requests_(0), batches_(0), errors_(0), bytesIn_(0), bytesOut_(0), connections_(0), latency_(LATENCY_BUCKETS) {
+
+	if (workers_ <= 0) {
+		workers_ = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+	} // end if
+
+	wakeFds_[0] = -1;
+	wakeFds_[1] = -1;
+
+	for (std::size_t i = 0; i < latency_.size(); ++i) {
+
+		latency_[i].store(0);
+
+	} // end for
+
+} // End of Constructor
+
+/** Destructor
+@pre None
+@post daemon stopped*/
+CompressionDaemon::~CompressionDaemon() {
+
+	stop();
+
+} // End of Destructor
+
+/** start
+@pre not running
+@post listening on socketPath (a stale socket file there is replaced), threads started
+@parm std::string [socketPath]
+@return true if the socket could be bound*/
+bool CompressionDaemon::start(const std::string& socketPath) {
+
+	sockaddr_un address;
+	std::memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+
+	bool started = !running_ && !socketPath.empty() && socketPath.size() < sizeof(address.sun_path);
+
+	if (started) {
+
+		std::memcpy(address.sun_path, socketPath.c_str(), socketPath.size());
+		::unlink(socketPath.c_str());
+
+		listenFd_ = ::socket(AF_UNIX, SOCK_STREAM, 0);
+		started = listenFd_ >= 0
+			&& ::bind(listenFd_, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0
+			&& ::listen(listenFd_, SOMAXCONN) == 0
+			&& setNonBlocking(listenFd_)
+			&& ::pipe(wakeFds_) == 0
+			&& setNonBlocking(wakeFds_[0]);
+
+	} // end if
+
+	if (started) {
+
+		socketPath_ = socketPath;
+		draining_ = false;
+		running_ = true;
+
+		ioThread_ = std::thread(&CompressionDaemon::ioLoop, this);
+		for (int w = 0; w < workers_; ++w) {
+			workerThreads_.emplace_back(&CompressionDaemon::workerLoop, this);
+		} // end for
+
+	}
+	else if (!running_) {
+
+		// undo a partial start
+		if (listenFd_ >= 0) {
+
+			::close(listenFd_);
+			listenFd_ = -1;
+			::unlink(socketPath.c_str());
+
+		} // end if
+
+		for (int i = 0; i < 2; ++i) {
+
+			if (wakeFds_[i] >= 0) {
+				::close(wakeFds_[i]);
+			} // end if
+			wakeFds_[i] = -1;
+
+		} // end for
+
+	} // end if
+
+	return started;
+
+} // End of start
+
+/** stop
+@pre None
+@post threads joined, queued requests answered, connections closed and the socket
+file removed*/
+void CompressionDaemon::stop() {
+
+	if (running_.exchange(false)) {
+
+		// the I/O thread stops first, so nothing is queued after draining_ is set
+		const char wake = 0;
+		while (::write(wakeFds_[1], &wake, 1) < 0 && errno == EINTR) {
+		} // end while
+
+		ioThread_.join();
+
+		{
+			std::lock_guard<std::mutex> lock(queueMutex_);
+			draining_ = true;
+		}
+		queueReady_.notify_all();
+
+		for (std::size_t w = 0; w < workerThreads_.size(); ++w) {
+			workerThreads_[w].join();
+		} // end for
+		workerThreads_.clear();
+
+		::close(listenFd_);
+		::close(wakeFds_[0]);
+		::close(wakeFds_[1]);
+		listenFd_ = -1;
+		wakeFds_[0] = -1;
+		wakeFds_[1] = -1;
+
+		::unlink(socketPath_.c_str());
+
+	} // end if
+
+} // End of stop
+
+/** ioLoop
+@pre started
+@post connections accepted and read, requests queued, until stop*/
+void CompressionDaemon::ioLoop() {
+
+	std::vector<std::shared_ptr<Connection>> connections;
+	std::vector<pollfd> fds;
+	std::vector<Request> requests;
+
+	while (running_) {
+
+		// wake pipe, listening socket, then one entry per connection
+		fds.clear();
+		fds.push_back(pollfd{ wakeFds_[0], POLLIN, 0 });
+		fds.push_back(pollfd{ listenFd_, POLLIN, 0 });
+		for (std::size_t i = 0; i < connections.size(); ++i) {
+			fds.push_back(pollfd{ connections[i]->fd_, POLLIN, 0 });
+		} // end for
+
+		const int ready = ::poll(fds.data(), static_cast<nfds_t>(fds.size()), -1);
+
+		if (ready > 0) {
+
+			if (fds[0].revents != 0) {
+
+				char drain[64];
+				while (::read(wakeFds_[0], drain, sizeof(drain)) > 0) {
+				} // end while
+
+			} // end if
+
+			// every connection of this round is read before any request is queued
+			std::vector<std::shared_ptr<Connection>> kept;
+			kept.reserve(connections.size());
+
+			for (std::size_t i = 0; i < connections.size(); ++i) {
+
+				bool open = true;
+				if (fds[i + 2].revents != 0) {
+					open = readFrames(connections[i], requests);
+				} // end if
+
+				if (open) {
+					kept.push_back(connections[i]);
+				} // end if
+
+			} // end for
+
+			connections.swap(kept);
+
+			if (fds[1].revents != 0) {
+
+				int fd = -1;
+				while ((fd = ::accept(listenFd_, nullptr, nullptr)) >= 0) {
+
+					std::shared_ptr<Connection> connection = std::make_shared<Connection>();
+					connection->fd_ = fd;
+
+#ifdef SO_NOSIGPIPE
+					int on = 1;
+					::setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#endif
+
+					if (setNonBlocking(fd)) {
+						connections.push_back(connection);
+						++connections_;
+					} // end if
+
+				} // end while
+
+			} // end if
+
+			enqueue(requests);
+
+		} // end if
+
+	} // end while
+
+} // End of ioLoop
+
+/** readFrames
+@pre connection is readable
+@post up to READS_PER_ROUND chunks read, every complete frame of connection appended to requests
+@parm std::shared_ptr<Connection> [connection], std::vector<Request> [requests] passed by reference
+@return false if the connection closed or sent a malformed frame*/
+bool CompressionDaemon::readFrames(const std::shared_ptr<Connection>& connection, std::vector<Request>& requests) {
+
+	std::vector<unsigned char>& input = connection->input_;
+	bool open = true;
+	bool reading = true;
+
+	// lengths are checked after every chunk, so input never holds more than one maximal frame
+	for (int reads = 0; open && reading && reads < READS_PER_ROUND; ++reads) {
+
+		const std::size_t used = input.size();
+		input.resize(used + READ_CHUNK);
+
+		const ssize_t received = ::recv(connection->fd_, input.data() + used, READ_CHUNK, 0);
+		input.resize(used + (received > 0 ? static_cast<std::size_t>(received) : 0));
+
+		if (received > 0) {
+
+			open = parseFrames(connection, requests);
+
+		}
+		else if (received == 0) {
+
+			open = false;
+
+		}
+		else {
+
+			// EAGAIN, everything available has been read
+			reading = errno == EINTR;
+			open = errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK;
+			if (reading) {
+				--reads;
+			} // end if
+
+		} // end if
+
+	} // end for
+
+	return open;
+
+} // End of readFrames
+
+/** parseFrames
+@pre None
+@post every complete frame at the start of the connection's input appended to requests and
+removed from the input, an incomplete frame left in place
+@parm std::shared_ptr<Connection> [connection], std::vector<Request> [requests] passed by reference
+@return false if a frame length is malformed or above MAX_DAEMON_FRAME*/
+bool CompressionDaemon::parseFrames(const std::shared_ptr<Connection>& connection, std::vector<Request>& requests) {
+
+	std::vector<unsigned char>& input = connection->input_;
+	const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+	std::size_t offset = 0;
+	bool valid = true;
+	bool framing = true;
+
+	while (framing && input.size() - offset >= 4) {
+
+		const std::uint32_t length = static_cast<std::uint32_t>(loadUint(input.data() + offset, 4));
+
+		if (length < DAEMON_FRAME_HEADER - 4 || length > MAX_DAEMON_FRAME) {
+
+			valid = false;
+			framing = false;
+
+		}
+		else if (input.size() - offset - 4 >= length) {
+
+			const unsigned char* frame = input.data() + offset + 4;
+
+			Request request;
+			request.connection_ = connection;
+			request.op_ = frame[0];
+			request.requestId_ = static_cast<std::uint32_t>(loadUint(frame + 1, 4));
+			request.dictionaryId_ = static_cast<std::uint32_t>(loadUint(frame + 5, 4));
+			request.payload_.assign(frame + 9, frame + length);
+			request.received_ = now;
+			requests.push_back(std::move(request));
+
+			offset += 4 + static_cast<std::size_t>(length);
+			bytesIn_ += 4 + static_cast<std::uint64_t>(length);
+
+		}
+		else {
+
+			framing = false;
+
+		} // end if
+
+	} // end while
+
+	input.erase(input.begin(), input.begin() + offset);
+
+	return valid;
+
+} // End of parseFrames
+
+/** enqueue
+@pre None
+@post requests queued in batches of up to MAX_DAEMON_BATCH, waiting while the queue is full
+@parm std::vector<Request> [requests] passed by reference, emptied*/
+void CompressionDaemon::enqueue(std::vector<Request>& requests) {
+
+	for (std::size_t start = 0; start < requests.size(); start += MAX_DAEMON_BATCH) {
+
+		const std::size_t end = std::min(requests.size(), start + MAX_DAEMON_BATCH);
+		std::vector<Request> batch;
+		batch.reserve(end - start);
+
+		for (std::size_t i = start; i < end; ++i) {
+			batch.push_back(std::move(requests[i]));
+		} // end for
+
+		{
+			std::unique_lock<std::mutex> lock(queueMutex_);
+			queueSpace_.wait(lock, [&]() { return queue_.size() < DAEMON_QUEUE_DEPTH; });
+			queue_.push_back(std::move(batch));
+		}
+		queueReady_.notify_one();
+
+	} // end for
+
+	requests.clear();
+
+} // End of enqueue
+
+/** workerLoop
+@pre started
+@post batches answered until the queue is drained after stop*/
+void CompressionDaemon::workerLoop() {
+
+	std::vector<Request> batch;
+	std::vector<unsigned char> out;
+	bool working = true;
+
+	while (working) {
+
+		{
+			std::unique_lock<std::mutex> lock(queueMutex_);
+			queueReady_.wait(lock, [&]() { return !queue_.empty() || draining_; });
+
+			working = !queue_.empty();
+			if (working) {
+
+				batch = std::move(queue_.front());
+				queue_.pop_front();
+
+			} // end if
+		}
+
+		if (working) {
+
+			queueSpace_.notify_one();
+			++batches_;
+
+			// group by connection, keeping each connection's requests in order
+			std::stable_sort(batch.begin(), batch.end(), [](const Request& lhs, const Request& rhs) {
+				return lhs.connection_.get() < rhs.connection_.get();
+			});
+
+			std::size_t first = 0;
+			while (first < batch.size()) {
+
+				std::size_t last = first;
+				out.clear();
+
+				while (last < batch.size() && batch[last].connection_ == batch[first].connection_) {
+
+					if (answer(batch[last], out) != DAEMON_OK) {
+						++errors_;
+					} // end if
+
+					++last;
+
+				} // end while
+
+				{
+					std::lock_guard<std::mutex> lock(batch[first].connection_->writeMutex_);
+					sendAll(batch[first].connection_->fd_, out.data(), out.size());
+				}
+
+				bytesOut_ += out.size();
+
+				const std::chrono::steady_clock::time_point sent = std::chrono::steady_clock::now();
+				for (std::size_t i = first; i < last; ++i) {
+
+					const std::uint64_t micros = static_cast<std::uint64_t>(
+						std::chrono::duration_cast<std::chrono::microseconds>(sent - batch[i].received_).count());
+					++latency_[latencyBucket(micros)];
+
+				} // end for
+
+				requests_ += last - first;
+				first = last;
+
+			} // end while
+
+			batch.clear();
+
+		} // end if
+
+	} // end while
+
+} // End of workerLoop
+
+/** answer
+@pre None
+@post response frame of request appended to out
+@parm Request [request], std::vector<unsigned char> [out] passed by reference
+@return status of the response*/
+unsigned char CompressionDaemon::answer(const Request& request, std::vector<unsigned char>& out) {
+
+	unsigned char status = DAEMON_OK;
+	std::vector<unsigned char> payload;
+
+	if (request.op_ == DAEMON_ENCODE) {
+
+		const std::string text(request.payload_.begin(), request.payload_.end());
+		if (!registry_.encodeMessage(request.dictionaryId_, text, payload)) {
+			status = DAEMON_UNKNOWN_DICTIONARY;
+		} // end if
+
+	}
+	else if (request.op_ == DAEMON_DECODE) {
+
+		std::string text{};
+		std::uint32_t dictionaryId = 0;
+		std::uint32_t dictionaryVersion = 0;
+		std::uint64_t bitCount = 0;
+
+		if (registry_.decodeMessage(request.payload_.data(), request.payload_.size(), text)) {
+
+			payload.assign(text.begin(), text.end());
+
+		}
+		else {
+
+			// a well formed message whose version is not registered, or not a message at all
+			status = CodebookDictionary::readMessageHeader(request.payload_.data(), request.payload_.size(),
+				dictionaryId, dictionaryVersion, bitCount) ? DAEMON_UNKNOWN_DICTIONARY : DAEMON_BAD_REQUEST;
+
+		} // end if
+
+	}
+	else if (request.op_ == DAEMON_STATS) {
+
+		const DaemonStats counters = stats();
+		appendUint(payload, counters.requests_, 8);
+		appendUint(payload, counters.batches_, 8);
+		appendUint(payload, counters.errors_, 8);
+		appendUint(payload, counters.bytesIn_, 8);
+		appendUint(payload, counters.bytesOut_, 8);
+		appendUint(payload, counters.connections_, 8);
+		appendUint(payload, counters.p50Micros_, 8);
+		appendUint(payload, counters.p99Micros_, 8);
+		appendUint(payload, counters.maxMicros_, 8);
+
+	}
+	else {
+
+		status = DAEMON_BAD_REQUEST;
+
+	} // end if
+
+	if (payload.size() > MAX_DAEMON_FRAME - (DAEMON_FRAME_HEADER - 4)) {
+
+		status = DAEMON_BAD_REQUEST;
+		payload.clear();
+
+	} // end if
+
+	appendFrame(out, status, request.requestId_, request.dictionaryId_, payload.data(), payload.size());
+
+	return status;
+
+} // End of answer
+
+/** appendFrame
+@pre size <= MAX_DAEMON_FRAME - DAEMON_FRAME_HEADER + 4
+@post one frame appended to out, shared with CompressionClient
+@parm std::vector<unsigned char> [out] passed by reference, unsigned char [code] op or status,
+std::uint32_t [requestId], std::uint32_t [dictionaryId], unsigned char* [payload], std::size_t [size]*/
+void CompressionDaemon::appendFrame(std::vector<unsigned char>& out, unsigned char code, std::uint32_t requestId,
+	std::uint32_t dictionaryId, const unsigned char* payload, std::size_t size) {
+
+	appendUint(out, DAEMON_FRAME_HEADER - 4 + size, 4);
+	out.push_back(code);
+	appendUint(out, requestId, 4);
+	appendUint(out, dictionaryId, 4);
+	out.insert(out.end(), payload, payload + size);
+
+} // End of appendFrame
+
+/** sendAll
+@pre fd is a connected socket
+@post size bytes of data sent, interrupted, short and would-block sends are retried.
+A peer that went away reports false rather than raising SIGPIPE
+@parm int [fd], unsigned char* [data], std::size_t [size]
+@return true if every byte was sent*/
+bool CompressionDaemon::sendAll(int fd, const unsigned char* data, std::size_t size) {
+
+	std::size_t sent = 0;
+	bool good = true;
+
+	while (good && sent < size) {
+
+		const ssize_t written = ::send(fd, data + sent, size - sent, SEND_FLAGS);
+
+		if (written > 0) {
+
+			sent += static_cast<std::size_t>(written);
+
+		}
+		else if (written < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+
+			// the peer's buffer is full, wait until it reads or give up on it
+			pollfd writable = { fd, POLLOUT, 0 };
+			good = ::poll(&writable, 1, SEND_TIMEOUT_MS) > 0 || errno == EINTR;
+
+		}
+		else {
+
+			good = written < 0 && errno == EINTR;
+
+		} // end if
+
+	} // end while
+
+	return good;
+
+} // End of sendAll
+
+/** registry
+@pre None
+@post None
+@return the codebooks served, publish and retire may be called while running*/
+DictionaryRegistry& CompressionDaemon::registry() {
+
+	return registry_;
+
+} // End of registry
+
+/** stats
+@return current counters and latency percentiles*/
+DaemonStats CompressionDaemon::stats() const {
+
+	DaemonStats counters;
+	counters.requests_ = requests_;
+	counters.batches_ = batches_;
+	counters.errors_ = errors_;
+	counters.bytesIn_ = bytesIn_;
+	counters.bytesOut_ = bytesOut_;
+	counters.connections_ = connections_;
+
+	// the buckets are read one at a time, so a running daemon gives a close snapshot
+	std::vector<std::uint64_t> counts(latency_.size());
+	std::uint64_t total = 0;
+
+	for (std::size_t i = 0; i < latency_.size(); ++i) {
+
+		counts[i] = latency_[i];
+		total += counts[i];
+
+	} // end for
+
+	const std::uint64_t p50Rank = (total + 1) / 2;
+	const std::uint64_t p99Rank = total - total / 100;
+	std::uint64_t seen = 0;
+
+	for (std::size_t i = 0; i < counts.size(); ++i) {
+
+		if (counts[i] > 0) {
+
+			const std::uint64_t micros = bucketMicros(static_cast<int>(i));
+
+			if (seen < p50Rank && seen + counts[i] >= p50Rank) {
+				counters.p50Micros_ = micros;
+			} // end if
+
+			if (seen < p99Rank && seen + counts[i] >= p99Rank) {
+				counters.p99Micros_ = micros;
+			} // end if
+
+			counters.maxMicros_ = micros;
+			seen += counts[i];
+
+		} // end if
+
+	} // end for
+
+	return counters;
+
+} // End of stats
+
+/** isRunning
+@return true between start and stop*/
+bool CompressionDaemon::isRunning() const {
+
+	return running_;
+
+} // End of isRunning
+
+/** workers
+@return number of worker threads*/
+int CompressionDaemon::workers() const {
+
+	return workers_;
+
+} // End of workers
+
+#endif
@@ -0,0 +1,256 @@
+/** @file CompressionDaemon.h
+ @author Anthony Campos
+ @date 10/19/2026
+ This header class file implements a CompressionDaemon, a local server that owns the
+ codebooks of a host and serves encode and decode requests over a Unix domain socket */
+
+	//---------------------------------------------------------------------------
+	// CompressionDaemon class:  shared codec service
+	//   included features:
+	//   -- codebooks are CodebookDictionary blobs in a DictionaryRegistry, so
+	//			they can be swapped while the daemon runs
+	//   -- one I/O thread polls the listening socket and every connection,
+	//			reads whole frames and queues the requests of each poll round
+	//			in batches of up to MAX_DAEMON_BATCH. Frames are parsed after every
+	//			read, and a connection reads a bounded amount per round and never
+	//			buffers more than one maximal frame
+	//   -- worker threads take a batch at a time, and write the responses for
+	//			one connection with a single send
+	//   -- counts requests, batches, errors and bytes, and keeps a latency
+	//			histogram (receipt of a frame to the send of its response)
+	//			for percentiles, also served to clients by DAEMON_STATS
+	//
+	// Frame layout (little endian), the same for requests and responses:
+	//   --  4 byte length of the rest of the frame, 1 byte op (request) or
+	//			status (response), 4 byte request ID, 4 byte dictionary ID,
+	//			then the payload
+	//   --  DAEMON_ENCODE: payload text, response payload the message of
+	//			CodebookDictionary::encodeMessage with the current version
+	//   --  DAEMON_DECODE: payload such a message, response payload its text
+	//   --  DAEMON_STATS: no payload, response payload the DaemonStats fields
+	//			as 8 byte values in declaration order
+	//
+	// Assumptions:
+	//   --  POSIX only, the implementation is compiled out on Windows
+	//   --  a malformed or oversized frame closes its connection
+	//---------------------------------------------------------------------------
+
+#pragma once
+
+// Included libraries
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// included .h files
+#include "DictionaryRegistry.h"
+
+// Bytes of a frame before its payload, the length field included
+const std::size_t DAEMON_FRAME_HEADER = 13;
+
+// Largest frame (after the length field) either side accepts
+const std::uint32_t MAX_DAEMON_FRAME = 1 << 26;
+
+// Most requests a worker takes at once
+const std::size_t MAX_DAEMON_BATCH = 64;
+
+// Batches queued before the I/O thread waits for the workers
+const std::size_t DAEMON_QUEUE_DEPTH = 256;
+
+// Request ops
+enum DaemonOp { DAEMON_ENCODE = 1, DAEMON_DECODE = 2, DAEMON_STATS = 3 };
+
+// Response statuses
+enum DaemonStatus { DAEMON_OK = 0, DAEMON_UNKNOWN_DICTIONARY = 1, DAEMON_BAD_REQUEST = 2 };
+
+
+// Counters of a running daemon
+struct DaemonStats {
+
+	std::uint64_t requests_ = 0;
+	std::uint64_t batches_ = 0;
+	std::uint64_t errors_ = 0; // requests answered with a status other than DAEMON_OK
+	std::uint64_t bytesIn_ = 0; // frame bytes received
+	std::uint64_t bytesOut_ = 0; // frame bytes sent
+	std::uint64_t connections_ = 0; // accepted so far
+	std::uint64_t p50Micros_ = 0;
+	std::uint64_t p99Micros_ = 0;
+	std::uint64_t maxMicros_ = 0;
+
+}; // end of DaemonStats
+
+
+class CompressionDaemon {
+
+public:
+
+	/** Constructors & Destructor */
+
+	/** Constructor
+	@pre workers >= 0
+	@post CompressionDaemon Object created, not yet listening
+	@parm int [workers] worker threads, 0 for one per core*/
+	explicit CompressionDaemon(int workers = 0);
+
+	/** Copy Constructor & Assignment disabled, the daemon owns its socket and threads */
+	CompressionDaemon(const CompressionDaemon& sourceDaemon) = delete;
+	CompressionDaemon& operator=(const CompressionDaemon& rhsDaemon) = delete;
+
+	/** Destructor
+	@pre None
+	@post daemon stopped*/
+	~CompressionDaemon();
+
+	/** Public Methods */
+
+	/** start
+	@pre not running
+	@post listening on socketPath (a stale socket file there is replaced), threads started
+	@parm std::string [socketPath]
+	@return true if the socket could be bound*/
+	bool start(const std::string& socketPath);
+
+	/** stop
+	@pre None
+	@post threads joined, queued requests answered, connections closed and the socket
+	file removed*/
+	void stop();
+
+	/** registry
+	@pre None
+	@post None
+	@return the codebooks served, publish and retire may be called while running*/
+	DictionaryRegistry& registry();
+
+	/** appendFrame
+	@pre size <= MAX_DAEMON_FRAME - DAEMON_FRAME_HEADER + 4
+	@post one frame appended to out, shared with CompressionClient
+	@parm std::vector<unsigned char> [out] passed by reference, unsigned char [code] op or status,
+	std::uint32_t [requestId], std::uint32_t [dictionaryId], unsigned char* [payload], std::size_t [size]*/
+	static void appendFrame(std::vector<unsigned char>& out, unsigned char code, std::uint32_t requestId,
+		std::uint32_t dictionaryId, const unsigned char* payload, std::size_t size);
+
+	/** sendAll
+	@pre fd is a connected socket
+	@post size bytes of data sent, interrupted, short and would-block sends are retried.
+	A peer that went away reports false rather than raising SIGPIPE
+	@parm int [fd], unsigned char* [data], std::size_t [size]
+	@return true if every byte was sent*/
+	static bool sendAll(int fd, const unsigned char* data, std::size_t size);
+
+	/** Accessor Methods */
+
+	/** stats
+	@return current counters and latency percentiles*/
+	DaemonStats stats() const;
+
+	/** isRunning
+	@return true between start and stop*/
+	bool isRunning() const;
+
+	/** workers
+	@return number of worker threads*/
+	int workers() const;
+
+private:
+
+	/** Private Attributes */
+
+	// a client, closed once the I/O thread and every queued request let go of it
+	struct Connection {
+
+		/** Destructor
+		@post fd_ closed*/
+		~Connection();
+
+		int fd_ = -1;
+		std::mutex writeMutex_; // one response batch on the wire at a time
+		std::vector<unsigned char> input_; // bytes of a frame not yet complete
+
+	}; // end of Connection
+
+	// one decoded request frame
+	struct Request {
+
+		std::shared_ptr<Connection> connection_;
+		unsigned char op_ = 0;
+		std::uint32_t requestId_ = 0;
+		std::uint32_t dictionaryId_ = 0;
+		std::vector<unsigned char> payload_;
+		std::chrono::steady_clock::time_point received_;
+
+	}; // end of Request
+
+	DictionaryRegistry registry_;
+	int workers_;
+	std::string socketPath_;
+	int listenFd_;
+	int wakeFds_[2]; // self pipe, wakes the I/O thread for stop
+
+	std::atomic<bool> running_;
+	std::thread ioThread_;
+	std::vector<std::thread> workerThreads_;
+
+	std::mutex queueMutex_;
+	std::condition_variable queueReady_; // a batch was queued, or stopping
+	std::condition_variable queueSpace_; // a batch was taken
+	std::deque<std::vector<Request>> queue_;
+	bool draining_; // no more batches will be queued
+
+	std::atomic<std::uint64_t> requests_;
+	std::atomic<std::uint64_t> batches_;
+	std::atomic<std::uint64_t> errors_;
+	std::atomic<std::uint64_t> bytesIn_;
+	std::atomic<std::uint64_t> bytesOut_;
+	std::atomic<std::uint64_t> connections_;
+	std::vector<std::atomic<std::uint64_t>> latency_; // request count per latency bucket
+
+	/** Private Methods */
+
+	/** ioLoop
+	@pre started
+	@post connections accepted and read, requests queued, until stop*/
+	void ioLoop();
+
+	/** readFrames
+	@pre connection is readable
+	@post up to READS_PER_ROUND chunks read, every complete frame of connection appended to requests
+	@parm std::shared_ptr<Connection> [connection], std::vector<Request> [requests] passed by reference
+	@return false if the connection closed or sent a malformed frame*/
+	bool readFrames(const std::shared_ptr<Connection>& connection, std::vector<Request>& requests);
+
+	/** parseFrames
+	@pre None
+	@post every complete frame at the start of the connection's input appended to requests and
+	removed from the input, an incomplete frame left in place
+	@parm std::shared_ptr<Connection> [connection], std::vector<Request> [requests] passed by reference
+	@return false if a frame length is malformed or above MAX_DAEMON_FRAME*/
+	bool parseFrames(const std::shared_ptr<Connection>& connection, std::vector<Request>& requests);
+
+	/** enqueue
+	@pre None
+	@post requests queued in batches of up to MAX_DAEMON_BATCH, waiting while the queue is full
+	@parm std::vector<Request> [requests] passed by reference, emptied*/
+	void enqueue(std::vector<Request>& requests);
+
+	/** workerLoop
+	@pre started
+	@post batches answered until the queue is drained after stop*/
+	void workerLoop();
+
+	/** answer
+	@pre None
+	@post response frame of request appended to out
+	@parm Request [request], std::vector<unsigned char> [out] passed by reference
+	@return status of the response*/
+	unsigned char answer(const Request& request, std::vector<unsigned char>& out);
+
+}; // End of CompressionDaemon
@@ -0,0 +1,252 @@
+/** @file ContextHuffmanAlgorithm.cpp
+ @author Anthony Campos
+ @date 10/19/2026
+ This implementation file implements a ContextHuffmanAlgorithm object, an order-1 Huffman Coding
+ made up of one HuffmanAlgorithm codebook per preceding char 'a' - 'z' */
+
+//---------------------------------------------------------------------------
+// ContextHuffmanAlgorithm class:  order-1 (context conditioned) Huffman Coding
+//   included features:
+//   -- allows construction by a NUM_LETTERS x NUM_LETTERS 64 bit array of pair counts,
+//			counts[prev][next] is how often 'a' + next follows 'a' + prev
+//   -- encodes each letter with the codebook of the letter before it
+//   -- contexts with few observations share one order-0 table, keeping the
+//			number of tables (and so the header needed to rebuild them) small
+//   -- allows for decipher of a input code per the context tables
+//
+// Assumptions:
+//   --  index 0-25 represents 'a' - 'z' .
+//   --  the first letter, having no preceding letter, uses the shared table
+//   --  text that only contains 'a' - 'z' will be provided to encode,
+//			other chars are skipped and do not change the context
+//---------------------------------------------------------------------------
+
+
+// included .h files
+#include "ContextHuffmanAlgorithm.h"
+
+/** Overloaded Ostream Method
+diplays the ContextHuffmanAlgorithm object to ostream stream
+@pre None
+@post prints the shared table followed by each context that owns its own table,
+in the HuffmanAlgorithm table format
+@param ostream [out] and ContextHuffmanAlgorithm [object]
+@return ostream object that represents an ContextHuffmanAlgorithm*/
+std::ostream& operator<<(std::ostream& out, const ContextHuffmanAlgorithm& object) {
+
+	out << "+=====+ Shared Context Table +=====+\n";
+	out << *object.tables_[0];
+
+	char context = 'a';
+	for (int i = 0; i < NUM_LETTERS; ++i) {
+
+		if (object.ownsTable(context)) {
+
+			out << "+=====+ Context: " << context << " +=====+\n";
+			out << *object.contextTables_[i];
+
+		} // end if
+
+		++context;
+
+	} // end for
+
+	return out;
+
+} // End of Overloaded Operator
+
+
+/** Constructor
+@pre all indexes must have a integer value
+@post ContextHuffmanAlgorithm Object is created. A shared table is built from the order-0
+(column) sums and every context observed at least minContextCount times gets its own table,
+the rest share the shared table
+@parm long long* [][] [counts], counts[prev][next] pair frequency for 'a' to 'z',
+int [minContextCount] observations needed for a context to own a table*/
+ContextHuffmanAlgorithm::ContextHuffmanAlgorithm(long long(&counts)[NUM_LETTERS][NUM_LETTERS], int minContextCount) {
+
+	// order-0 counts, used by the first letter and by every rare context
+	long long sharedCounts[NUM_LETTERS] = {};
+
+	for (int prev = 0; prev < NUM_LETTERS; ++prev) {
+
+		for (int next = 0; next < NUM_LETTERS; ++next) {
+
+			sharedCounts[next] += counts[prev][next];
+
+		} // end for
+
+	} // end for
+
+	tables_.push_back(new HuffmanAlgorithm(sharedCounts));
+
+	for (int prev = 0; prev < NUM_LETTERS; ++prev) {
+
+		long long contextTotal = 0;
+		for (int next = 0; next < NUM_LETTERS; ++next) {
+
+			contextTotal += counts[prev][next];
+
+		} // end for
+
+		// rare contexts are merged into the shared table
+		if (contextTotal < minContextCount) {
+
+			contextTables_[prev] = tables_[0];
+
+		}
+		else {
+
+			tables_.push_back(new HuffmanAlgorithm(counts[prev]));
+			contextTables_[prev] = tables_.back();
+
+		} // end if
+
+	} // end for
+
+} // End of Constructor
+
+/** Destructor
+@pre none
+@post destroy ContextHuffmanAlgorithm and release memory of every table */
+ContextHuffmanAlgorithm::~ContextHuffmanAlgorithm() {
+
+	for (unsigned int i = 0; i < tables_.size(); ++i) {
+
+		delete tables_[i];
+		tables_[i] = nullptr;
+
+	} // end for
+
+} // End of Destructor
+
+/** countPairs
+@pre None
+@post counts updated with every pair of consecutive lowercase letters of text,
+other chars are skipped
+@parm std::string [text], long long* [][] [counts] passed by reference*/
+void ContextHuffmanAlgorithm::countPairs(const std::string& text, long long(&counts)[NUM_LETTERS][NUM_LETTERS]) {
+
+	char context = '\0';
+
+	for (unsigned int i = 0; i < text.size(); ++i) {
+
+		char c = text[i];
+		// only valid char 'a' - 'z'
+		if (c >= 'a' && c <= 'z') {
+
+			if (context != '\0') {
+
+				++counts[context - 'a'][c - 'a'];
+
+			} // end if
+
+			context = c;
+
+		} // end if
+
+	} // end for
+
+} // End of countPairs
+
+/** getWord
+@pre string greater then 0 in size, only contains lower case letters
+@post all lowercase letters of provided string are encoded using the table of the
+letter before them
+@parm std::string [in], text to be converted with Huffman Coding
+@return string that represents the provided text encoded*/
+std::string ContextHuffmanAlgorithm::getWord(std::string in) const {
+
+	std::string code{};
+
+	char context = '\0';
+
+	for (unsigned int i = 0; i < in.size(); ++i) {
+
+		char c = in[i];
+		// only valid char 'a' - 'z'
+		if (c >= 'a' && c <= 'z') {
+
+			code += tableFor(context).getCode(c);
+			context = c;
+
+		} // end if
+
+	} // End for
+
+	return code;
+
+} // End of getWord
+
+/** decipher
+@pre provided code was generated by current ContextHuffmanAlgorithm
+@post text representation of the code is computed.
+@parm std::string [in], code to be converted to text with Huffman Coding
+@return text representation of provided code*/
+std::string ContextHuffmanAlgorithm::decipher(std::string in) const {
+
+	std::string text{};
+
+	char context = '\0';
+	char letter = '\0';
+	unsigned int index = 0;
+
+	// each letter selects the table used to decode the next one
+	while (index < in.size() && tableFor(context).decipherLetter(in, index, letter)) {
+
+		text += letter;
+		context = letter;
+
+	} // end while
+
+	return text;
+
+} // End of decipher
+
+/** tableCount
+@pre None
+@post None
+@return number of distinct tables, the shared table included*/
+int ContextHuffmanAlgorithm::tableCount() const {
+
+	return static_cast<int>(tables_.size());
+
+} // End of tableCount
+
+/** ownsTable
+@pre None
+@post None
+@parm char [context], 'a' - 'z'
+@return true if the context has its own table, false if it uses the shared table*/
+bool ContextHuffmanAlgorithm::ownsTable(const char context) const {
+
+	bool owns = false;
+
+	if (context >= 'a' && context <= 'z') {
+
+		owns = contextTables_[context - 'a'] != tables_[0];
+
+	} // end if
+
+	return owns;
+
+} // End of ownsTable
+
+/** tableFor
+@pre None
+@post None
+@parm char [context], previous letter or '\0' for the first letter
+@return table used to code the letter following context*/
+const HuffmanAlgorithm& ContextHuffmanAlgorithm::tableFor(const char context) const {
+
+	const HuffmanAlgorithm* table = tables_[0];
+
+	if (context >= 'a' && context <= 'z') {
+
+		table = contextTables_[context - 'a'];
+
+	} // end if
+
+	return *table;
+
+} // End of tableFor
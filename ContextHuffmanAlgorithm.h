@@ -0,0 +1,130 @@
+/** @file ContextHuffmanAlgorithm.h
+ @author Anthony Campos
+ @date 10/19/2026
+ This header class file implements a ContextHuffmanAlgorithm object, an order-1 Huffman Coding
+ made up of one HuffmanAlgorithm codebook per preceding char 'a' - 'z' */
+
+	//---------------------------------------------------------------------------
+	// ContextHuffmanAlgorithm class:  order-1 (context conditioned) Huffman Coding
+	//   included features:
+	//   -- allows construction by a NUM_LETTERS x NUM_LETTERS 64 bit array of pair counts,
+	//			counts[prev][next] is how often 'a' + next follows 'a' + prev
+	//   -- encodes each letter with the codebook of the letter before it
+	//   -- contexts with few observations share one order-0 table, keeping the
+	//			number of tables (and so the header needed to rebuild them) small
+	//   -- allows for decipher of a input code per the context tables
+	//
+	// Assumptions:
+	//   --  index 0-25 represents 'a' - 'z' .
+	//   --  the first letter, having no preceding letter, uses the shared table
+	//   --  text that only contains 'a' - 'z' will be provided to encode,
+	//			other chars are skipped and do not change the context
+	//---------------------------------------------------------------------------
+
+#pragma once
+
+// Included libraries
+#include <string>
+#include <iostream>
+#include <vector>
+
+// included .h files
+#include "HuffmanAlgorithm.h"
+
+// Default number of observations a context needs to get its own table
+const int DEFAULT_MIN_CONTEXT_COUNT = 64;
+
+
+class ContextHuffmanAlgorithm {
+
+	/** Overloaded Ostream Method
+	diplays the ContextHuffmanAlgorithm object to ostream stream
+	@pre None
+	@post prints the shared table followed by each context that owns its own table,
+	in the HuffmanAlgorithm table format
+	@param ostream [out] and ContextHuffmanAlgorithm [object]
+	@return ostream object that represents an ContextHuffmanAlgorithm*/
+	friend std::ostream& operator<<(std::ostream& out, const ContextHuffmanAlgorithm& object);
+
+
+public:
+
+	/** Constructors */
+
+	/** Constructor
+	@pre all indexes must have a integer value
+	@post ContextHuffmanAlgorithm Object is created. A shared table is built from the order-0
+	(column) sums and every context observed at least minContextCount times gets its own table,
+	the rest share the shared table
+	@parm long long* [][] [counts], counts[prev][next] pair frequency for 'a' to 'z',
+	int [minContextCount] observations needed for a context to own a table*/
+	ContextHuffmanAlgorithm(long long(&counts)[NUM_LETTERS][NUM_LETTERS],
+		int minContextCount = DEFAULT_MIN_CONTEXT_COUNT);
+
+	/** Copy Constructor & Assignment disabled, tables are shared between contexts */
+	ContextHuffmanAlgorithm(const ContextHuffmanAlgorithm& sourceCodec) = delete;
+	ContextHuffmanAlgorithm& operator=(const ContextHuffmanAlgorithm& rhsCodec) = delete;
+
+	// Deconstructor
+	~ContextHuffmanAlgorithm();
+
+
+	/** Public Methods */
+
+	/** countPairs
+	@pre None
+	@post counts updated with every pair of consecutive lowercase letters of text,
+	other chars are skipped
+	@parm std::string [text], long long* [][] [counts] passed by reference*/
+	static void countPairs(const std::string& text, long long(&counts)[NUM_LETTERS][NUM_LETTERS]);
+
+	/** getWord
+	@pre string greater then 0 in size, only contains lower case letters
+	@post all lowercase letters of provided string are encoded using the table of the
+	letter before them
+	@parm std::string [in], text to be converted with Huffman Coding
+	@return string that represents the provided text encoded*/
+	std::string getWord(std::string in) const;
+
+	/** decipher
+	@pre provided code was generated by current ContextHuffmanAlgorithm
+	@post text representation of the code is computed.
+	@parm std::string [in], code to be converted to text with Huffman Coding
+	@return text representation of provided code*/
+	std::string decipher(std::string in) const;
+
+	/** tableCount
+	@pre None
+	@post None
+	@return number of distinct tables, the shared table included*/
+	int tableCount() const;
+
+	/** ownsTable
+	@pre None
+	@post None
+	@parm char [context], 'a' - 'z'
+	@return true if the context has its own table, false if it uses the shared table*/
+	bool ownsTable(const char context) const;
+
+
+private:
+
+	/** Private Attributes */
+
+	// distinct tables, tables_[0] is the shared table
+	std::vector<HuffmanAlgorithm*> tables_;
+
+	// table used after each letter, points into tables_
+	const HuffmanAlgorithm* contextTables_[NUM_LETTERS];
+
+	/** Private Methods */
+
+	/** tableFor
+	@pre None
+	@post None
+	@parm char [context], previous letter or '\0' for the first letter
+	@return table used to code the letter following context*/
+	const HuffmanAlgorithm& tableFor(const char context) const;
+
+
+}; // End of ContextHuffmanAlgorithm
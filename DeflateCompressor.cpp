@@ -0,0 +1,721 @@
+/** @file DeflateCompressor.cpp
+ @author Anthony Campos
+ @date 10/19/2026
+ This implementation file implements a DeflateCompressor, an LZ77 match finder feeding Huffman coded
+ literal/length and distance alphabets, written as a raw DEFLATE (RFC 1951) stream */
+
+//---------------------------------------------------------------------------
+// DeflateCompressor class:  LZ77 + Huffman Coding
+//   included features:
+//   -- matches of 3 to 258 bytes up to 32 KiB back are found through hash
+//			chains over 3 byte prefixes
+//   -- levels 1 - 9 trade speed for ratio: how many chain entries are
+//			tried, the length that ends the search early, and from level 4
+//			lazy matching (a match is put off by one byte if the next one is
+//			longer). Level 0 stores the input uncompressed
+//   -- code lengths come from the HuffmanTree builder through
+//			SparseHuffmanCodec::codeLengths, limited to 15 bits for the
+//			literal/length and distance codes and 7 for the code length code
+//   -- every block is written as whichever of dynamic Huffman, fixed
+//			Huffman or stored takes fewer bits
+//   -- the output is a raw DEFLATE stream, no zlib or gzip wrapper, that any
+//			inflate implementation reads
+//
+// Assumptions:
+//   --  input is held in memory and is smaller than 4 GiB
+//---------------------------------------------------------------------------
+
+
+// included .h files
+#include "DeflateCompressor.h"
+#include "SparseHuffmanCodec.h"
+
+// Included libraries
+#include <algorithm>
+
+
+namespace {
+
+	const int MIN_MATCH = 3;
+	const int MAX_MATCH = 258;
+	const std::size_t WINDOW_SIZE = 32768;
+	const int HASH_BITS = 15;
+	const std::size_t MAX_STORED_BLOCK = 65535;
+
+	const int LITERAL_CODES = 286; // 0 - 255 literals, 256 end of block, 257 - 285 lengths
+	const int FIXED_LITERAL_CODES = 288; // the fixed code also assigns 286 and 287
+	const int DISTANCE_CODES = 30;
+	const int CODE_LENGTH_CODES = 19;
+	const int END_OF_BLOCK = 256;
+	const int MAX_CODE_BITS = 15;
+	const int MAX_CODE_LENGTH_BITS = 7;
+
+	const int LENGTH_BASE[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67,
+		83, 99, 115, 131, 163, 195, 227, 258 };
+	const int LENGTH_EXTRA[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+	const int DISTANCE_BASE[DISTANCE_CODES] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385,
+		513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+	const int DISTANCE_EXTRA[DISTANCE_CODES] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9,
+		10, 10, 11, 11, 12, 12, 13, 13 };
+
+	// order the code length code lengths are written in
+	const int CODE_LENGTH_ORDER[CODE_LENGTH_CODES] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+	// match search effort per level
+	struct LevelSettings {
+
+		int maxChain_; // chain entries tried per search
+		int niceLength_; // a match this long ends the search
+		bool lazy_; // try the next byte before taking a match
+
+	}; // end of LevelSettings
+
+	const LevelSettings LEVELS[10] = { { 0, 0, false }, { 4, 16, false }, { 8, 32, false }, { 16, 64, false },
+		{ 16, 32, true }, { 32, 64, true }, { 128, 128, true }, { 256, 192, true }, { 1024, 258, true },
+		{ 4096, 258, true } };
+
+	// a literal (length_ 0, value_ the byte) or a match (length_ bytes, value_ back)
+	struct Token {
+
+		std::uint16_t length_;
+		std::uint16_t value_;
+
+	}; // end of Token
+
+
+	// DEFLATE bit order: values least significant bit first, Huffman codes bit reversed
+	class LsbWriter {
+
+	public:
+
+		explicit LsbWriter(std::vector<unsigned char>& out)
+			:out_(out), accumulator_(0), accumulatorBits_(0) {}
+
+		/** writeBits appends the low length bits of bits, 0 <= length <= 32 */
+		void writeBits(std::uint32_t bits, int length) {
+
+			accumulator_ |= static_cast<std::uint64_t>(bits) << accumulatorBits_;
+			accumulatorBits_ += length;
+
+			while (accumulatorBits_ >= 8) {
+
+				out_.push_back(static_cast<unsigned char>(accumulator_));
+				accumulator_ >>= 8;
+				accumulatorBits_ -= 8;
+
+			} // end while
+
+		} // End of writeBits
+
+		/** alignToByte pads the partial byte with 0 bits */
+		void alignToByte() {
+
+			if (accumulatorBits_ > 0) {
+				writeBits(0, 8 - accumulatorBits_);
+			} // end if
+
+		} // End of alignToByte
+
+		/** writeBytes appends bytes, the writer must be byte aligned */
+		void writeBytes(const unsigned char* data, std::size_t size) {
+
+			out_.insert(out_.end(), data, data + size);
+
+		} // End of writeBytes
+
+	private:
+
+		std::vector<unsigned char>& out_;
+		std::uint64_t accumulator_;
+		int accumulatorBits_;
+
+	}; // end of LsbWriter
+
+
+	// hash chains over the 3 byte prefix at every position
+	class MatchFinder {
+
+	public:
+
+		MatchFinder(const unsigned char* data, std::size_t size, const LevelSettings& settings)
+			:data_(data), size_(size), settings_(settings), head_(static_cast<std::size_t>(1) << HASH_BITS, 0),
+			prev_(WINDOW_SIZE, 0) {}
+
+		/** insert adds pos to its chain, if 3 bytes start there */
+		void insert(std::size_t pos) {
+
+			if (pos + MIN_MATCH <= size_) {
+
+				std::uint32_t& head = head_[hash(pos)];
+				prev_[pos & (WINDOW_SIZE - 1)] = head;
+				head = static_cast<std::uint32_t>(pos + 1);
+
+			} // end if
+
+		} // End of insert
+
+		/** find sets length and distance to the longest match for pos found, length 0 if none */
+		void find(std::size_t pos, int& length, int& distance) const {
+
+			length = 0;
+			distance = 0;
+
+			const int maxLength = static_cast<int>(std::min<std::size_t>(MAX_MATCH, size_ - pos));
+
+			if (maxLength >= MIN_MATCH) {
+
+				int bestLength = MIN_MATCH - 1;
+				std::uint32_t candidate = head_[hash(pos)];
+				int chain = settings_.maxChain_;
+
+				// entries along a chain only get older, stop once out of the window
+				while (candidate != 0 && chain > 0 && pos - (candidate - 1) <= WINDOW_SIZE) {
+
+					const std::size_t start = candidate - 1;
+
+					if (data_[start + bestLength] == data_[pos + bestLength]) {
+
+						int matched = 0;
+						while (matched < maxLength && data_[start + matched] == data_[pos + matched]) {
+							++matched;
+						} // end while
+
+						if (matched > bestLength) {
+
+							bestLength = matched;
+							distance = static_cast<int>(pos - start);
+
+							if (matched >= settings_.niceLength_ || matched == maxLength) {
+								chain = 0;
+							} // end if
+
+						} // end if
+
+					} // end if
+
+					candidate = prev_[start & (WINDOW_SIZE - 1)];
+					--chain;
+
+				} // end while
+
+				if (bestLength >= MIN_MATCH) {
+					length = bestLength;
+				} // end if
+
+			} // end if
+
+		} // End of find
+
+	private:
+
+		std::size_t hash(std::size_t pos) const {
+
+			const std::uint32_t prefix = data_[pos] | (data_[pos + 1] << 8) | (data_[pos + 2] << 16);
+			return (prefix * 2654435761u) >> (32 - HASH_BITS);
+
+		} // End of hash
+
+		const unsigned char* data_;
+		std::size_t size_;
+		LevelSettings settings_;
+		std::vector<std::uint32_t> head_; // newest position + 1 per hash, 0 for none
+		std::vector<std::uint32_t> prev_; // older position + 1 with the same hash, per window slot
+
+	}; // end of MatchFinder
+
+
+	/** lengthCode: index into LENGTH_BASE of a match length */
+	int lengthCode(int length) {
+
+		return static_cast<int>(std::upper_bound(LENGTH_BASE, LENGTH_BASE + 29, length) - LENGTH_BASE) - 1;
+
+	} // End of lengthCode
+
+	/** distanceCode: index into DISTANCE_BASE of a match distance */
+	int distanceCode(int distance) {
+
+		return static_cast<int>(std::upper_bound(DISTANCE_BASE, DISTANCE_BASE + DISTANCE_CODES, distance)
+			- DISTANCE_BASE) - 1;
+
+	} // End of distanceCode
+
+	/** buildLengths: Huffman code lengths of counts, at most maxBits. At least two symbols get a
+	code, inflate rejects a code length code of one symbol */
+	std::vector<int> buildLengths(const std::vector<long long>& counts, int maxBits) {
+
+		std::vector<int> used;
+		std::vector<long long> usedCounts;
+
+		for (unsigned int i = 0; i < counts.size(); ++i) {
+
+			if (counts[i] > 0) {
+
+				used.push_back(i);
+				usedCounts.push_back(counts[i]);
+
+			} // end if
+
+		} // end for
+
+		for (unsigned int i = 0; used.size() < 2 && i < counts.size(); ++i) {
+
+			if (counts[i] == 0) {
+
+				used.push_back(i);
+				usedCounts.push_back(1);
+
+			} // end if
+
+		} // end for
+
+		std::vector<int> lengths(counts.size(), 0);
+		std::vector<int> usedLengths = SparseHuffmanCodec::codeLengths(usedCounts, maxBits);
+
+		for (unsigned int i = 0; i < used.size(); ++i) {
+			lengths[used[i]] = usedLengths[i];
+		} // end for
+
+		return lengths;
+
+	} // End of buildLengths
+
+	/** canonicalCodes: RFC 1951 canonical codes of lengths, bit reversed for the LSB first writer */
+	std::vector<std::uint32_t> canonicalCodes(const std::vector<int>& lengths) {
+
+		int lengthCount[MAX_CODE_BITS + 1] = {};
+		for (unsigned int i = 0; i < lengths.size(); ++i) {
+			++lengthCount[lengths[i]];
+		} // end for
+
+		std::uint32_t nextCode[MAX_CODE_BITS + 1] = {};
+		std::uint32_t code = 0;
+		lengthCount[0] = 0;
+
+		for (int bits = 1; bits <= MAX_CODE_BITS; ++bits) {
+
+			code = (code + lengthCount[bits - 1]) << 1;
+			nextCode[bits] = code;
+
+		} // end for
+
+		std::vector<std::uint32_t> codes(lengths.size(), 0);
+
+		for (unsigned int i = 0; i < lengths.size(); ++i) {
+
+			if (lengths[i] > 0) {
+
+				std::uint32_t canonical = nextCode[lengths[i]]++;
+				std::uint32_t reversed = 0;
+
+				for (int bit = 0; bit < lengths[i]; ++bit) {
+
+					reversed = (reversed << 1) | (canonical & 1);
+					canonical >>= 1;
+
+				} // end for
+
+				codes[i] = reversed;
+
+			} // end if
+
+		} // end for
+
+		return codes;
+
+	} // End of canonicalCodes
+
+	/** runLengthEncode: code length code symbols (with their extra bits value) of lengths */
+	void runLengthEncode(const std::vector<int>& lengths, std::vector<std::pair<int, int>>& symbols) {
+
+		std::size_t i = 0;
+
+		while (i < lengths.size()) {
+
+			const int length = lengths[i];
+			std::size_t run = 1;
+			while (i + run < lengths.size() && lengths[i + run] == length) {
+				++run;
+			} // end while
+
+			i += run;
+
+			if (length == 0) {
+
+				while (run >= 11) {
+
+					const std::size_t repeat = std::min<std::size_t>(run, 138);
+					symbols.push_back(std::make_pair(18, static_cast<int>(repeat - 11)));
+					run -= repeat;
+
+				} // end while
+
+				if (run >= 3) {
+
+					symbols.push_back(std::make_pair(17, static_cast<int>(run - 3)));
+					run = 0;
+
+				} // end if
+
+			}
+			else {
+
+				// the first length is written, 16 then repeats it
+				symbols.push_back(std::make_pair(length, 0));
+				--run;
+
+				while (run >= 3) {
+
+					const std::size_t repeat = std::min<std::size_t>(run, 6);
+					symbols.push_back(std::make_pair(16, static_cast<int>(repeat - 3)));
+					run -= repeat;
+
+				} // end while
+
+			} // end if
+
+			for (; run > 0; --run) {
+				symbols.push_back(std::make_pair(length, 0));
+			} // end for
+
+		} // end while
+
+	} // End of runLengthEncode
+
+	/** codeLengthExtraBits: extra bits after a code length code symbol */
+	int codeLengthExtraBits(int symbol) {
+
+		return symbol == 16 ? 2 : (symbol == 17 ? 3 : (symbol == 18 ? 7 : 0));
+
+	} // End of codeLengthExtraBits
+
+	/** writeStored: data as stored blocks of at most MAX_STORED_BLOCK bytes */
+	void writeStored(const unsigned char* data, std::size_t size, bool last, LsbWriter& writer) {
+
+		std::size_t offset = 0;
+
+		do {
+
+			const std::size_t length = std::min(size - offset, MAX_STORED_BLOCK);
+			const bool final = last && offset + length == size;
+
+			writer.writeBits(final ? 1 : 0, 1);
+			writer.writeBits(0, 2);
+			writer.alignToByte();
+			writer.writeBits(static_cast<std::uint32_t>(length), 16);
+			writer.writeBits(static_cast<std::uint32_t>(~length & 0xFFFF), 16);
+			writer.writeBytes(data + offset, length);
+
+			offset += length;
+
+		} while (offset < size);
+
+	} // End of writeStored
+
+	/** writeTokens: tokens and the end of block code with the given codes */
+	void writeTokens(const std::vector<Token>& tokens, const std::vector<std::uint32_t>& literalCodes,
+		const std::vector<int>& literalLengths, const std::vector<std::uint32_t>& distanceCodes,
+		const std::vector<int>& distanceLengths, LsbWriter& writer) {
+
+		for (std::size_t i = 0; i < tokens.size(); ++i) {
+
+			const Token& token = tokens[i];
+
+			if (token.length_ == 0) {
+
+				writer.writeBits(literalCodes[token.value_], literalLengths[token.value_]);
+
+			}
+			else {
+
+				const int length = lengthCode(token.length_);
+				writer.writeBits(literalCodes[257 + length], literalLengths[257 + length]);
+				writer.writeBits(token.length_ - LENGTH_BASE[length], LENGTH_EXTRA[length]);
+
+				const int distance = distanceCode(token.value_);
+				writer.writeBits(distanceCodes[distance], distanceLengths[distance]);
+				writer.writeBits(token.value_ - DISTANCE_BASE[distance], DISTANCE_EXTRA[distance]);
+
+			} // end if
+
+		} // end for
+
+		writer.writeBits(literalCodes[END_OF_BLOCK], literalLengths[END_OF_BLOCK]);
+
+	} // End of writeTokens
+
+	/** writeBlock: tokens, which cover data[0, size), as the smallest of dynamic, fixed and stored */
+	void writeBlock(const std::vector<Token>& tokens, const unsigned char* data, std::size_t size, bool last,
+		LsbWriter& writer) {
+
+		std::vector<long long> literalCounts(LITERAL_CODES, 0);
+		std::vector<long long> distanceCounts(DISTANCE_CODES, 0);
+		long long extraBits = 0;
+
+		for (std::size_t i = 0; i < tokens.size(); ++i) {
+
+			if (tokens[i].length_ == 0) {
+
+				++literalCounts[tokens[i].value_];
+
+			}
+			else {
+
+				const int length = lengthCode(tokens[i].length_);
+				const int distance = distanceCode(tokens[i].value_);
+
+				++literalCounts[257 + length];
+				++distanceCounts[distance];
+				extraBits += LENGTH_EXTRA[length] + DISTANCE_EXTRA[distance];
+
+			} // end if
+
+		} // end for
+
+		literalCounts[END_OF_BLOCK] = 1;
+
+		// dynamic codes and their header
+		std::vector<int> literalLengths = buildLengths(literalCounts, MAX_CODE_BITS);
+		std::vector<int> distanceLengths = buildLengths(distanceCounts, MAX_CODE_BITS);
+
+		int literalsSent = LITERAL_CODES;
+		while (literalsSent > 257 && literalLengths[literalsSent - 1] == 0) {
+			--literalsSent;
+		} // end while
+
+		int distancesSent = DISTANCE_CODES;
+		while (distancesSent > 1 && distanceLengths[distancesSent - 1] == 0) {
+			--distancesSent;
+		} // end while
+
+		std::vector<int> sentLengths(literalLengths.begin(), literalLengths.begin() + literalsSent);
+		sentLengths.insert(sentLengths.end(), distanceLengths.begin(), distanceLengths.begin() + distancesSent);
+
+		std::vector<std::pair<int, int>> lengthSymbols;
+		runLengthEncode(sentLengths, lengthSymbols);
+
+		std::vector<long long> lengthSymbolCounts(CODE_LENGTH_CODES, 0);
+		for (std::size_t i = 0; i < lengthSymbols.size(); ++i) {
+			++lengthSymbolCounts[lengthSymbols[i].first];
+		} // end for
+
+		std::vector<int> codeLengthLengths = buildLengths(lengthSymbolCounts, MAX_CODE_LENGTH_BITS);
+
+		int codeLengthsSent = CODE_LENGTH_CODES;
+		while (codeLengthsSent > 4 && codeLengthLengths[CODE_LENGTH_ORDER[codeLengthsSent - 1]] == 0) {
+			--codeLengthsSent;
+		} // end while
+
+		long long dynamicBits = 3 + 5 + 5 + 4 + 3 * codeLengthsSent + extraBits;
+		for (std::size_t i = 0; i < lengthSymbols.size(); ++i) {
+			dynamicBits += codeLengthLengths[lengthSymbols[i].first] + codeLengthExtraBits(lengthSymbols[i].first);
+		} // end for
+
+		// fixed codes
+		std::vector<int> fixedLiteralLengths(FIXED_LITERAL_CODES, 8);
+		std::fill(fixedLiteralLengths.begin() + 144, fixedLiteralLengths.begin() + 256, 9);
+		std::fill(fixedLiteralLengths.begin() + 256, fixedLiteralLengths.begin() + 280, 7);
+		std::vector<int> fixedDistanceLengths(DISTANCE_CODES, 5);
+
+		long long fixedBits = 3 + extraBits;
+
+		for (int i = 0; i < LITERAL_CODES; ++i) {
+
+			dynamicBits += literalCounts[i] * literalLengths[i];
+			fixedBits += literalCounts[i] * fixedLiteralLengths[i];
+
+		} // end for
+
+		for (int i = 0; i < DISTANCE_CODES; ++i) {
+
+			dynamicBits += distanceCounts[i] * distanceLengths[i];
+			fixedBits += distanceCounts[i] * fixedDistanceLengths[i];
+
+		} // end for
+
+		// stored, counting the worst case alignment padding
+		const long long storedBlocks = size > 0 ? static_cast<long long>((size + MAX_STORED_BLOCK - 1) / MAX_STORED_BLOCK) : 1;
+		const long long storedBits = storedBlocks * (3 + 7 + 32) + 8 * static_cast<long long>(size);
+
+		if (storedBits < dynamicBits && storedBits < fixedBits) {
+
+			writeStored(data, size, last, writer);
+
+		}
+		else if (fixedBits <= dynamicBits) {
+
+			writer.writeBits(last ? 1 : 0, 1);
+			writer.writeBits(1, 2);
+			writeTokens(tokens, canonicalCodes(fixedLiteralLengths), fixedLiteralLengths,
+				canonicalCodes(fixedDistanceLengths), fixedDistanceLengths, writer);
+
+		}
+		else {
+
+			writer.writeBits(last ? 1 : 0, 1);
+			writer.writeBits(2, 2);
+			writer.writeBits(literalsSent - 257, 5);
+			writer.writeBits(distancesSent - 1, 5);
+			writer.writeBits(codeLengthsSent - 4, 4);
+
+			for (int i = 0; i < codeLengthsSent; ++i) {
+				writer.writeBits(codeLengthLengths[CODE_LENGTH_ORDER[i]], 3);
+			} // end for
+
+			std::vector<std::uint32_t> codeLengthCodes = canonicalCodes(codeLengthLengths);
+			for (std::size_t i = 0; i < lengthSymbols.size(); ++i) {
+
+				const int symbol = lengthSymbols[i].first;
+				writer.writeBits(codeLengthCodes[symbol], codeLengthLengths[symbol]);
+				writer.writeBits(lengthSymbols[i].second, codeLengthExtraBits(symbol));
+
+			} // end for
+
+			writeTokens(tokens, canonicalCodes(literalLengths), literalLengths,
+				canonicalCodes(distanceLengths), distanceLengths, writer);
+
+		} // end if
+
+	} // End of writeBlock
+
+} // end of namespace
+
+
+/** Constructor
+@pre None
+@post DeflateCompressor Object created, level clamped to 0 - 9
+@parm int [level]*/
+DeflateCompressor::DeflateCompressor(int level)
+	:level_(std::max(0, std::min(9, level)))
+{} // End of Constructor
+
+/** compress
+@pre size < 2^32
+@post None
+@parm unsigned char* [data], std::size_t [size]
+@return raw DEFLATE stream of data*/
+std::vector<unsigned char> DeflateCompressor::compress(const unsigned char* data, std::size_t size) const {
+
+	std::vector<unsigned char> out;
+	out.reserve(size / 2 + 64);
+	LsbWriter writer(out);
+
+	if (level_ == 0) {
+
+		writeStored(data, size, true, writer);
+
+	}
+	else {
+
+		const LevelSettings& settings = LEVELS[level_];
+		MatchFinder finder(data, size, settings);
+
+		std::vector<Token> tokens;
+		tokens.reserve(DEFLATE_BLOCK_TOKENS);
+
+		std::size_t blockStart = 0;
+		std::size_t pos = 0;
+		bool pending = false; // a match for pos was found by the lazy look ahead
+		int length = 0;
+		int distance = 0;
+
+		while (pos < size) {
+
+			if (!pending) {
+				finder.find(pos, length, distance);
+			} // end if
+
+			pending = false;
+
+			// lazy matching: if the next byte starts a longer match, this byte goes out as a literal
+			if (length > 0 && settings.lazy_ && length < settings.niceLength_ && pos + 1 < size) {
+
+				finder.insert(pos);
+
+				int nextLength = 0;
+				int nextDistance = 0;
+				finder.find(pos + 1, nextLength, nextDistance);
+
+				if (nextLength > length) {
+
+					Token literal = { 0, data[pos] };
+					tokens.push_back(literal);
+					++pos;
+
+					length = nextLength;
+					distance = nextDistance;
+					pending = true;
+
+				}
+				else {
+
+					Token match = { static_cast<std::uint16_t>(length), static_cast<std::uint16_t>(distance) };
+					tokens.push_back(match);
+
+					for (std::size_t next = pos + 1; next < pos + length; ++next) {
+						finder.insert(next);
+					} // end for
+
+					pos += length;
+
+				} // end if
+
+			}
+			else if (length > 0) {
+
+				Token match = { static_cast<std::uint16_t>(length), static_cast<std::uint16_t>(distance) };
+				tokens.push_back(match);
+
+				for (std::size_t next = pos; next < pos + length; ++next) {
+					finder.insert(next);
+				} // end for
+
+				pos += length;
+
+			}
+			else {
+
+				Token literal = { 0, data[pos] };
+				tokens.push_back(literal);
+				finder.insert(pos);
+				++pos;
+
+			} // end if
+
+			if (tokens.size() >= DEFLATE_BLOCK_TOKENS) {
+
+				writeBlock(tokens, data + blockStart, pos - blockStart, false, writer);
+				tokens.clear();
+				blockStart = pos;
+
+			} // end if
+
+		} // end while
+
+		writeBlock(tokens, data + blockStart, size - blockStart, true, writer);
+
+	} // end if
+
+	writer.alignToByte();
+
+	return out;
+
+} // End of compress
+
+/** compress
+@pre text.size() < 2^32
+@post None
+@parm std::string [text]
+@return raw DEFLATE stream of text*/
+std::vector<unsigned char> DeflateCompressor::compress(const std::string& text) const {
+
+	return compress(reinterpret_cast<const unsigned char*>(text.data()), text.size());
+
+} // End of compress
+
+/** level
+@return compression level*/
+int DeflateCompressor::level() const {
+
+	return level_;
+
+} // End of level
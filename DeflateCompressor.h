@@ -0,0 +1,82 @@
+/** @file DeflateCompressor.h
+ @author Anthony Campos
+ @date 10/19/2026
+ This header class file implements a DeflateCompressor, an LZ77 match finder feeding Huffman coded
+ literal/length and distance alphabets, written as a raw DEFLATE (RFC 1951) stream */
+
+	//---------------------------------------------------------------------------
+	// DeflateCompressor class:  LZ77 + Huffman Coding
+	//   included features:
+	//   -- matches of 3 to 258 bytes up to 32 KiB back are found through hash
+	//			chains over 3 byte prefixes
+	//   -- levels 1 - 9 trade speed for ratio: how many chain entries are
+	//			tried, the length that ends the search early, and from level 4
+	//			lazy matching (a match is put off by one byte if the next one is
+	//			longer). Level 0 stores the input uncompressed
+	//   -- code lengths come from the HuffmanTree builder through
+	//			SparseHuffmanCodec::codeLengths, limited to 15 bits for the
+	//			literal/length and distance codes and 7 for the code length code
+	//   -- every block is written as whichever of dynamic Huffman, fixed
+	//			Huffman or stored takes fewer bits
+	//   -- the output is a raw DEFLATE stream, no zlib or gzip wrapper, that any
+	//			inflate implementation reads
+	//
+	// Assumptions:
+	//   --  input is held in memory and is smaller than 4 GiB
+	//---------------------------------------------------------------------------
+
+#pragma once
+
+// Included libraries
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Compression level used when none is given, 0 (store) to 9 (smallest)
+const int DEFAULT_DEFLATE_LEVEL = 6;
+
+// Most literals and matches in one block, each block gets its own codes
+const std::size_t DEFLATE_BLOCK_TOKENS = 1 << 16;
+
+
+class DeflateCompressor {
+
+public:
+
+	/** Constructors */
+
+	/** Constructor
+	@pre None
+	@post DeflateCompressor Object created, level clamped to 0 - 9
+	@parm int [level]*/
+	explicit DeflateCompressor(int level = DEFAULT_DEFLATE_LEVEL);
+
+	/** Public Methods */
+
+	/** compress
+	@pre size < 2^32
+	@post None
+	@parm unsigned char* [data], std::size_t [size]
+	@return raw DEFLATE stream of data*/
+	std::vector<unsigned char> compress(const unsigned char* data, std::size_t size) const;
+
+	/** compress
+	@pre text.size() < 2^32
+	@post None
+	@parm std::string [text]
+	@return raw DEFLATE stream of text*/
+	std::vector<unsigned char> compress(const std::string& text) const;
+
+	/** Accessor Methods */
+
+	/** level
+	@return compression level*/
+	int level() const;
+
+private:
+
+	/** Private Attributes */
+	int level_;
+
+}; // End of DeflateCompressor
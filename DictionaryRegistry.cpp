@@ -0,0 +1,233 @@
+/** @file DictionaryRegistry.cpp
+ @author Anthony Campos
+ @date 10/19/2026
+ This implementation file implements a DictionaryRegistry, the set of loaded CodebookDictionary
+ objects that messages reference by dictionary ID and version */
+
+//---------------------------------------------------------------------------
+// DictionaryRegistry class:  hot swappable CodebookDictionary lookup
+//   included features:
+//   -- allows for publishing a new dictionary version, which becomes the
+//			current version of its ID, and retiring old versions
+//   -- lookups read an immutable snapshot through one atomic load, they
+//			never wait for a publish or retire
+//   -- a dictionary handed to a reader stays alive until the reader lets it
+//			go, even after it is replaced or retired
+//   -- allows for encoding with the current version of an ID and decoding
+//			any message whose version is still registered
+//
+// Assumptions:
+//   --  any number of threads may look up, publish and retire are serialized
+//---------------------------------------------------------------------------
+
+
+// included .h files
+#include "DictionaryRegistry.h"
+
+// Included libraries
+#include <atomic>
+
+
+/** Defualt Constructor
+@pre None
+@post Empty DictionaryRegistry Object created*/
+DictionaryRegistry::DictionaryRegistry()
+	:snapshot_(std::make_shared<const Snapshot>())
+{} // End of Constructor
+
+/** publish
+@pre None
+@post dictionary registered, it becomes the current version of its ID unless a
+higher version is already current
+@parm std::shared_ptr<const CodebookDictionary> [dictionary]
+@return false if dictionary is empty or not loaded*/
+bool DictionaryRegistry::publish(std::shared_ptr<const CodebookDictionary> dictionary) {
+
+	bool published = dictionary && dictionary->isLoaded();
+
+	if (published) {
+
+		std::lock_guard<std::mutex> lock(updateMutex_);
+
+		const std::uint32_t dictionaryId = dictionary->dictionaryId();
+		const std::uint32_t dictionaryVersion = dictionary->dictionaryVersion();
+
+		// copy on write, readers keep the old snapshot until they let it go
+		std::shared_ptr<Snapshot> next = std::make_shared<Snapshot>(*snapshot());
+		next->dictionaries_[key(dictionaryId, dictionaryVersion)] = dictionary;
+
+		std::map<std::uint32_t, std::uint32_t>::iterator found = next->current_.find(dictionaryId);
+		if (found == next->current_.end() || found->second <= dictionaryVersion) {
+
+			next->current_[dictionaryId] = dictionaryVersion;
+
+		} // end if
+
+		std::atomic_store(&snapshot_, std::shared_ptr<const Snapshot>(next));
+
+	} // end if
+
+	return published;
+
+} // End of publish
+
+/** retire
+@pre None
+@post version removed, the highest remaining version of the ID becomes current
+@parm std::uint32_t [dictionaryId], std::uint32_t [dictionaryVersion]
+@return true if the version was registered*/
+bool DictionaryRegistry::retire(std::uint32_t dictionaryId, std::uint32_t dictionaryVersion) {
+
+	std::lock_guard<std::mutex> lock(updateMutex_);
+
+	std::shared_ptr<const Snapshot> previous = snapshot();
+	bool retired = previous->dictionaries_.count(key(dictionaryId, dictionaryVersion)) > 0;
+
+	if (retired) {
+
+		std::shared_ptr<Snapshot> next = std::make_shared<Snapshot>(*previous);
+		next->dictionaries_.erase(key(dictionaryId, dictionaryVersion));
+		next->current_.erase(dictionaryId);
+
+		// versions of an ID are adjacent keys, the last one left is the highest
+		std::map<std::uint64_t, std::shared_ptr<const CodebookDictionary> >::iterator highest =
+			next->dictionaries_.upper_bound(key(dictionaryId, 0xFFFFFFFFu));
+		if (highest != next->dictionaries_.begin()) {
+
+			--highest;
+			if ((highest->first >> 32) == dictionaryId) {
+
+				next->current_[dictionaryId] = static_cast<std::uint32_t>(highest->first);
+
+			} // end if
+
+		} // end if
+
+		std::atomic_store(&snapshot_, std::shared_ptr<const Snapshot>(next));
+
+	} // end if
+
+	return retired;
+
+} // End of retire
+
+/** encodeMessage
+@pre None
+@post None
+@parm std::uint32_t [dictionaryId], std::string [in], std::vector<unsigned char> [message]
+passed by reference
+@return true if the ID has a current version, message then holds in encoded with it*/
+bool DictionaryRegistry::encodeMessage(std::uint32_t dictionaryId, const std::string& in,
+	std::vector<unsigned char>& message) const {
+
+	std::shared_ptr<const CodebookDictionary> dictionary = current(dictionaryId);
+	bool encoded = dictionary != nullptr;
+
+	if (encoded) {
+
+		message = dictionary->encodeMessage(in);
+
+	} // end if
+
+	return encoded;
+
+} // End of encodeMessage
+
+/** decodeMessage
+@pre None
+@post None
+@parm unsigned char* [message], std::size_t [size], std::string [text] passed by reference
+@return true if the message is complete and its dictionary version is registered*/
+bool DictionaryRegistry::decodeMessage(const unsigned char* message, std::size_t size, std::string& text) const {
+
+	std::uint32_t dictionaryId = 0;
+	std::uint32_t dictionaryVersion = 0;
+	std::uint64_t bitCount = 0;
+
+	bool decoded = CodebookDictionary::readMessageHeader(message, size, dictionaryId, dictionaryVersion, bitCount);
+
+	if (decoded) {
+
+		// held for the whole decode, a concurrent retire cannot free it
+		std::shared_ptr<const CodebookDictionary> dictionary = find(dictionaryId, dictionaryVersion);
+		decoded = dictionary != nullptr;
+
+		if (decoded) {
+
+			text = dictionary->decode(message + DICTIONARY_MESSAGE_HEADER_SIZE, bitCount);
+
+		} // end if
+
+	} // end if
+
+	return decoded;
+
+} // End of decodeMessage
+
+/** current
+@pre None
+@post None
+@parm std::uint32_t [dictionaryId]
+@return current version of the ID, nullptr if none*/
+std::shared_ptr<const CodebookDictionary> DictionaryRegistry::current(std::uint32_t dictionaryId) const {
+
+	std::shared_ptr<const Snapshot> published = snapshot();
+	std::shared_ptr<const CodebookDictionary> dictionary{};
+
+	std::map<std::uint32_t, std::uint32_t>::const_iterator version = published->current_.find(dictionaryId);
+	if (version != published->current_.end()) {
+
+		dictionary = published->dictionaries_.at(key(dictionaryId, version->second));
+
+	} // end if
+
+	return dictionary;
+
+} // End of current
+
+/** find
+@pre None
+@post None
+@parm std::uint32_t [dictionaryId], std::uint32_t [dictionaryVersion]
+@return that version of the ID, nullptr if it is not registered*/
+std::shared_ptr<const CodebookDictionary> DictionaryRegistry::find(std::uint32_t dictionaryId,
+	std::uint32_t dictionaryVersion) const {
+
+	std::shared_ptr<const Snapshot> published = snapshot();
+	std::shared_ptr<const CodebookDictionary> dictionary{};
+
+	std::map<std::uint64_t, std::shared_ptr<const CodebookDictionary> >::const_iterator found =
+		published->dictionaries_.find(key(dictionaryId, dictionaryVersion));
+	if (found != published->dictionaries_.end()) {
+
+		dictionary = found->second;
+
+	} // end if
+
+	return dictionary;
+
+} // End of find
+
+/** size
+@return number of registered dictionary versions*/
+std::size_t DictionaryRegistry::size() const {
+
+	return snapshot()->dictionaries_.size();
+
+} // End of size
+
+/** snapshot
+@return the published snapshot*/
+std::shared_ptr<const DictionaryRegistry::Snapshot> DictionaryRegistry::snapshot() const {
+
+	return std::atomic_load(&snapshot_);
+
+} // End of snapshot
+
+/** key
+@return map key of an ID and version*/
+std::uint64_t DictionaryRegistry::key(std::uint32_t dictionaryId, std::uint32_t dictionaryVersion) {
+
+	return (static_cast<std::uint64_t>(dictionaryId) << 32) | dictionaryVersion;
+
+} // End of key
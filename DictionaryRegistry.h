@@ -0,0 +1,132 @@
+/** @file DictionaryRegistry.h
+ @author Anthony Campos
+ @date 10/19/2026
+ This header class file implements a DictionaryRegistry, the set of loaded CodebookDictionary
+ objects that messages reference by dictionary ID and version */
+
+	//---------------------------------------------------------------------------
+	// DictionaryRegistry class:  hot swappable CodebookDictionary lookup
+	//   included features:
+	//   -- allows for publishing a new dictionary version, which becomes the
+	//			current version of its ID, and retiring old versions
+	//   -- lookups read an immutable snapshot through one atomic load, they
+	//			never wait for a publish or retire
+	//   -- a dictionary handed to a reader stays alive until the reader lets it
+	//			go, even after it is replaced or retired
+	//   -- allows for encoding with the current version of an ID and decoding
+	//			any message whose version is still registered
+	//
+	// Assumptions:
+	//   --  any number of threads may look up, publish and retire are serialized
+	//---------------------------------------------------------------------------
+
+#pragma once
+
+// Included libraries
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// included .h files
+#include "CodebookDictionary.h"
+
+
+class DictionaryRegistry {
+
+public:
+
+	/** Constructors */
+
+	/** Defualt Constructor
+	@pre None
+	@post Empty DictionaryRegistry Object created*/
+	DictionaryRegistry();
+
+	/** Copy Constructor & Assignment disabled, snapshots are shared with readers */
+	DictionaryRegistry(const DictionaryRegistry& sourceRegistry) = delete;
+	DictionaryRegistry& operator=(const DictionaryRegistry& rhsRegistry) = delete;
+
+	/** Public Methods */
+
+	/** publish
+	@pre None
+	@post dictionary registered, it becomes the current version of its ID unless a
+	higher version is already current
+	@parm std::shared_ptr<const CodebookDictionary> [dictionary]
+	@return false if dictionary is empty or not loaded*/
+	bool publish(std::shared_ptr<const CodebookDictionary> dictionary);
+
+	/** retire
+	@pre None
+	@post version removed, the highest remaining version of the ID becomes current
+	@parm std::uint32_t [dictionaryId], std::uint32_t [dictionaryVersion]
+	@return true if the version was registered*/
+	bool retire(std::uint32_t dictionaryId, std::uint32_t dictionaryVersion);
+
+	/** encodeMessage
+	@pre None
+	@post None
+	@parm std::uint32_t [dictionaryId], std::string [in], std::vector<unsigned char> [message]
+	passed by reference
+	@return true if the ID has a current version, message then holds in encoded with it*/
+	bool encodeMessage(std::uint32_t dictionaryId, const std::string& in, std::vector<unsigned char>& message) const;
+
+	/** decodeMessage
+	@pre None
+	@post None
+	@parm unsigned char* [message], std::size_t [size], std::string [text] passed by reference
+	@return true if the message is complete and its dictionary version is registered*/
+	bool decodeMessage(const unsigned char* message, std::size_t size, std::string& text) const;
+
+	/** Accessor Methods */
+
+	/** current
+	@pre None
+	@post None
+	@parm std::uint32_t [dictionaryId]
+	@return current version of the ID, nullptr if none*/
+	std::shared_ptr<const CodebookDictionary> current(std::uint32_t dictionaryId) const;
+
+	/** find
+	@pre None
+	@post None
+	@parm std::uint32_t [dictionaryId], std::uint32_t [dictionaryVersion]
+	@return that version of the ID, nullptr if it is not registered*/
+	std::shared_ptr<const CodebookDictionary> find(std::uint32_t dictionaryId, std::uint32_t dictionaryVersion) const;
+
+	/** size
+	@return number of registered dictionary versions*/
+	std::size_t size() const;
+
+private:
+
+	// Immutable once published, every change publishes a modified copy
+	struct Snapshot {
+
+		// keyed by ID << 32 | version
+		std::map<std::uint64_t, std::shared_ptr<const CodebookDictionary> > dictionaries_;
+		// ID -> current version
+		std::map<std::uint32_t, std::uint32_t> current_;
+
+	}; // end of Snapshot
+
+	/** Private Attributes */
+
+	std::mutex updateMutex_; // serializes publish and retire, readers never take it
+	std::shared_ptr<const Snapshot> snapshot_; // atomic access only
+
+	/** Private Methods */
+
+	/** snapshot
+	@return the published snapshot*/
+	std::shared_ptr<const Snapshot> snapshot() const;
+
+	/** key
+	@return map key of an ID and version*/
+	static std::uint64_t key(std::uint32_t dictionaryId, std::uint32_t dictionaryVersion);
+
+}; // End of DictionaryRegistry
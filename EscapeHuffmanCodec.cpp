@@ -0,0 +1,456 @@
+/** @file EscapeHuffmanCodec.cpp
+ @author Anthony Campos
+ @date 10/19/2026
+ This implementation file implements an EscapeHuffmanCodec, Huffman Coding over 32 bit symbols where
+ only the most frequent symbols get a code and the rest are sent as an escape code and a literal */
+
+//---------------------------------------------------------------------------
+// EscapeHuffmanCodec class:  Huffman Coding with a small code table
+//   included features:
+//   -- the K most frequent symbols and one escape symbol are coded by a
+//			SparseHuffmanCodec, every other symbol is the escape code
+//			followed by a literal
+//   -- a literal is either the symbol in a fixed number of raw bits (enough
+//			for the largest escaped symbol) or the Elias gamma code of
+//			symbol + 1, whichever the counts say is shorter
+//   -- K is picked by the estimated total cost: the entropy of the kept
+//			symbols and the escape, the literal bits, and entryBits per
+//			table entry for the header. A larger entryBits gives a smaller
+//			table, maxTableSymbols caps it outright
+//   -- the escape symbol is the smallest value not kept in the table, so
+//			every 32 bit symbol stays encodable
+//
+// Assumptions:
+//   --  symbols that had no count when the codec was built are encoded as
+//			literals if there is an escape code (some symbol was escaped)
+//			and, for RAW_LITERAL, they fit in literalBits. Otherwise they
+//			are skipped
+//---------------------------------------------------------------------------
+
+
+// included .h files
+#include "EscapeHuffmanCodec.h"
+
+// Included libraries
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <utility>
+
+
+namespace {
+
+	// most 0 bits before the leading 1 of a gamma coded symbol + 1 (which is at most 2^32)
+	const int MAX_LITERAL_GAMMA_ZEROS = 32;
+
+	/** bitWidth: bits needed to write value, at least 1 */
+	int bitWidth(std::uint64_t value) {
+
+		int width = 1;
+		while ((value >> width) != 0) {
+			++width;
+		} // end while
+
+		return width;
+
+	} // End of bitWidth
+
+	/** gammaLength: bits of the Elias gamma code of symbol + 1 */
+	int gammaLength(std::uint32_t symbol) {
+
+		return 2 * bitWidth(static_cast<std::uint64_t>(symbol) + 1) - 1;
+
+	} // End of gammaLength
+
+} // end of namespace
+
+
+/** Constructor
+@pre entryBits >= 0, maxTableSymbols >= 0
+@post EscapeHuffmanCodec Object created, table size picked from the symbol counts of text
+@parm std::vector<std::uint32_t> [text] symbols to count, int [entryBits] header bits per table entry,
+int [maxTableSymbols] most symbols kept in the table, UNLIMITED_TABLE_SYMBOLS for no cap*/
+EscapeHuffmanCodec::EscapeHuffmanCodec(const std::vector<std::uint32_t>& text, int entryBits, int maxTableSymbols)
+	:tableSymbols_(0), hasEscape_(false), escapeSymbol_(0), literalMode_(RAW_LITERAL), literalBits_(1),
+	estimatedBits_(0) {
+
+	std::unordered_map<std::uint32_t, long long> histogram;
+
+	for (unsigned int i = 0; i < text.size(); ++i) {
+
+		++histogram[text[i]];
+
+	} // end for
+
+	std::vector<std::uint32_t> symbols;
+	std::vector<long long> counts;
+	symbols.reserve(histogram.size());
+	counts.reserve(histogram.size());
+
+	for (const auto& entry : histogram) {
+
+		symbols.push_back(entry.first);
+		counts.push_back(entry.second);
+
+	} // end for
+
+	build(symbols, counts, entryBits, maxTableSymbols);
+
+} // End of Constructor
+
+/** Constructor
+@pre symbols are distinct, counts.size() == symbols.size(), counts >= 0 & their sum < 2^62,
+entryBits >= 0, maxTableSymbols >= 0
+@post EscapeHuffmanCodec Object created, table size picked from counts
+@parm std::vector<std::uint32_t> [symbols], std::vector<long long> [counts], int [entryBits],
+int [maxTableSymbols]*/
+EscapeHuffmanCodec::EscapeHuffmanCodec(const std::vector<std::uint32_t>& symbols, const std::vector<long long>& counts,
+	int entryBits, int maxTableSymbols)
+	:tableSymbols_(0), hasEscape_(false), escapeSymbol_(0), literalMode_(RAW_LITERAL), literalBits_(1),
+	estimatedBits_(0) {
+
+	build(symbols, counts, entryBits, maxTableSymbols);
+
+} // End of Constructor
+
+/** build
+@pre as the symbol/count constructor
+@post table size and literal mode picked, codec_ built
+@parm std::vector<std::uint32_t> [symbols], std::vector<long long> [counts], int [entryBits],
+int [maxTableSymbols]*/
+void EscapeHuffmanCodec::build(const std::vector<std::uint32_t>& symbols, const std::vector<long long>& counts,
+	int entryBits, int maxTableSymbols) {
+
+	// most frequent first, ties by symbol so the same histogram gives the same table
+	std::vector<std::pair<std::uint32_t, long long>> present;
+	long long total = 0;
+
+	for (unsigned int i = 0; i < symbols.size(); ++i) {
+
+		if (counts[i] > 0) {
+
+			present.push_back(std::make_pair(symbols[i], counts[i]));
+			total += counts[i];
+
+		} // end if
+
+	} // end for
+
+	std::sort(present.begin(), present.end(),
+		[](const std::pair<std::uint32_t, long long>& a, const std::pair<std::uint32_t, long long>& b) {
+			return a.second != b.second ? a.second > b.second : a.first < b.first;
+		});
+
+	const int n = static_cast<int>(present.size());
+
+	// suffix totals over the symbols that are escaped when the first K are kept
+	std::vector<long long> escapedCount(n + 1, 0);
+	std::vector<std::uint32_t> escapedMax(n + 1, 0);
+	std::vector<long long> escapedGamma(n + 1, 0);
+
+	for (int i = n - 1; i >= 0; --i) {
+
+		escapedCount[i] = escapedCount[i + 1] + present[i].second;
+		escapedMax[i] = std::max(escapedMax[i + 1], present[i].first);
+		escapedGamma[i] = escapedGamma[i + 1] + present[i].second * gammaLength(present[i].first);
+
+	} // end for
+
+	int limit = n;
+	if (maxTableSymbols != UNLIMITED_TABLE_SYMBOLS && maxTableSymbols < n) {
+		limit = maxTableSymbols;
+	} // end if
+
+	int bestK = 0;
+	double bestCost = 0;
+	double keptBits = 0; // entropy of the first K symbols
+
+	for (int k = 0; k <= limit; ++k) {
+
+		const long long escaped = escapedCount[k];
+		const int entries = k + (escaped > 0 ? 1 : 0);
+
+		double codeBits = keptBits;
+		long long literalBits = 0;
+
+		if (escaped > 0) {
+
+			codeBits += escaped * std::log2(static_cast<double>(total) / escaped);
+			literalBits = std::min(escaped * bitWidth(escapedMax[k]), escapedGamma[k]);
+
+		} // end if
+
+		// a lone table entry still takes a one bit code
+		if (entries == 1) {
+			codeBits = static_cast<double>(total);
+		} // end if
+
+		const double cost = codeBits + static_cast<double>(literalBits) + static_cast<double>(entries) * entryBits;
+
+		if (k == 0 || cost < bestCost) {
+
+			bestK = k;
+			bestCost = cost;
+
+		} // end if
+
+		if (k < n) {
+			keptBits += present[k].second * std::log2(static_cast<double>(total) / present[k].second);
+		} // end if
+
+	} // end for
+
+	tableSymbols_ = bestK;
+	hasEscape_ = escapedCount[bestK] > 0;
+	estimatedBits_ = n > 0 ? bestCost : 0;
+
+	std::vector<std::uint32_t> tableSymbols;
+	std::vector<long long> tableCounts;
+
+	for (int i = 0; i < bestK; ++i) {
+
+		tableSymbols.push_back(present[i].first);
+		tableCounts.push_back(present[i].second);
+
+	} // end for
+
+	if (hasEscape_) {
+
+		literalBits_ = bitWidth(escapedMax[bestK]);
+		literalMode_ = escapedGamma[bestK] < escapedCount[bestK] * literalBits_ ? GAMMA_LITERAL : RAW_LITERAL;
+
+		// escape takes the smallest value that is not kept
+		std::vector<std::uint32_t> kept(tableSymbols);
+		std::sort(kept.begin(), kept.end());
+
+		escapeSymbol_ = 0;
+		for (unsigned int i = 0; i < kept.size() && kept[i] == escapeSymbol_; ++i) {
+			++escapeSymbol_;
+		} // end for
+
+		tableSymbols.push_back(escapeSymbol_);
+		tableCounts.push_back(escapedCount[bestK]);
+
+	} // end if
+
+	codec_ = SparseHuffmanCodec(tableSymbols, tableCounts);
+
+} // End of build
+
+/** encodeSymbol
+@pre None
+@post code of symbol, or the escape code and its literal, appended to writer
+@parm std::uint32_t [symbol], BitWriter [writer] passed by reference
+@return true if symbol was written, false if it has no code and cannot be sent as a literal*/
+bool EscapeHuffmanCodec::encodeSymbol(std::uint32_t symbol, BitWriter& writer) const {
+
+	bool written = false;
+
+	// the escape symbol's own value is always a literal
+	if (!hasEscape_ || symbol != escapeSymbol_) {
+		written = codec_.encodeSymbol(symbol, writer);
+	} // end if
+
+	if (!written && hasEscape_ && (literalMode_ == GAMMA_LITERAL || bitWidth(symbol) <= literalBits_)) {
+
+		codec_.encodeSymbol(escapeSymbol_, writer);
+		writeLiteral(symbol, writer);
+		written = true;
+
+	} // end if
+
+	return written;
+
+} // End of encodeSymbol
+
+/** decodeSymbol
+@pre reader is at the start of a code made by this codec
+@post reader moved past the code and its literal if they are complete
+@parm BitReader [reader] passed by reference, std::uint32_t [symbol] passed by reference
+@return true if a symbol was decoded, false if the bits left are not a complete code*/
+bool EscapeHuffmanCodec::decodeSymbol(BitReader& reader, std::uint32_t& symbol) const {
+
+	BitReader lookAhead = reader;
+	bool decoded = codec_.decodeSymbol(lookAhead, symbol);
+
+	if (decoded && hasEscape_ && symbol == escapeSymbol_) {
+
+		decoded = readLiteral(lookAhead, symbol);
+
+	} // end if
+
+	if (decoded) {
+
+		reader = lookAhead;
+
+	} // end if
+
+	return decoded;
+
+} // End of decodeSymbol
+
+/** writeLiteral
+@pre None
+@post literal of symbol appended to writer
+@parm std::uint32_t [symbol], BitWriter [writer] passed by reference*/
+void EscapeHuffmanCodec::writeLiteral(std::uint32_t symbol, BitWriter& writer) const {
+
+	if (literalMode_ == GAMMA_LITERAL) {
+
+		// Elias gamma: one 0 per bit after the leading 1, then symbol + 1 itself
+		const std::uint64_t value = static_cast<std::uint64_t>(symbol) + 1;
+		const int zeros = bitWidth(value) - 1;
+
+		writer.writeBits(0, zeros);
+		writer.writeBits(value, zeros + 1);
+
+	}
+	else {
+
+		writer.writeBits(symbol, literalBits_);
+
+	} // end if
+
+} // End of writeLiteral
+
+/** readLiteral
+@pre None
+@post reader moved past the literal if it is complete
+@parm BitReader [reader] passed by reference, std::uint32_t [symbol] passed by reference
+@return true if a complete literal was read*/
+bool EscapeHuffmanCodec::readLiteral(BitReader& reader, std::uint32_t& symbol) const {
+
+	bool complete = false;
+
+	if (literalMode_ == GAMMA_LITERAL) {
+
+		int zeros = 0;
+		while (reader.remaining() > 0 && zeros <= MAX_LITERAL_GAMMA_ZEROS && reader.peekBits(1) == 0) {
+
+			reader.skipBits(1);
+			++zeros;
+
+		} // end while
+
+		if (zeros <= MAX_LITERAL_GAMMA_ZEROS && reader.remaining() >= static_cast<std::uint64_t>(zeros + 1)) {
+
+			const std::uint64_t value = reader.readBits(zeros + 1);
+			complete = value - 1 <= 0xFFFFFFFFu;
+			symbol = static_cast<std::uint32_t>(value - 1);
+
+		} // end if
+
+	}
+	else if (reader.remaining() >= static_cast<std::uint64_t>(literalBits_)) {
+
+		symbol = static_cast<std::uint32_t>(reader.readBits(literalBits_));
+		complete = true;
+
+	} // end if
+
+	return complete;
+
+} // End of readLiteral
+
+/** encode
+@pre None
+@post every symbol of text is encoded, symbols encodeSymbol rejects are skipped
+@parm std::vector<std::uint32_t> [text], std::uint64_t [bitCount] passed by reference
+@return packed code, bitCount holds the number of code bits in it*/
+std::vector<unsigned char> EscapeHuffmanCodec::encode(const std::vector<std::uint32_t>& text, std::uint64_t& bitCount) const {
+
+	BitWriter writer;
+
+	for (unsigned int i = 0; i < text.size(); ++i) {
+
+		encodeSymbol(text[i], writer);
+
+	} // end for
+
+	writer.finish();
+	bitCount = writer.bitCount();
+
+	std::vector<unsigned char> code;
+	writer.swapBytes(code);
+
+	return code;
+
+} // End of encode
+
+/** decode
+@pre code was made by encode of the current codec
+@post None, decoding stops at the first incomplete code
+@parm std::vector<unsigned char> [code], std::uint64_t [bitCount]
+@return the decoded symbols*/
+std::vector<std::uint32_t> EscapeHuffmanCodec::decode(const std::vector<unsigned char>& code, std::uint64_t bitCount) const {
+
+	std::vector<std::uint32_t> text;
+	BitReader reader(code.data(), bitCount);
+	std::uint32_t symbol = 0;
+
+	while (decodeSymbol(reader, symbol)) {
+
+		text.push_back(symbol);
+
+	} // end while
+
+	return text;
+
+} // End of decode
+
+/** tableSymbols
+@return number of symbols with their own code, the escape excluded*/
+int EscapeHuffmanCodec::tableSymbols() const {
+
+	return tableSymbols_;
+
+} // End of tableSymbols
+
+/** hasEscape
+@return true if some symbol is sent as a literal*/
+bool EscapeHuffmanCodec::hasEscape() const {
+
+	return hasEscape_;
+
+} // End of hasEscape
+
+/** escapeSymbol
+@return symbol value the table uses for the escape code*/
+std::uint32_t EscapeHuffmanCodec::escapeSymbol() const {
+
+	return escapeSymbol_;
+
+} // End of escapeSymbol
+
+/** literalMode
+@return how literals are written*/
+EscapeHuffmanCodec::LiteralMode EscapeHuffmanCodec::literalMode() const {
+
+	return literalMode_;
+
+} // End of literalMode
+
+/** literalBits
+@return width of a RAW_LITERAL*/
+int EscapeHuffmanCodec::literalBits() const {
+
+	return literalBits_;
+
+} // End of literalBits
+
+/** estimatedBits
+@return estimated cost of the counts the codec was built from: code bits, literal bits and
+table entries, the quantity K was picked to minimize*/
+double EscapeHuffmanCodec::estimatedBits() const {
+
+	return estimatedBits_;
+
+} // End of estimatedBits
+
+/** codec
+@return the code table of the kept symbols and the escape*/
+const SparseHuffmanCodec& EscapeHuffmanCodec::codec() const {
+
+	return codec_;
+
+} // End of codec
@@ -0,0 +1,173 @@
+/** @file EscapeHuffmanCodec.h
+ @author Anthony Campos
+ @date 10/19/2026
+ This header class file implements an EscapeHuffmanCodec, Huffman Coding over 32 bit symbols where
+ only the most frequent symbols get a code and the rest are sent as an escape code and a literal */
+
+	//---------------------------------------------------------------------------
+	// EscapeHuffmanCodec class:  Huffman Coding with a small code table
+	//   included features:
+	//   -- the K most frequent symbols and one escape symbol are coded by a
+	//			SparseHuffmanCodec, every other symbol is the escape code
+	//			followed by a literal
+	//   -- a literal is either the symbol in a fixed number of raw bits (enough
+	//			for the largest escaped symbol) or the Elias gamma code of
+	//			symbol + 1, whichever the counts say is shorter
+	//   -- K is picked by the estimated total cost: the entropy of the kept
+	//			symbols and the escape, the literal bits, and entryBits per
+	//			table entry for the header. A larger entryBits gives a smaller
+	//			table, maxTableSymbols caps it outright
+	//   -- the escape symbol is the smallest value not kept in the table, so
+	//			every 32 bit symbol stays encodable
+	//
+	// Assumptions:
+	//   --  symbols that had no count when the codec was built are encoded as
+	//			literals if there is an escape code (some symbol was escaped)
+	//			and, for RAW_LITERAL, they fit in literalBits. Otherwise they
+	//			are skipped
+	//---------------------------------------------------------------------------
+
+#pragma once
+
+// Included libraries
+#include <cstdint>
+#include <vector>
+
+// included .h files
+#include "BitStream.h"
+#include "SparseHuffmanCodec.h"
+
+// Header bits charged per code table entry: a 32 bit symbol and a code length byte
+const int DEFAULT_ESCAPE_ENTRY_BITS = 40;
+
+// maxTableSymbols value that lets the cost estimate alone pick the table size
+const int UNLIMITED_TABLE_SYMBOLS = 0;
+
+
+class EscapeHuffmanCodec {
+
+public:
+
+	// how an escaped symbol is written after the escape code
+	enum LiteralMode {
+
+		RAW_LITERAL, // literalBits raw bits
+		GAMMA_LITERAL // Elias gamma code of symbol + 1
+
+	}; // end of LiteralMode
+
+	/** Constructors */
+
+	/** Constructor
+	@pre entryBits >= 0, maxTableSymbols >= 0
+	@post EscapeHuffmanCodec Object created, table size picked from the symbol counts of text
+	@parm std::vector<std::uint32_t> [text] symbols to count, int [entryBits] header bits per table entry,
+	int [maxTableSymbols] most symbols kept in the table, UNLIMITED_TABLE_SYMBOLS for no cap*/
+	explicit EscapeHuffmanCodec(const std::vector<std::uint32_t>& text, int entryBits = DEFAULT_ESCAPE_ENTRY_BITS,
+		int maxTableSymbols = UNLIMITED_TABLE_SYMBOLS);
+
+	/** Constructor
+	@pre symbols are distinct, counts.size() == symbols.size(), counts >= 0 & their sum < 2^62,
+	entryBits >= 0, maxTableSymbols >= 0
+	@post EscapeHuffmanCodec Object created, table size picked from counts
+	@parm std::vector<std::uint32_t> [symbols], std::vector<long long> [counts], int [entryBits],
+	int [maxTableSymbols]*/
+	EscapeHuffmanCodec(const std::vector<std::uint32_t>& symbols, const std::vector<long long>& counts,
+		int entryBits = DEFAULT_ESCAPE_ENTRY_BITS, int maxTableSymbols = UNLIMITED_TABLE_SYMBOLS);
+
+	/** Public Methods */
+
+	/** encodeSymbol
+	@pre None
+	@post code of symbol, or the escape code and its literal, appended to writer
+	@parm std::uint32_t [symbol], BitWriter [writer] passed by reference
+	@return true if symbol was written, false if it has no code and cannot be sent as a literal*/
+	bool encodeSymbol(std::uint32_t symbol, BitWriter& writer) const;
+
+	/** decodeSymbol
+	@pre reader is at the start of a code made by this codec
+	@post reader moved past the code and its literal if they are complete
+	@parm BitReader [reader] passed by reference, std::uint32_t [symbol] passed by reference
+	@return true if a symbol was decoded, false if the bits left are not a complete code*/
+	bool decodeSymbol(BitReader& reader, std::uint32_t& symbol) const;
+
+	/** encode
+	@pre None
+	@post every symbol of text is encoded, symbols encodeSymbol rejects are skipped
+	@parm std::vector<std::uint32_t> [text], std::uint64_t [bitCount] passed by reference
+	@return packed code, bitCount holds the number of code bits in it*/
+	std::vector<unsigned char> encode(const std::vector<std::uint32_t>& text, std::uint64_t& bitCount) const;
+
+	/** decode
+	@pre code was made by encode of the current codec
+	@post None, decoding stops at the first incomplete code
+	@parm std::vector<unsigned char> [code], std::uint64_t [bitCount]
+	@return the decoded symbols*/
+	std::vector<std::uint32_t> decode(const std::vector<unsigned char>& code, std::uint64_t bitCount) const;
+
+	/** Accessor Methods */
+
+	/** tableSymbols
+	@return number of symbols with their own code, the escape excluded*/
+	int tableSymbols() const;
+
+	/** hasEscape
+	@return true if some symbol is sent as a literal*/
+	bool hasEscape() const;
+
+	/** escapeSymbol
+	@return symbol value the table uses for the escape code*/
+	std::uint32_t escapeSymbol() const;
+
+	/** literalMode
+	@return how literals are written*/
+	LiteralMode literalMode() const;
+
+	/** literalBits
+	@return width of a RAW_LITERAL*/
+	int literalBits() const;
+
+	/** estimatedBits
+	@return estimated cost of the counts the codec was built from: code bits, literal bits and
+	table entries, the quantity K was picked to minimize*/
+	double estimatedBits() const;
+
+	/** codec
+	@return the code table of the kept symbols and the escape*/
+	const SparseHuffmanCodec& codec() const;
+
+private:
+
+	/** Private Attributes */
+	SparseHuffmanCodec codec_; // kept symbols and the escape
+	int tableSymbols_;
+	bool hasEscape_;
+	std::uint32_t escapeSymbol_;
+	LiteralMode literalMode_;
+	int literalBits_;
+	double estimatedBits_;
+
+	/** Private Methods */
+
+	/** build
+	@pre as the symbol/count constructor
+	@post table size and literal mode picked, codec_ built
+	@parm std::vector<std::uint32_t> [symbols], std::vector<long long> [counts], int [entryBits],
+	int [maxTableSymbols]*/
+	void build(const std::vector<std::uint32_t>& symbols, const std::vector<long long>& counts,
+		int entryBits, int maxTableSymbols);
+
+	/** writeLiteral
+	@pre None
+	@post literal of symbol appended to writer
+	@parm std::uint32_t [symbol], BitWriter [writer] passed by reference*/
+	void writeLiteral(std::uint32_t symbol, BitWriter& writer) const;
+
+	/** readLiteral
+	@pre None
+	@post reader moved past the literal if it is complete
+	@parm BitReader [reader] passed by reference, std::uint32_t [symbol] passed by reference
+	@return true if a complete literal was read*/
+	bool readLiteral(BitReader& reader, std::uint32_t& symbol) const;
+
+}; // End of EscapeHuffmanCodec
@@ -8,8 +8,18 @@
 // HuffmanAlgorithm class:  Huffman Coding implementation
 //   included features:
 //   -- allows construction by int array that represents char counts for 'a' - 'z' 
+//   -- allows construction by 64 bit counts, optionally normalized to a fixed
+//			precision before the tree is built
+//   -- allows for alphabetic codes (ALPHABETIC_ORDER), whose codes sort like the
+//			letters, so packed codes compare like the text (see compareCodes)
 //   -- allows for input text/string to be encoded by the HuffmanTree codeTree
 //   -- allows for decipher of a input code per the HuffmanTree codeTree
+//   -- exposes each code as bits (codeBits, codeLength) and the code tree as
+//			flat arrays (flatten, branches), for coders that keep their own tables
+//   -- allows for encoding to and decoding from packed bits, decoding up to
+//			DECODE_TABLE_BITS bits with a single table lookup
+//   -- construction, encoding and decoding phases are timed by PhaseTimer.h
+//			when HUFFMAN_ENABLE_TRACING is defined
 //
 // Assumptions:
 //   --  index 0-25 represents 'a' - 'z' .
@@ -19,6 +29,11 @@
 
 // included .h files
 #include "HuffmanAlgorithm.h"
+#include "BitPacking.h"
+#include "PhaseTimer.h"
+
+// Included libraries
+#include <cstring>
 
 /** Overloaded Ostream Method
 diplays the HuffmanAlgorithm object to ostream stream
@@ -86,62 +101,243 @@ std::ostream& operator<<(std::ostream& out, const HuffmanAlgorithm& object) {
 @post HuffmanAlgorithm Object is created, construct the Huffman tree, codeTree_ and computes the code
 for each character, computed codes stored in codebook_.
 @parm int* [] [count], frequency for each letter from 'a' to 'z'.*/
-HuffmanAlgorithm::HuffmanAlgorithm(int(&counts)[NUM_LETTERS]) {
+HuffmanAlgorithm::HuffmanAlgorithm(int(&counts)[NUM_LETTERS])
+	:codeOrder_(FREQUENCY_ORDER) {
+
+	long long wideCounts[NUM_LETTERS];
+
+	for (int i = 0; i < NUM_LETTERS; ++i) {
+
+		wideCounts[i] = counts[i];
+
+	} // End of for
+
+	build(wideCounts);
+
+} // End of Constructor 
+
+/** Constructor
+@pre all indexes must have a integer value >= 0, their sum < 2^63, 0 <= precisionBits < 63
+@post HuffmanAlgorithm Object is created, construct the Huffman tree, codeTree_ and computes the code
+for each character, computed codes stored in codebook_. Unless precisionBits is NO_NORMALIZATION
+the counts are first normalized with normalizeCounts
+@parm long long* [] [count], frequency for each letter from 'a' to 'z',
+int [precisionBits], total the counts are scaled down to, as a power of 2,
+CodeOrder [order], ALPHABETIC_ORDER for codes that sort like the letters*/
+HuffmanAlgorithm::HuffmanAlgorithm(long long(&counts)[NUM_LETTERS], int precisionBits, CodeOrder order)
+	:codeOrder_(order) {
+
+	if (precisionBits == NO_NORMALIZATION) {
+
+		build(counts);
+
+	}
+	else {
+
+		long long normalized[NUM_LETTERS];
+		for (int i = 0; i < NUM_LETTERS; ++i) {
+
+			normalized[i] = counts[i];
+
+		} // End of for
+
+		normalizeCounts(normalized, precisionBits);
+		build(normalized);
+
+	} // End if
+
+} // End of Constructor 
+
+/** normalizeCounts
+@pre all indexes must have a integer value >= 0, 0 < precisionBits < 63
+@post if the counts sum past 2^precisionBits, every count is divided by the same power of 2
+(rounded to nearest) so the sum is about 2^precisionBits. Letters that occurred keep a count
+of at least 1. The same counts always give the same result
+@parm long long* [] [count] passed by reference, int [precisionBits]*/
+void HuffmanAlgorithm::normalizeCounts(long long(&counts)[NUM_LETTERS], int precisionBits) {
+
+	unsigned long long total = 0;
+	for (int i = 0; i < NUM_LETTERS; ++i) {
+
+		total += counts[i];
+
+	} // End of for
+
+	// smallest shift that brings the total down to precisionBits bits
+	int shift = 0;
+	while ((total >> shift) > (1ULL << precisionBits)) {
+
+		++shift;
+
+	} // end while
+
+	if (shift > 0) {
+
+		const long long half = 1LL << (shift - 1);
+
+		for (int i = 0; i < NUM_LETTERS; ++i) {
+
+			if (counts[i] > 0) {
+
+				long long scaled = (counts[i] >> shift) + ((counts[i] & half) != 0 ? 1 : 0);
+				counts[i] = (scaled > 0) ? scaled : 1;
+
+			} // End if
+
+		} // End of for
+
+	} // End if
+
+} // End of normalizeCounts
+
+/** compareCodes compares two packed codes bit by bit, a code that is a prefix of the
+other sorts first
+@pre None
+@post None
+@parm PackedCode [lhs], PackedCode [rhs]
+@return < 0, 0 or > 0 as lhs sorts before, with or after rhs. For codes of an
+ALPHABETIC_ORDER codebook that is the order of the texts they encode*/
+int HuffmanAlgorithm::compareCodes(const PackedCode& lhs, const PackedCode& rhs) {
+
+	const std::uint64_t commonBits = (lhs.bitCount_ < rhs.bitCount_) ? lhs.bitCount_ : rhs.bitCount_;
+	const std::size_t wholeBytes = static_cast<std::size_t>(commonBits / 8);
+
+	// whole bytes first, padding bits are 0 so only the common bits of the last byte count
+	int order = (wholeBytes > 0) ? std::memcmp(lhs.bytes_.data(), rhs.bytes_.data(), wholeBytes) : 0;
+
+	const int tailBits = static_cast<int>(commonBits % 8);
+	if (order == 0 && tailBits > 0) {
+
+		const unsigned int mask = (0xFFu << (8 - tailBits)) & 0xFFu;
+		order = static_cast<int>(lhs.bytes_[wholeBytes] & mask) - static_cast<int>(rhs.bytes_[wholeBytes] & mask);
+
+	} // end if
+
+	if (order == 0 && lhs.bitCount_ != rhs.bitCount_) {
+		order = (lhs.bitCount_ < rhs.bitCount_) ? -1 : 1;
+	} // end if
+
+	return order;
+
+} // End of compareCodes
+
+/** build
+@pre all indexes must have a integer value >= 0, their sum < 2^63
+@post construct the Huffman tree, codeTree_ and computes the code for each character,
+computed codes stored in codebook_.
+@parm long long* [] [count], frequency for each letter from 'a' to 'z'.*/
+void HuffmanAlgorithm::build(const long long(&counts)[NUM_LETTERS]) {
+
+	HUFFMAN_TRACE_SCOPE("HuffmanAlgorithm::build");
 
 	// Note that counts[0] is the frequency for the letter 'a' 
 	// and counts[25] is the frequency for the letter 'z'. 
 
-	HuffmanTree* treeArray[NUM_LETTERS];
+	if (codeOrder_ == ALPHABETIC_ORDER) {
+
+		// leaves stay in letter order, items 'a' - 'z' as with the char leaves below
+		codeTree_.buildAlphabetic(std::vector<long long>(counts, counts + NUM_LETTERS), 'a');
+
+	}
+	else {
+
+		HuffmanTree* treeArray[NUM_LETTERS];
 	
-	char startChar = 'a';
+		char startChar = 'a';
 
-	for (int i = 0; i < NUM_LETTERS; ++i) {
+		for (int i = 0; i < NUM_LETTERS; ++i) {
 
-		HuffmanTree* tempTreePtr = new HuffmanTree(startChar, counts[i]);
+			HuffmanTree* tempTreePtr = new HuffmanTree(startChar, counts[i]);
 
-		treeArray[i] = tempTreePtr;
-		++startChar;
+			treeArray[i] = tempTreePtr;
+			++startChar;
 
-	} // End of for
+		} // End of for
 
 	
-	PriorityQueue<HuffmanTree> heap(treeArray, NUM_LETTERS);
+		PriorityQueue<HuffmanTree> heap(treeArray, NUM_LETTERS);
 
-	while (heap.size() > 0) {
+		while (heap.size() > 0) {
 
-		HuffmanTree* firstMinPtr = heap.deleteMin();
+			HuffmanTree* firstMinPtr = heap.deleteMin();
 
-		HuffmanTree* secondMinPtr = heap.deleteMin();
+			HuffmanTree* secondMinPtr = heap.deleteMin();
 
-		HuffmanTree* tempTreePtr = nullptr;
+			HuffmanTree* tempTreePtr = nullptr;
 
-		if (firstMinPtr != nullptr && secondMinPtr != nullptr) {
+			if (firstMinPtr != nullptr && secondMinPtr != nullptr) {
 
-			tempTreePtr = new HuffmanTree(*firstMinPtr, *secondMinPtr);
-			heap.insert(tempTreePtr);
+				tempTreePtr = new HuffmanTree(*firstMinPtr, *secondMinPtr);
+				heap.insert(tempTreePtr);
 
-		} // End if 
+			} // End if 
 
-		if (firstMinPtr != nullptr && secondMinPtr == nullptr) {
-			codeTree_ = *firstMinPtr;
-		} // End if 
+			if (firstMinPtr != nullptr && secondMinPtr == nullptr) {
+				codeTree_ = *firstMinPtr;
+			} // End if 
 		
-		delete firstMinPtr;
-		firstMinPtr = nullptr;
-		delete secondMinPtr;
-		secondMinPtr = nullptr;
+			delete firstMinPtr;
+			firstMinPtr = nullptr;
+			delete secondMinPtr;
+			secondMinPtr = nullptr;
 
 
-	} // end while
+		} // end while
+
+	} // End if
 
 
 	codeTree_.encode(codebook_);
 
-} // End of Constructor 
+	buildTables();
+
+} // End of build
+
+/** buildTables
+@pre codebook_ computed
+@post codeBits_, codeLengths_ and decodeTable_ computed from codebook_*/
+void HuffmanAlgorithm::buildTables() {
+
+	HUFFMAN_TRACE_SCOPE("HuffmanAlgorithm::buildTables");
+
+	decodeTable_.assign(1u << DECODE_TABLE_BITS, DecodeEntry());
+
+	char letter = 'a';
+	for (int i = 0; i < NUM_LETTERS; ++i) {
+
+		codeBits_[i] = 0;
+		codeLengths_[i] = static_cast<int>(codebook_[i].size());
+
+		for (unsigned int bit = 0; bit < codebook_[i].size(); ++bit) {
+
+			codeBits_[i] = (codeBits_[i] << 1) | (codebook_[i][bit] == '1' ? 1 : 0);
+
+		} // end for
+
+		// every table index that starts with a short code decodes to its letter
+		if (codeLengths_[i] <= DECODE_TABLE_BITS) {
+
+			const int freeBits = DECODE_TABLE_BITS - codeLengths_[i];
+			const unsigned int start = static_cast<unsigned int>(codeBits_[i]) << freeBits;
+
+			for (unsigned int pattern = 0; pattern < (1u << freeBits); ++pattern) {
+
+				decodeTable_[start | pattern].letter_ = letter;
+				decodeTable_[start | pattern].length_ = static_cast<unsigned char>(codeLengths_[i]);
+
+			} // end for
+
+		} // end if
+
+		++letter;
+
+	} // end for
+
+} // End of buildTables
 
 HuffmanAlgorithm::~HuffmanAlgorithm() {
 
-	codeTree_.~HuffmanTree();
+	// codeTree_ releases its own memory in its destructor
 
 } // End of Destructor 
 
@@ -153,7 +349,9 @@ calls decrypt
 @return string that represents the provided text encoded*/
 std::string HuffmanAlgorithm::getWord(std::string in) const{
 	
-	
+	HUFFMAN_TRACE_SCOPE("HuffmanAlgorithm::getWord");
+	HUFFMAN_TRACE_COUNTER("getWord chars", in.size());
+
 	std::string code{};
 
 	for (unsigned int i = 0; i < in.size(); ++i) {
@@ -194,14 +392,251 @@ std::string HuffmanAlgorithm::decrypt(const char targetChar) const {
 @return text representation of provided code*/
 std::string HuffmanAlgorithm::decipher(std::string in) const {
 
+	HUFFMAN_TRACE_SCOPE("HuffmanAlgorithm::decipher");
+	HUFFMAN_TRACE_COUNTER("decipher bits", in.size());
+
+	std::string text{};
+
+	text = decode(packAscii(in));
+
+	return text;
+
+
+} // End of decode
+
+/** getCode
+@pre None
+@post code for the provided letter is looked up in the codebook_
+@parm char [letter], 'a' - 'z'
+@return string that represents the code for the provided letter, empty if letter is not 'a' - 'z'*/
+std::string HuffmanAlgorithm::getCode(const char letter) const {
+
+	std::string code{};
+
+	// only valid char 'a' - 'z'
+	if (letter >= 'a' && letter <= 'z') {
+
+		code = decrypt(letter);
+
+	} // end if
+
+	return code;
+
+} // End of getCode
+
+/** codeBits
+@pre None
+@post None
+@parm char [letter], 'a' - 'z'
+@return code of the provided letter as right aligned bits, most significant bit first,
+0 if letter is not 'a' - 'z'*/
+std::uint64_t HuffmanAlgorithm::codeBits(const char letter) const {
+
+	return (letter >= 'a' && letter <= 'z') ? codeBits_[letter - 'a'] : 0;
+
+} // End of codeBits
+
+/** codeLength
+@pre None
+@post None
+@parm char [letter], 'a' - 'z'
+@return bits in the code of the provided letter, 0 if letter is not 'a' - 'z'*/
+int HuffmanAlgorithm::codeLength(const char letter) const {
+
+	return (letter >= 'a' && letter <= 'z') ? codeLengths_[letter - 'a'] : 0;
+
+} // End of codeLength
+
+/** flatten lays codeTree_ out in arrays, see HuffmanTree::flatten
+@pre None
+@post node i has children left[i] and right[i], node 0 is the root. A leaf has left
+and right -1 and holds its letter 'a' - 'z' in items[i]
+@parm std::vector<int> [left], [right] & [items] passed by reference*/
+void HuffmanAlgorithm::flatten(std::vector<int>& left, std::vector<int>& right, std::vector<int>& items) const {
+
+	codeTree_.flatten(left, right, items);
+
+} // End of flatten
+
+/** branches lays out the internal nodes of codeTree_, for automata that step one bit at a time
+@pre None
+@post children[b][node] is the internal node bit b leads to from node, or -1 - i when bit b
+completes the code of letter 'a' + i. Node 0 is the root, nodes follow breadth first
+@parm std::vector<int> [children] [2] passed by reference*/
+void HuffmanAlgorithm::branches(std::vector<int>(&children)[2]) const {
+
+	std::vector<int> left;
+	std::vector<int> right;
+	std::vector<int> items;
+	codeTree_.flatten(left, right, items);
+
+	// number the internal nodes only, leaves become -1 - letter in their parent
+	std::vector<int> internalIndex(left.size(), 0);
+	int internalCount = 0;
+	for (std::size_t node = 0; node < left.size(); ++node) {
+
+		if (left[node] >= 0) {
+
+			internalIndex[node] = internalCount;
+			++internalCount;
+
+		} // end if
+
+	} // end for
+
+	children[0].assign(internalCount, 0);
+	children[1].assign(internalCount, 0);
+
+	for (std::size_t node = 0; node < left.size(); ++node) {
+
+		if (left[node] >= 0) {
+
+			for (int bit = 0; bit < 2; ++bit) {
+
+				const int child = (bit == 0) ? left[node] : right[node];
+				children[bit][internalIndex[node]] = (left[child] < 0) ? -1 - (items[child] - 'a') : internalIndex[child];
+
+			} // end for
+
+		} // end if
+
+	} // end for
+
+} // End of branches
+
+/** decipherLetter
+@pre provided code was generated by current HuffmanAlgorithm's codebook
+@post a single letter is decoded from in, starting at index. index is moved past the
+decoded code, left unchanged if in ends before a complete code
+@parm std::string [in], unsigned int [index] & char [letter] passed by reference
+@return true if a letter was decoded, otherwise false*/
+bool HuffmanAlgorithm::decipherLetter(const std::string& in, unsigned int& index, char& letter) const {
+
+	return codeTree_.decodeSymbol(in, index, letter);
+
+} // End of decipherLetter
+
+/** encode
+@pre None
+@post all lowercase letters of provided string are encoded, 8 code bits per byte
+@parm std::string [in], text to be converted with Huffman Coding
+@return packed code of the provided text*/
+PackedCode HuffmanAlgorithm::encode(const std::string& in) const {
+
+	HUFFMAN_TRACE_SCOPE("HuffmanAlgorithm::encode");
+	HUFFMAN_TRACE_COUNTER("encode chars", in.size());
+
+	BitWriter writer;
+
+	for (unsigned int i = 0; i < in.size(); ++i) {
+
+		char c = in[i];
+		// only valid char 'a' - 'z'
+		if (c >= 'a' && c <= 'z') {
+
+			writer.writeBits(codeBits_[c - 'a'], codeLengths_[c - 'a']);
+
+		} // end if
+
+	} // End for
+
+	writer.finish();
+
+	PackedCode code;
+	code.bitCount_ = writer.bitCount();
+	writer.swapBytes(code.bytes_);
+
+	return code;
+
+} // End of encode
+
+/** decode
+@pre provided code was generated by current HuffmanAlgorithm's codebook
+@post text representation of the packed code is computed, a trailing incomplete
+code is ignored
+@parm PackedCode [code]
+@return text representation of provided code*/
+std::string HuffmanAlgorithm::decode(const PackedCode& code) const {
+
+	HUFFMAN_TRACE_SCOPE("HuffmanAlgorithm::decode");
+	HUFFMAN_TRACE_COUNTER("decode bits", code.bitCount_);
+
 	std::string text{};
 
-	text = codeTree_.decode(in);
+	BitReader reader(code.bytes_.data(), code.bitCount_);
+	char letter = '\0';
+
+	while (reader.remaining() > 0 && decodeLetter(reader, letter)) {
+
+		text += letter;
+
+	} // end while
 
 	return text;
 
+} // End of decode
+
+/** decode
+@pre provided code was generated by current HuffmanAlgorithm's codebook, startBit is
+the start of a code
+@post at most letterCount letters are decoded, starting at startBit
+@parm PackedCode [code], std::uint64_t [startBit], std::uint64_t [letterCount]
+@return text representation of that part of the code*/
+std::string HuffmanAlgorithm::decode(const PackedCode& code, std::uint64_t startBit, std::uint64_t letterCount) const {
+
+	std::string text{};
+	text.reserve(static_cast<std::size_t>(letterCount < code.bitCount_ ? letterCount : code.bitCount_));
+
+	BitReader reader(code.bytes_.data(), code.bitCount_, startBit);
+	char letter = '\0';
+
+	while (text.size() < letterCount && reader.remaining() > 0 && decodeLetter(reader, letter)) {
+
+		text += letter;
+
+	} // end while
+
+	return text;
+
+} // End of decode
+
+/** decodeLetter
+@pre reader is at the start of a code generated by current HuffmanAlgorithm's codebook
+@post reader moved past the code if it is complete
+@parm BitReader [reader] & char [letter] passed by reference
+@return true if a letter was decoded, false if the bits left are not a complete code*/
+bool HuffmanAlgorithm::decodeLetter(BitReader& reader, char& letter) const {
+
+	bool decoded = false;
+	const DecodeEntry& entry = decodeTable_[reader.peekBits(DECODE_TABLE_BITS)];
+
+	if (entry.length_ > 0) {
+
+		// short code, one lookup. Bits past the end peek as 0, so check the length
+		decoded = entry.length_ <= reader.remaining();
+		if (decoded) {
+
+			letter = entry.letter_;
+			reader.skipBits(entry.length_);
+
+		} // end if
+
+	}
+	else {
+
+		// long, rare code, walk the tree
+		decoded = codeTree_.decodeSymbol(reader, letter);
+
+	} // end if
+
+	return decoded;
 
-} // End of decode 
+} // End of decodeLetter
 
+/** codeOrder
+@return shape of the code tree, ALPHABETIC_ORDER if the codes sort like the letters*/
+CodeOrder HuffmanAlgorithm::codeOrder() const {
 
+	return codeOrder_;
 
+} // End of codeOrder
@@ -8,8 +8,18 @@
 	// HuffmanAlgorithm class:  Huffman Coding implementation
 	//   included features:
 	//   -- allows construction by int array that represents char counts for 'a' - 'z' 
+	//   -- allows construction by 64 bit counts, optionally normalized to a fixed
+	//			precision before the tree is built
+	//   -- allows for alphabetic codes (ALPHABETIC_ORDER), whose codes sort like the
+	//			letters, so packed codes compare like the text (see compareCodes)
 	//   -- allows for input text/string to be encoded by the HuffmanTree codeTree
 	//   -- allows for decipher of a input code per the HuffmanTree codeTree
+	//   -- exposes each code as bits (codeBits, codeLength) and the code tree as
+	//			flat arrays (flatten, branches), for coders that keep their own tables
+	//   -- allows for encoding to and decoding from packed bits, decoding up to
+	//			DECODE_TABLE_BITS bits with a single table lookup
+	//   -- construction, encoding and decoding phases are timed by PhaseTimer.h
+	//			when HUFFMAN_ENABLE_TRACING is defined
 	//
 	// Assumptions:
 	//   --  index 0-25 represents 'a' - 'z' .
@@ -23,10 +33,24 @@
 // Included libraries
 #include <string>
 #include <iostream>
+#include <cstdint>
+#include <vector>
 
 // included .h files
 #include "PriorityQueue.h"
 #include "HuffmanTree.h"
+#include "BitStream.h"
+
+
+// precisionBits value that builds the tree from the exact counts
+const int NO_NORMALIZATION = 0;
+
+// Number of bits the packed decoder resolves with one table lookup
+const int DECODE_TABLE_BITS = 10;
+
+// Shape of the code tree: FREQUENCY_ORDER is the plain Huffman tree, ALPHABETIC_ORDER keeps
+// the leaves in letter order at the cost of a slightly longer code
+enum CodeOrder { FREQUENCY_ORDER, ALPHABETIC_ORDER };
 
 
 class HuffmanAlgorithm{
@@ -84,12 +108,40 @@ public:
 	@parm int* [] [count], frequency for each letter from 'a' to 'z'.*/
 	HuffmanAlgorithm(int(&counts)[NUM_LETTERS]);
 
+	/** Constructor
+	@pre all indexes must have a integer value >= 0, their sum < 2^63, 0 <= precisionBits < 63
+	@post HuffmanAlgorithm Object is created, construct the Huffman tree, codeTree_ and computes the code 
+	for each character, computed codes stored in codebook_. Unless precisionBits is NO_NORMALIZATION
+	the counts are first normalized with normalizeCounts
+	@parm long long* [] [count], frequency for each letter from 'a' to 'z',
+	int [precisionBits], total the counts are scaled down to, as a power of 2,
+	CodeOrder [order], ALPHABETIC_ORDER for codes that sort like the letters*/
+	HuffmanAlgorithm(long long(&counts)[NUM_LETTERS], int precisionBits = NO_NORMALIZATION,
+		CodeOrder order = FREQUENCY_ORDER);
+
 	// Deconstructor
 	~HuffmanAlgorithm();
 
 
 	/** Public Methods */
 
+	/** normalizeCounts
+	@pre all indexes must have a integer value >= 0, 0 < precisionBits < 63
+	@post if the counts sum past 2^precisionBits, every count is divided by the same power of 2
+	(rounded to nearest) so the sum is about 2^precisionBits. Letters that occurred keep a count
+	of at least 1. The same counts always give the same result
+	@parm long long* [] [count] passed by reference, int [precisionBits]*/
+	static void normalizeCounts(long long(&counts)[NUM_LETTERS], int precisionBits);
+
+	/** compareCodes compares two packed codes bit by bit, a code that is a prefix of the
+	other sorts first
+	@pre None
+	@post None
+	@parm PackedCode [lhs], PackedCode [rhs]
+	@return < 0, 0 or > 0 as lhs sorts before, with or after rhs. For codes of an
+	ALPHABETIC_ORDER codebook that is the order of the texts they encode*/
+	static int compareCodes(const PackedCode& lhs, const PackedCode& rhs);
+
 	/** getWord 
 	@pre string greater then 0 in size, only contains lower case letters
 	@post all lowercase letters of provided string are encoded using the codes stored in the codebook_.
@@ -100,11 +152,90 @@ public:
 
 	/** decipher
 	@pre provided code was generated by current HuffmanAlgorithm's codebook
-	@post text representation of the code is computed.
+	@post text representation of the code is computed. The '0'/'1' code is packed
+	(see BitPacking.h) and decoded by the table driven packed decoder
 	@parm std::string [in], code to be converted to text with Huffman Coding
 	@return text representation of provided code*/
 	std::string decipher(std::string in) const;
 
+	/** encode
+	@pre None
+	@post all lowercase letters of provided string are encoded, 8 code bits per byte
+	@parm std::string [in], text to be converted with Huffman Coding
+	@return packed code of the provided text*/
+	PackedCode encode(const std::string& in) const;
+
+	/** decode
+	@pre provided code was generated by current HuffmanAlgorithm's codebook
+	@post text representation of the packed code is computed, a trailing incomplete
+	code is ignored
+	@parm PackedCode [code]
+	@return text representation of provided code*/
+	std::string decode(const PackedCode& code) const;
+
+	/** decode
+	@pre provided code was generated by current HuffmanAlgorithm's codebook, startBit is
+	the start of a code
+	@post at most letterCount letters are decoded, starting at startBit
+	@parm PackedCode [code], std::uint64_t [startBit], std::uint64_t [letterCount]
+	@return text representation of that part of the code*/
+	std::string decode(const PackedCode& code, std::uint64_t startBit, std::uint64_t letterCount) const;
+
+	/** decodeLetter
+	@pre reader is at the start of a code generated by current HuffmanAlgorithm's codebook
+	@post reader moved past the code if it is complete
+	@parm BitReader [reader] & char [letter] passed by reference
+	@return true if a letter was decoded, false if the bits left are not a complete code*/
+	bool decodeLetter(BitReader& reader, char& letter) const;
+
+	/** getCode
+	@pre None
+	@post code for the provided letter is looked up in the codebook_
+	@parm char [letter], 'a' - 'z'
+	@return string that represents the code for the provided letter, empty if letter is not 'a' - 'z'*/
+	std::string getCode(const char letter) const;
+
+	/** codeBits
+	@pre None
+	@post None
+	@parm char [letter], 'a' - 'z'
+	@return code of the provided letter as right aligned bits, most significant bit first,
+	0 if letter is not 'a' - 'z'*/
+	std::uint64_t codeBits(const char letter) const;
+
+	/** codeLength
+	@pre None
+	@post None
+	@parm char [letter], 'a' - 'z'
+	@return bits in the code of the provided letter, 0 if letter is not 'a' - 'z'*/
+	int codeLength(const char letter) const;
+
+	/** flatten lays codeTree_ out in arrays, see HuffmanTree::flatten
+	@pre None
+	@post node i has children left[i] and right[i], node 0 is the root. A leaf has left
+	and right -1 and holds its letter 'a' - 'z' in items[i]
+	@parm std::vector<int> [left], [right] & [items] passed by reference*/
+	void flatten(std::vector<int>& left, std::vector<int>& right, std::vector<int>& items) const;
+
+	/** branches lays out the internal nodes of codeTree_, for automata that step one bit at a time
+	@pre None
+	@post children[b][node] is the internal node bit b leads to from node, or -1 - i when bit b
+	completes the code of letter 'a' + i. Node 0 is the root, nodes follow breadth first
+	@parm std::vector<int> [children] [2] passed by reference*/
+	void branches(std::vector<int>(&children)[2]) const;
+
+	/** decipherLetter
+	@pre provided code was generated by current HuffmanAlgorithm's codebook
+	@post a single letter is decoded from in, starting at index. index is moved past the
+	decoded code, left unchanged if in ends before a complete code
+	@parm std::string [in], unsigned int [index] & char [letter] passed by reference
+	@return true if a letter was decoded, otherwise false*/
+	bool decipherLetter(const std::string& in, unsigned int& index, char& letter) const;
+
+	/** codeOrder
+	@return shape of the code tree, ALPHABETIC_ORDER if the codes sort like the letters*/
+	CodeOrder codeOrder() const;
+
 
 private:
 
@@ -112,9 +243,34 @@ private:
 	/** Private Attributes */
 	std::string codebook_[NUM_LETTERS]; // used for encoding
 	HuffmanTree codeTree_; // used to decoding 
+	CodeOrder codeOrder_; // how codeTree_ is built
+
+	// packed decode table entry, length 0 when the code is longer than DECODE_TABLE_BITS
+	struct DecodeEntry {
+
+		char letter_ = '\0';
+		unsigned char length_ = 0;
+
+	}; // end of DecodeEntry
+
+	std::uint64_t codeBits_[NUM_LETTERS]; // codebook_ as right aligned bits, used for packed encoding
+	int codeLengths_[NUM_LETTERS]; // length of each code of codebook_
+	std::vector<DecodeEntry> decodeTable_; // next DECODE_TABLE_BITS bits -> letter, used for packed decoding
 
 	/** Private Methods */
 
+	/** build
+	@pre all indexes must have a integer value >= 0, their sum < 2^63
+	@post construct the Huffman tree, codeTree_ and computes the code for each character,
+	computed codes stored in codebook_.
+	@parm long long* [] [count], frequency for each letter from 'a' to 'z'.*/
+	void build(const long long(&counts)[NUM_LETTERS]);
+
+	/** buildTables
+	@pre codebook_ computed
+	@post codeBits_, codeLengths_ and decodeTable_ computed from codebook_*/
+	void buildTables();
+
 	/** decrypt
 	@pre None
 	@post code return for char 'a' to 'z'
@@ -3,7 +3,7 @@
  @author Anthony Campos
  @date 01/26/2022
  This implementation file implements a HuffmanTree of HuffNodes
-	that hold a char and the int count of the specific char */
+	that hold a char (or int symbol) and the 64 bit count of the specific char */
 
 //---------------------------------------------------------------------------
 // HuffmanTree class:  Tree data structure
@@ -13,6 +13,12 @@
 //   -- allows for comparison of 2 HuffmanTree, by their roots
 //   -- allows for assignment and copy of 2 HuffmanTrees
 //   -- provides Huffuman encoder and decoder
+//   -- allows for building a tree over int symbols 0 - n-1 and reading back
+//			the code length of every symbol, for alphabets larger than 'a' - 'z'
+//   -- allows for flattening the tree into breadth first arrays, for decoders
+//			that lay the tree out themselves (see BlockedDecodeTree.h)
+//   -- allows for building an alphabetic tree (Garsia-Wachs), whose leaves stay
+//			in symbol order so the codes sort like the symbols they stand for
 //
 // Assumptions:
 //   -- Non-leaves should store the sum of the weights of the descendant leaves.
@@ -21,6 +27,11 @@
 
 // included .h files
 #include "HuffmanTree.h"
+#include "PhaseTimer.h"
+
+// Included libraries
+#include <algorithm>
+#include <utility>
 
 
 
@@ -43,15 +54,27 @@ HuffmanTree::HuffmanTree()
 {} // End of Constuctor
 
 /** Constructor
-@pre letter is a valid char, count > 1 & count < 2147483647
+@pre letter is a valid char, count >= 0 & the sum of all counts of the tree < 2^63
 @post Empty HuffmanTree Object created
-@param char [letter], int [count]*/
-HuffmanTree::HuffmanTree(const char& letter, const int& count) 
+@param char [letter], long long [count]*/
+HuffmanTree::HuffmanTree(const char& letter, const long long& count) 
 {
 	root_ = new HuffNode;
 	root_->item_ = letter;
 	root_->count_ = count;
 
+} // End of Constuctor
+
+/** Constructor
+@pre symbol >= 0, count >= 0 & the sum of all counts of the tree < 2^63
+@post single leaf HuffmanTree Object created holding symbol
+@param int [symbol], long long [count]*/
+HuffmanTree::HuffmanTree(const int& symbol, const long long& count)
+{
+	root_ = new HuffNode;
+	root_->item_ = symbol;
+	root_->count_ = count;
+
 } // End of Constuctor
 	
 
@@ -259,6 +282,7 @@ calls encoder to decode Hufftree to generate codes
 @param std::string array [codebook] passed by reference*/
 void HuffmanTree::encode(std::string(&codebook)[NUM_LETTERS]) const {
 
+	HUFFMAN_TRACE_SCOPE("HuffmanTree::encode");
 
 	std::vector<std::string> codes{};
 
@@ -333,6 +357,93 @@ std::string HuffmanTree::decode(const std::string code) const {
 
 } // End of decode
 
+/* decodeSymbol decodes a single letter from the provided code, starting at index
+@pre code provided must be valid code for the current HuffmanTree
+@post letter holds the decoded char and index is moved past its code. If the code runs
+out before a leaf is reached, letter and index are left unchanged
+@param std::string [code], unsigned int [index] & char [letter] passed by reference
+@return true if a complete letter was decoded, otherwise false*/
+bool HuffmanTree::decodeSymbol(const std::string& code, unsigned int& index, char& letter) const {
+
+	bool decoded = false;
+
+	const HuffNode* subTreePtr = root_;
+	unsigned int position = index;
+
+	// walk down from the root until a leaf is reached or the code runs out
+	while (subTreePtr != nullptr && (subTreePtr->leftChild_ != nullptr || subTreePtr->rightChild_ != nullptr)
+		&& position < code.size()) {
+
+		if (code[position] == '0') {
+
+			subTreePtr = subTreePtr->leftChild_;
+		}
+		// else == '1'
+		else {
+
+			subTreePtr = subTreePtr->rightChild_;
+		} // end if
+
+		++position;
+
+	} // end while
+
+	// leaf
+	if (subTreePtr != nullptr && subTreePtr->leftChild_ == nullptr && subTreePtr->rightChild_ == nullptr) {
+
+		letter = static_cast<char>(subTreePtr->item_);
+		index = position;
+		decoded = true;
+
+	} // end if
+
+	return decoded;
+
+} // End of decodeSymbol
+
+/* decodeSymbol decodes a single letter from packed bits
+@pre reader is at the start of a code of the current HuffmanTree
+@post letter holds the decoded char and reader is moved past its code. If the bits run
+out before a leaf is reached, letter and reader are left unchanged
+@param BitReader [reader] & char [letter] passed by reference
+@return true if a complete letter was decoded, otherwise false*/
+bool HuffmanTree::decodeSymbol(BitReader& reader, char& letter) const {
+
+	bool decoded = false;
+
+	const HuffNode* subTreePtr = root_;
+
+	// read ahead on a copy so reader is untouched if the code is incomplete
+	BitReader lookAhead = reader;
+
+	// walk down from the root until a leaf is reached or the bits run out
+	while (subTreePtr != nullptr && (subTreePtr->leftChild_ != nullptr || subTreePtr->rightChild_ != nullptr)
+		&& lookAhead.remaining() > 0) {
+
+		if (lookAhead.readBit() == 0) {
+
+			subTreePtr = subTreePtr->leftChild_;
+		}
+		else {
+
+			subTreePtr = subTreePtr->rightChild_;
+		} // end if
+
+	} // end while
+
+	// leaf
+	if (subTreePtr != nullptr && subTreePtr->leftChild_ == nullptr && subTreePtr->rightChild_ == nullptr) {
+
+		letter = static_cast<char>(subTreePtr->item_);
+		reader = lookAhead;
+		decoded = true;
+
+	} // end if
+
+	return decoded;
+
+} // End of decodeSymbol
+
 /* decoder helps the decode method decipher the provided code into text
 generated by traversing the tree
 @pre Huffman tree has already been completed/filled/Not Empty
@@ -344,7 +455,7 @@ void HuffmanTree::decoder(const HuffNode* subTreePtr, const std::string& code, u
 	// leaf 
 	if (subTreePtr != nullptr && subTreePtr->leftChild_ == nullptr && subTreePtr->rightChild_ == nullptr) {
 
-		text += subTreePtr->item_;
+		text += static_cast<char>(subTreePtr->item_);
 		//subTreePtr = root_;
 		decoder(root_, code, index, text);
 
@@ -368,3 +479,268 @@ void HuffmanTree::decoder(const HuffNode* subTreePtr, const std::string& code, u
 
 	 
 } // End of decoder
+
+/* build replaces the tree with the Huffman tree of counts, symbol i has weight counts[i]
+@pre counts not empty, all counts >= 0 & their sum < 2^63
+@post tree holds one leaf per index of counts, combined lowest weights first.
+Ties go to the tree holding the smallest symbol, as with operator<. Runs in
+O(n log n) for the sort of the leaves and O(n) for the merges
+@param std::vector<long long> [counts]*/
+void HuffmanTree::build(const std::vector<long long>& counts) {
+
+	clearTree(root_);
+
+	std::vector<HuffmanTree*> leaves(counts.size());
+
+	for (unsigned int i = 0; i < counts.size(); ++i) {
+
+		leaves[i] = new HuffmanTree(static_cast<int>(i), counts[i]);
+
+	} // End of for
+
+	std::stable_sort(leaves.begin(), leaves.end(),
+		[](const HuffmanTree* lhs, const HuffmanTree* rhs) { return *lhs < *rhs; });
+
+	// combined trees come out in order of weight, so two queues replace the heap:
+	// the sorted leaves and the combined trees, the smaller front is the minimum
+	std::vector<HuffmanTree*> combined;
+	combined.reserve(leaves.size());
+	unsigned int leafFront = 0;
+	unsigned int combinedFront = 0;
+
+	auto takeMin = [&]() {
+
+		HuffmanTree* minPtr = nullptr;
+
+		if (combinedFront == combined.size()
+			|| (leafFront < leaves.size() && !(*combined[combinedFront] < *leaves[leafFront]))) {
+
+			minPtr = leaves[leafFront++];
+
+		}
+		else {
+
+			minPtr = combined[combinedFront++];
+
+		} // End if
+
+		return minPtr;
+
+	};
+
+	for (unsigned int merges = 1; merges < leaves.size(); ++merges) {
+
+		HuffmanTree* firstMinPtr = takeMin();
+		HuffmanTree* secondMinPtr = takeMin();
+
+		combined.push_back(new HuffmanTree(*firstMinPtr, *secondMinPtr));
+
+		delete firstMinPtr;
+		delete secondMinPtr;
+
+	} // End of for
+
+	// last tree standing, take its nodes rather than copying them
+	HuffmanTree* lastPtr = combined.empty() ? leaves.front() : combined.back();
+	root_ = lastPtr->root_;
+	lastPtr->root_ = nullptr;
+	delete lastPtr;
+
+} // End of build
+
+/* buildAlphabetic replaces the tree with the optimal alphabetic tree of counts
+@pre all counts >= 0 & their sum < 2^63
+@post tree holds one leaf per index of counts, in index order from left to right, leaf i
+holding firstItem + i. Of the trees that keep that order it has the least weighted code
+length (Garsia-Wachs), in O(n^2) time
+@param std::vector<long long> [counts], int [firstItem]*/
+void HuffmanTree::buildAlphabetic(const std::vector<long long>& counts, int firstItem) {
+
+	clearTree(root_);
+
+	const int size = static_cast<int>(counts.size());
+
+	// phase 1, combine the leftmost locally minimal pair and move the sum left past
+	// every lighter tree. Nodes 0 - size-1 are the leaves, later ones the sums
+	std::vector<long long> weight(counts.begin(), counts.end());
+	std::vector<int> left(size, -1);
+	std::vector<int> right(size, -1);
+
+	std::vector<int> work(size);
+	for (int i = 0; i < size; ++i) {
+
+		work[i] = i;
+
+	} // End of for
+
+	while (work.size() > 1) {
+
+		const int count = static_cast<int>(work.size());
+
+		// first j with weight[j-1] <= weight[j+1], past the end weighs more than anything
+		int j = 1;
+		while (j + 1 < count && weight[work[j - 1]] > weight[work[j + 1]]) {
+
+			++j;
+
+		} // end while
+
+		const int node = static_cast<int>(weight.size());
+		weight.push_back(weight[work[j - 1]] + weight[work[j]]);
+		left.push_back(work[j - 1]);
+		right.push_back(work[j]);
+
+		work.erase(work.begin() + (j - 1), work.begin() + (j + 1));
+
+		int place = j - 1;
+		while (place > 0 && weight[work[place - 1]] < weight[node]) {
+
+			--place;
+
+		} // end while
+
+		work.insert(work.begin() + place, node);
+
+	} // end while
+
+	// phase 2, the depth of every leaf in that (unordered) tree
+	std::vector<int> depth(size, 0);
+	std::vector<std::pair<int, int>> pending;
+
+	if (!work.empty()) {
+		pending.push_back(std::make_pair(work.front(), 0));
+	} // end if
+
+	while (!pending.empty()) {
+
+		const std::pair<int, int> visit = pending.back();
+		pending.pop_back();
+
+		if (visit.first < size) {
+
+			depth[visit.first] = visit.second;
+
+		}
+		else {
+
+			pending.push_back(std::make_pair(left[visit.first], visit.second + 1));
+			pending.push_back(std::make_pair(right[visit.first], visit.second + 1));
+
+		} // end if
+
+	} // end while
+
+	// phase 3, the leaves in order at those depths, siblings of equal depth combined as they meet
+	std::vector<std::pair<HuffNode*, int>> stack;
+
+	for (int i = 0; i < size; ++i) {
+
+		HuffNode* leaf = new HuffNode;
+		leaf->item_ = firstItem + i;
+		leaf->count_ = counts[i];
+		stack.push_back(std::make_pair(leaf, depth[i]));
+
+		while (stack.size() > 1 && stack[stack.size() - 2].second == stack.back().second) {
+
+			HuffNode* rightPtr = stack.back().first;
+			const int childDepth = stack.back().second;
+			stack.pop_back();
+
+			HuffNode* leftPtr = stack.back().first;
+			stack.back().first = combineTrees(leftPtr, rightPtr);
+			stack.back().second = childDepth - 1;
+
+		} // end while
+
+	} // End of for
+
+	if (!stack.empty()) {
+		root_ = stack.front().first;
+	} // end if
+
+} // End of buildAlphabetic
+
+/* codeLengths reports the depth of every leaf
+@pre tree was built over symbols 0 - lengths.size()-1
+@post lengths[symbol] holds the code length of symbol. A tree of a single leaf gives
+that leaf length 1 so it still has a code
+@param std::vector<int> [lengths] passed by reference*/
+void HuffmanTree::codeLengths(std::vector<int>& lengths) const {
+
+	lengthFinder(root_, 0, lengths);
+
+	// lone leaf, give it a one bit code
+	if (root_ != nullptr && root_->leftChild_ == nullptr && root_->rightChild_ == nullptr) {
+
+		lengths[root_->item_] = 1;
+
+	} // end if
+
+} // End of codeLengths
+
+/* flatten lays the tree out in arrays, breadth first
+@pre None
+@post node i has children left[i] and right[i], node 0 is the root and the nodes follow
+level by level. A leaf has left and right -1 and holds its char or symbol in items[i],
+an empty tree gives empty arrays
+@param std::vector<int> [left], [right] & [items] passed by reference*/
+void HuffmanTree::flatten(std::vector<int>& left, std::vector<int>& right, std::vector<int>& items) const {
+
+	left.clear();
+	right.clear();
+	items.clear();
+
+	// the nodes vector doubles as the queue, a node's index is its place in it
+	std::vector<const HuffNode*> nodes;
+	if (root_ != nullptr) {
+		nodes.push_back(root_);
+	} // end if
+
+	for (unsigned int i = 0; i < nodes.size(); ++i) {
+
+		const HuffNode* node = nodes[i];
+		items.push_back(node->item_);
+
+		if (node->leftChild_ == nullptr && node->rightChild_ == nullptr) {
+
+			left.push_back(-1);
+			right.push_back(-1);
+
+		}
+		else {
+
+			left.push_back(static_cast<int>(nodes.size()));
+			nodes.push_back(node->leftChild_);
+			right.push_back(static_cast<int>(nodes.size()));
+			nodes.push_back(node->rightChild_);
+
+		} // end if
+
+	} // end for
+
+} // End of flatten
+
+/* lengthFinder helps codeLengths record the depth of every leaf
+@pre None
+@post lengths updated for every leaf below subTreePtr
+@param HuffNode [subTreePtr], int [depth], std::vector<int> [lengths] passed by reference*/
+void HuffmanTree::lengthFinder(const HuffNode* subTreePtr, int depth, std::vector<int>& lengths) const {
+
+	if (subTreePtr != nullptr) {
+
+		// is a leaf
+		if (subTreePtr->leftChild_ == nullptr && subTreePtr->rightChild_ == nullptr) {
+
+			lengths[subTreePtr->item_] = depth;
+
+		}
+		else {
+
+			lengthFinder(subTreePtr->leftChild_, depth + 1, lengths);
+			lengthFinder(subTreePtr->rightChild_, depth + 1, lengths);
+
+		} // end if
+
+	} // end if
+
+} // End of lengthFinder
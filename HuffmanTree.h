@@ -2,7 +2,7 @@
  @author Anthony Campos
  @date 01/26/2022
  This header class file implements a HuffmanTree of HuffNodes
-	that hold a char and the int count of the specific char */
+	that hold a char (or int symbol) and the 64 bit count of the specific char */
 
 	//---------------------------------------------------------------------------
 	// HuffmanTree class:  Tree data structure
@@ -12,6 +12,12 @@
 	//   -- allows for comparison of 2 HuffmanTree, by their roots
 	//   -- allows for assignment and copy of 2 HuffmanTrees
 	//   -- provides Huffuman encoder and decoder
+	//   -- allows for building a tree over int symbols 0 - n-1 and reading back
+	//			the code length of every symbol, for alphabets larger than 'a' - 'z'
+	//   -- allows for flattening the tree into breadth first arrays, for decoders
+	//			that lay the tree out themselves (see BlockedDecodeTree.h)
+	//   -- allows for building an alphabetic tree (Garsia-Wachs), whose leaves stay
+	//			in symbol order so the codes sort like the symbols they stand for
 	//
 	// Assumptions:
 	//   --  Non-leaves should store the sum of the weights of the descendant leaves.
@@ -23,6 +29,9 @@
 #include <string>
 #include <vector>
 
+// included .h files
+#include "BitStream.h"
+
 // Global Variable for length/size of codebook_ array
 const int NUM_LETTERS = 26;
 
@@ -39,10 +48,16 @@ public:
 	HuffmanTree();
 
 	/** Constructor
-	@pre letter is a valid char, count > 1 & count < 2147483647
+	@pre letter is a valid char, count >= 0 & the sum of all counts of the tree < 2^63
 	@post Empty HuffmanTree Object created
-	@param char [letter], int [count]*/
-	HuffmanTree(const char& letter, const int& count);
+	@param char [letter], long long [count]*/
+	HuffmanTree(const char& letter, const long long& count);
+
+	/** Constructor
+	@pre symbol >= 0, count >= 0 & the sum of all counts of the tree < 2^63
+	@post single leaf HuffmanTree Object created holding symbol
+	@param int [symbol], long long [count]*/
+	HuffmanTree(const int& symbol, const long long& count);
 
 	/** Constructor
 	@pre neither source HuffmanTrees are empty
@@ -100,6 +115,53 @@ public:
 	@return a string that represents the coded message*/
 	std::string decode(const std::string code) const;
 
+	/* decodeSymbol decodes a single letter from the provided code, starting at index
+	@pre code provided must be valid code for the current HuffmanTree
+	@post letter holds the decoded char and index is moved past its code. If the code runs
+	out before a leaf is reached, letter and index are left unchanged
+	@param std::string [code], unsigned int [index] & char [letter] passed by reference
+	@return true if a complete letter was decoded, otherwise false*/
+	bool decodeSymbol(const std::string& code, unsigned int& index, char& letter) const;
+
+	/* decodeSymbol decodes a single letter from packed bits
+	@pre reader is at the start of a code of the current HuffmanTree
+	@post letter holds the decoded char and reader is moved past its code. If the bits run
+	out before a leaf is reached, letter and reader are left unchanged
+	@param BitReader [reader] & char [letter] passed by reference
+	@return true if a complete letter was decoded, otherwise false*/
+	bool decodeSymbol(BitReader& reader, char& letter) const;
+
+	/* build replaces the tree with the Huffman tree of counts, symbol i has weight counts[i]
+	@pre counts not empty, all counts >= 0 & their sum < 2^63
+	@post tree holds one leaf per index of counts, combined lowest weights first.
+	Ties go to the tree holding the smallest symbol, as with operator<. Runs in
+	O(n log n) for the sort of the leaves and O(n) for the merges
+	@param std::vector<long long> [counts]*/
+	void build(const std::vector<long long>& counts);
+
+	/* buildAlphabetic replaces the tree with the optimal alphabetic tree of counts
+	@pre all counts >= 0 & their sum < 2^63
+	@post tree holds one leaf per index of counts, in index order from left to right, leaf i
+	holding firstItem + i. Of the trees that keep that order it has the least weighted code
+	length (Garsia-Wachs), in O(n^2) time
+	@param std::vector<long long> [counts], int [firstItem]*/
+	void buildAlphabetic(const std::vector<long long>& counts, int firstItem = 0);
+
+	/* codeLengths reports the depth of every leaf
+	@pre tree was built over symbols 0 - lengths.size()-1
+	@post lengths[symbol] holds the code length of symbol. A tree of a single leaf gives
+	that leaf length 1 so it still has a code
+	@param std::vector<int> [lengths] passed by reference*/
+	void codeLengths(std::vector<int>& lengths) const;
+
+	/* flatten lays the tree out in arrays, breadth first
+	@pre None
+	@post node i has children left[i] and right[i], node 0 is the root and the nodes follow
+	level by level. A leaf has left and right -1 and holds its char or symbol in items[i],
+	an empty tree gives empty arrays
+	@param std::vector<int> [left], [right] & [items] passed by reference*/
+	void flatten(std::vector<int>& left, std::vector<int>& right, std::vector<int>& items) const;
+
 
 
 private:
@@ -120,8 +182,8 @@ private:
 		HuffNode* leftChild_;
 		HuffNode* rightChild_;
 
-		char item_; // default value, '\0'
-		int count_; // default value,  0
+		int item_; // default value, '\0', a char 'a' - 'z' or an int symbol
+		long long count_; // default value,  0, 64 bit so sums of huge corpora cannot overflow
 
 	}; // end of HuffNode
 
@@ -168,4 +230,10 @@ private:
 	@param HuffNode [subTreePtrstd], std::string [code] & std::string [text] passed by reference, unsigned int [index]*/
 	void decoder(const HuffNode* subTreePtr, const std::string& code, unsigned int index, std::string& text) const;
 
+	/* lengthFinder helps codeLengths record the depth of every leaf
+	@pre None
+	@post lengths updated for every leaf below subTreePtr
+	@param HuffNode [subTreePtr], int [depth], std::vector<int> [lengths] passed by reference*/
+	void lengthFinder(const HuffNode* subTreePtr, int depth, std::vector<int>& lengths) const;
+
 }; // end of HuffmanTree
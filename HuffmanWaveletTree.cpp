@@ -0,0 +1,264 @@
+/** @file HuffmanWaveletTree.cpp
+ @author Anthony Campos
+ @date 10/19/2026
+ This implementation file implements a HuffmanWaveletTree, a wavelet tree over the letters of a text
+ shaped like the code tree of a HuffmanAlgorithm, answering access, rank and select queries */
+
+//---------------------------------------------------------------------------
+// HuffmanWaveletTree class:  compressed letter index
+//   included features:
+//   -- every internal node of the code tree holds a RankSelectBitVector with
+//			the next code bit of each letter that passes through it, so the
+//			bits stored add up to the Huffman coded size of the text
+//   -- access(i): the letter at i, one rank per code bit
+//   -- rank(letter, i): occurrences of letter before i, one rank per code bit
+//   -- select(letter, k): position of the k-th occurrence, one select per
+//			code bit
+//   -- frequent letters have short codes, so they are also the fastest to
+//			query
+//
+// Assumptions:
+//   --  like encode, chars other than 'a' - 'z' are skipped, positions count
+//			letters only
+//---------------------------------------------------------------------------
+
+
+// included .h files
+#include "HuffmanWaveletTree.h"
+
+
+/** Constructor
+@pre None
+@post HuffmanWaveletTree Object created for the letters of text, shaped by a code tree
+built from the letter counts of text
+@parm std::string [text]*/
+HuffmanWaveletTree::HuffmanWaveletTree(const std::string& text)
+	:size_(0) {
+
+	long long counts[NUM_LETTERS] = {};
+
+	for (unsigned int i = 0; i < text.size(); ++i) {
+
+		// only valid char 'a' - 'z'
+		if (text[i] >= 'a' && text[i] <= 'z') {
+			++counts[text[i] - 'a'];
+		} // end if
+
+	} // end for
+
+	HuffmanAlgorithm codec(counts);
+	build(codec, text);
+
+} // End of Constructor
+
+/** Constructor
+@pre None
+@post HuffmanWaveletTree Object created for the letters of text, shaped by the codebook of codec
+@parm HuffmanAlgorithm [codec], std::string [text]*/
+HuffmanWaveletTree::HuffmanWaveletTree(const HuffmanAlgorithm& codec, const std::string& text)
+	:size_(0) {
+
+	build(codec, text);
+
+} // End of Constructor
+
+/** build
+@pre None
+@post code tree taken from codec, bits_ filled with the letters of text
+@parm HuffmanAlgorithm [codec], std::string [text]*/
+void HuffmanWaveletTree::build(const HuffmanAlgorithm& codec, const std::string& text) {
+
+	// code tree as internal nodes, node 0 is the root
+	codec.branches(children_);
+
+	char letter = 'a';
+	for (int i = 0; i < NUM_LETTERS; ++i) {
+
+		codeBits_[i] = codec.codeBits(letter);
+		codeLengths_[i] = codec.codeLength(letter);
+		++letter;
+
+	} // end for
+
+	// each letter adds its code bits to the nodes on its path, in text order
+	bits_.assign(children_[0].size(), RankSelectBitVector());
+
+	for (unsigned int i = 0; i < text.size(); ++i) {
+
+		if (text[i] >= 'a' && text[i] <= 'z') {
+
+			const int index = text[i] - 'a';
+			int node = 0;
+
+			for (int bit = codeLengths_[index] - 1; bit >= 0; --bit) {
+
+				const int direction = static_cast<int>((codeBits_[index] >> bit) & 1);
+				bits_[node].pushBack(direction == 1);
+				node = children_[direction][node];
+
+			} // end for
+
+			++size_;
+
+		} // end if
+
+	} // end for
+
+	for (unsigned int node = 0; node < bits_.size(); ++node) {
+
+		bits_[node].build();
+
+	} // end for
+
+} // End of build
+
+/** access
+@pre i < size()
+@parm std::uint64_t [i]
+@return letter at position i*/
+char HuffmanWaveletTree::access(std::uint64_t i) const {
+
+	int node = 0;
+
+	while (node >= 0) {
+
+		const RankSelectBitVector& bits = bits_[node];
+
+		if (bits.get(i)) {
+
+			i = bits.rank1(i);
+			node = children_[1][node];
+
+		}
+		else {
+
+			i = bits.rank0(i);
+			node = children_[0][node];
+
+		} // end if
+
+	} // end while
+
+	return static_cast<char>('a' + (-1 - node));
+
+} // End of access
+
+/** rank
+@pre i <= size()
+@parm char [letter], std::uint64_t [i]
+@return number of letter in positions [0, i), 0 if letter is not 'a' - 'z'*/
+std::uint64_t HuffmanWaveletTree::rank(char letter, std::uint64_t i) const {
+
+	std::uint64_t result = 0;
+
+	if (letter >= 'a' && letter <= 'z') {
+
+		const int index = letter - 'a';
+		int node = 0;
+
+		// i becomes the number of letters before i that share the code so far
+		for (int bit = codeLengths_[index] - 1; bit >= 0; --bit) {
+
+			if ((codeBits_[index] >> bit) & 1) {
+
+				i = bits_[node].rank1(i);
+				node = children_[1][node];
+
+			}
+			else {
+
+				i = bits_[node].rank0(i);
+				node = children_[0][node];
+
+			} // end if
+
+		} // end for
+
+		result = i;
+
+	} // end if
+
+	return result;
+
+} // End of rank
+
+/** select
+@pre None
+@post position set to the position of the k-th letter, counted from 1
+@parm char [letter], std::uint64_t [k], std::uint64_t [position] passed by reference
+@return true if the text has at least k of letter*/
+bool HuffmanWaveletTree::select(char letter, std::uint64_t k, std::uint64_t& position) const {
+
+	bool found = false;
+
+	if (k > 0 && k <= count(letter)) {
+
+		const int index = letter - 'a';
+		const int length = codeLengths_[index];
+
+		// nodes on the letter's path, root first
+		int path[NUM_LETTERS];
+		int node = 0;
+
+		for (int depth = 0; depth < length; ++depth) {
+
+			path[depth] = node;
+			node = children_[(codeBits_[index] >> (length - 1 - depth)) & 1][node];
+
+		} // end for
+
+		// from the leaf up, the (k - 1)-th letter below a node is at its (k - 1)-th matching bit
+		std::uint64_t i = k - 1;
+
+		for (int depth = length - 1; depth >= 0; --depth) {
+
+			if ((codeBits_[index] >> (length - 1 - depth)) & 1) {
+				i = bits_[path[depth]].select1(i);
+			}
+			else {
+				i = bits_[path[depth]].select0(i);
+			} // end if
+
+		} // end for
+
+		position = i;
+		found = true;
+
+	} // end if
+
+	return found;
+
+} // End of select
+
+/** count
+@parm char [letter]
+@return number of letter in the text*/
+std::uint64_t HuffmanWaveletTree::count(char letter) const {
+
+	return rank(letter, size_);
+
+} // End of count
+
+/** size
+@return number of letters in the text*/
+std::uint64_t HuffmanWaveletTree::size() const {
+
+	return size_;
+
+} // End of size
+
+/** sizeInBits
+@return memory of the bit vectors and their directories, in bits*/
+std::uint64_t HuffmanWaveletTree::sizeInBits() const {
+
+	std::uint64_t total = 0;
+
+	for (unsigned int node = 0; node < bits_.size(); ++node) {
+
+		total += bits_[node].sizeInBits();
+
+	} // end for
+
+	return total;
+
+} // End of sizeInBits
@@ -0,0 +1,109 @@
+/** @file HuffmanWaveletTree.h
+ @author Anthony Campos
+ @date 10/19/2026
+ This header class file implements a HuffmanWaveletTree, a wavelet tree over the letters of a text
+ shaped like the code tree of a HuffmanAlgorithm, answering access, rank and select queries */
+
+	//---------------------------------------------------------------------------
+	// HuffmanWaveletTree class:  compressed letter index
+	//   included features:
+	//   -- every internal node of the code tree holds a RankSelectBitVector with
+	//			the next code bit of each letter that passes through it, so the
+	//			bits stored add up to the Huffman coded size of the text
+	//   -- access(i): the letter at i, one rank per code bit
+	//   -- rank(letter, i): occurrences of letter before i, one rank per code bit
+	//   -- select(letter, k): position of the k-th occurrence, one select per
+	//			code bit
+	//   -- frequent letters have short codes, so they are also the fastest to
+	//			query
+	//
+	// Assumptions:
+	//   --  like encode, chars other than 'a' - 'z' are skipped, positions count
+	//			letters only
+	//---------------------------------------------------------------------------
+
+#pragma once
+
+// Included libraries
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// included .h files
+#include "HuffmanAlgorithm.h"
+#include "RankSelectBitVector.h"
+
+
+class HuffmanWaveletTree {
+
+public:
+
+	/** Constructors */
+
+	/** Constructor
+	@pre None
+	@post HuffmanWaveletTree Object created for the letters of text, shaped by a code tree
+	built from the letter counts of text
+	@parm std::string [text]*/
+	HuffmanWaveletTree(const std::string& text);
+
+	/** Constructor
+	@pre None
+	@post HuffmanWaveletTree Object created for the letters of text, shaped by the codebook of codec
+	@parm HuffmanAlgorithm [codec], std::string [text]*/
+	HuffmanWaveletTree(const HuffmanAlgorithm& codec, const std::string& text);
+
+	/** Public Methods */
+
+	/** access
+	@pre i < size()
+	@parm std::uint64_t [i]
+	@return letter at position i*/
+	char access(std::uint64_t i) const;
+
+	/** rank
+	@pre i <= size()
+	@parm char [letter], std::uint64_t [i]
+	@return number of letter in positions [0, i), 0 if letter is not 'a' - 'z'*/
+	std::uint64_t rank(char letter, std::uint64_t i) const;
+
+	/** select
+	@pre None
+	@post position set to the position of the k-th letter, counted from 1
+	@parm char [letter], std::uint64_t [k], std::uint64_t [position] passed by reference
+	@return true if the text has at least k of letter*/
+	bool select(char letter, std::uint64_t k, std::uint64_t& position) const;
+
+	/** count
+	@parm char [letter]
+	@return number of letter in the text*/
+	std::uint64_t count(char letter) const;
+
+	/** Accessor Methods */
+
+	/** size
+	@return number of letters in the text*/
+	std::uint64_t size() const;
+
+	/** sizeInBits
+	@return memory of the bit vectors and their directories, in bits*/
+	std::uint64_t sizeInBits() const;
+
+private:
+
+	/** Private Attributes */
+	std::vector<int> children_[2]; // code tree, node 0 is the root, leaf for letter i is -1 - i
+	std::vector<RankSelectBitVector> bits_; // code bits passing through each node
+	std::uint64_t codeBits_[NUM_LETTERS]; // code of each letter, right aligned
+	int codeLengths_[NUM_LETTERS];
+	std::uint64_t size_;
+
+	/** Private Methods */
+
+	/** build
+	@pre None
+	@post code tree taken from codec, bits_ filled with the letters of text
+	@parm HuffmanAlgorithm [codec], std::string [text]*/
+	void build(const HuffmanAlgorithm& codec, const std::string& text);
+
+}; // End of HuffmanWaveletTree
@@ -0,0 +1,338 @@
+/** @file PhaseTimer.cpp
+ @author Anthony Campos
+ @date 10/19/2026
+ This implementation file implements scoped phase timers and counters that aggregate per thread
+ and export to Chrome trace JSON or a plain text summary */
+
+//---------------------------------------------------------------------------
+// PhaseTrace class:  per thread phase timing
+//   included features:
+//   -- HUFFMAN_TRACE_SCOPE(name) times the enclosing scope,
+//			HUFFMAN_TRACE_COUNTER(name, value) records a value
+//   -- both macros compile to nothing unless HUFFMAN_ENABLE_TRACING is defined
+//   -- every thread records into its own buffer, the buffer lock is only
+//			contended while an export reads it
+//   -- each thread keeps a total, count and maximum per name, and the first
+//			eventCapacity events for the trace, so long runs stay bounded
+//   -- allows for writing Chrome trace JSON (chrome://tracing, Perfetto) and
+//			a plain text summary per thread and name
+//
+// Assumptions:
+//   --  names are string literals, they are kept and compared by address
+//---------------------------------------------------------------------------
+
+
+// included .h files
+#include "PhaseTimer.h"
+
+// Included libraries
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+	// one phase or counter as it happened
+	struct TraceEvent {
+
+		const char* name_ = nullptr;
+		std::uint64_t startNs_ = 0;
+		std::uint64_t durationNs_ = 0; // phases only
+		long long value_ = 0; // counters only
+		bool counter_ = false;
+
+	}; // end of TraceEvent
+
+	// totals of one name
+	struct TraceTotal {
+
+		const char* name_ = nullptr;
+		bool counter_ = false;
+		std::uint64_t count_ = 0;
+		long long sum_ = 0; // nanoseconds for phases
+		long long max_ = 0;
+
+	}; // end of TraceTotal
+
+	// everything one thread recorded, owned by the registry so it outlives the thread
+	struct ThreadBuffer {
+
+		std::mutex mutex_;
+		int threadIndex_ = 0;
+		std::vector<TraceEvent> events_;
+		std::vector<TraceTotal> totals_; // few names per thread, a linear search is enough
+
+	}; // end of ThreadBuffer
+
+	std::mutex registryMutex;
+	std::vector<std::unique_ptr<ThreadBuffer> >& registry() {
+
+		static std::vector<std::unique_ptr<ThreadBuffer> > buffers;
+		return buffers;
+
+	} // End of registry
+
+	std::atomic<std::size_t> eventCapacity(DEFAULT_TRACE_EVENT_CAPACITY);
+	const std::chrono::steady_clock::time_point traceEpoch = std::chrono::steady_clock::now();
+
+	/** threadBuffer of the calling thread, registered on first use */
+	ThreadBuffer& threadBuffer() {
+
+		thread_local ThreadBuffer* buffer = nullptr;
+
+		if (buffer == nullptr) {
+
+			std::lock_guard<std::mutex> lock(registryMutex);
+			registry().push_back(std::unique_ptr<ThreadBuffer>(new ThreadBuffer()));
+			buffer = registry().back().get();
+			buffer->threadIndex_ = static_cast<int>(registry().size());
+
+		} // end if
+
+		return *buffer;
+
+	} // End of threadBuffer
+
+	/** record adds an event to the calling thread's totals and, while there is room, its events */
+	void record(const TraceEvent& event, long long amount) {
+
+		ThreadBuffer& buffer = threadBuffer();
+		std::lock_guard<std::mutex> lock(buffer.mutex_);
+
+		TraceTotal* total = nullptr;
+		for (std::size_t i = 0; i < buffer.totals_.size() && total == nullptr; ++i) {
+
+			if (buffer.totals_[i].name_ == event.name_ && buffer.totals_[i].counter_ == event.counter_) {
+				total = &buffer.totals_[i];
+			} // end if
+
+		} // end for
+
+		if (total == nullptr) {
+
+			buffer.totals_.push_back(TraceTotal());
+			total = &buffer.totals_.back();
+			total->name_ = event.name_;
+			total->counter_ = event.counter_;
+			total->max_ = amount;
+
+		} // end if
+
+		++total->count_;
+		total->sum_ += amount;
+		if (amount > total->max_) {
+			total->max_ = amount;
+		} // end if
+
+		if (buffer.events_.size() < eventCapacity.load(std::memory_order_relaxed)) {
+
+			buffer.events_.push_back(event);
+
+		} // end if
+
+	} // End of record
+
+	/** writeJsonString writes text as a JSON string */
+	void writeJsonString(std::ostream& out, const char* text) {
+
+		out << '"';
+		for (const char* c = text; *c != '\0'; ++c) {
+
+			if (*c == '"' || *c == '\\') {
+				out << '\\';
+			} // end if
+
+			out << *c;
+
+		} // end for
+
+		out << '"';
+
+	} // End of writeJsonString
+
+	/** writeMicroseconds writes ns as microseconds with three decimals, the unit of Chrome traces */
+	void writeMicroseconds(std::ostream& out, std::uint64_t ns) {
+
+		const std::uint64_t fraction = ns % 1000;
+		out << ns / 1000 << '.' << fraction / 100 << (fraction / 10) % 10 << fraction % 10;
+
+	} // End of writeMicroseconds
+
+} // end of namespace
+
+
+/** now
+@return nanoseconds since the trace clock started*/
+std::uint64_t PhaseTrace::now() {
+
+	return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now() - traceEpoch).count());
+
+} // End of now
+
+/** recordPhase
+@pre name is a string literal, startNs <= endNs
+@post phase added to the calling thread's totals and, while there is room, its events
+@parm char* [name], std::uint64_t [startNs], std::uint64_t [endNs]*/
+void PhaseTrace::recordPhase(const char* name, std::uint64_t startNs, std::uint64_t endNs) {
+
+	TraceEvent event;
+	event.name_ = name;
+	event.startNs_ = startNs;
+	event.durationNs_ = endNs - startNs;
+
+	record(event, static_cast<long long>(event.durationNs_));
+
+} // End of recordPhase
+
+/** recordCounter
+@pre name is a string literal
+@post value added to the calling thread's totals and, while there is room, its events
+@parm char* [name], long long [value]*/
+void PhaseTrace::recordCounter(const char* name, long long value) {
+
+	TraceEvent event;
+	event.name_ = name;
+	event.startNs_ = now();
+	event.value_ = value;
+	event.counter_ = true;
+
+	record(event, value);
+
+} // End of recordCounter
+
+/** writeChromeTrace
+@pre None
+@post every kept event of every thread written as Chrome trace JSON
+@parm std::ostream [out]*/
+void PhaseTrace::writeChromeTrace(std::ostream& out) {
+
+	std::lock_guard<std::mutex> registryLock(registryMutex);
+
+	out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+	bool first = true;
+
+	for (std::size_t b = 0; b < registry().size(); ++b) {
+
+		ThreadBuffer& buffer = *registry()[b];
+		std::lock_guard<std::mutex> lock(buffer.mutex_);
+
+		for (std::size_t i = 0; i < buffer.events_.size(); ++i) {
+
+			const TraceEvent& event = buffer.events_[i];
+
+			out << (first ? "\n" : ",\n") << "{\"name\":";
+			writeJsonString(out, event.name_);
+			out << ",\"pid\":1,\"tid\":" << buffer.threadIndex_ << ",\"ts\":";
+			writeMicroseconds(out, event.startNs_);
+
+			if (event.counter_) {
+
+				out << ",\"ph\":\"C\",\"args\":{\"value\":" << event.value_ << "}}";
+
+			}
+			else {
+
+				out << ",\"ph\":\"X\",\"dur\":";
+				writeMicroseconds(out, event.durationNs_);
+				out << "}";
+
+			} // end if
+
+			first = false;
+
+		} // end for
+
+	} // end for
+
+	out << "\n]}\n";
+
+} // End of writeChromeTrace
+
+/** writeSummary
+@pre None
+@post one line per thread and name: count, total, mean and max (phases) or sum (counters)
+@parm std::ostream [out]*/
+void PhaseTrace::writeSummary(std::ostream& out) {
+
+	std::lock_guard<std::mutex> registryLock(registryMutex);
+
+	out << "+=====+ Phase Summary +=====+\n";
+
+	for (std::size_t b = 0; b < registry().size(); ++b) {
+
+		ThreadBuffer& buffer = *registry()[b];
+		std::lock_guard<std::mutex> lock(buffer.mutex_);
+
+		for (std::size_t i = 0; i < buffer.totals_.size(); ++i) {
+
+			const TraceTotal& total = buffer.totals_[i];
+
+			out << "  thread " << buffer.threadIndex_ << " || " << total.name_ << " || count: " << total.count_;
+
+			if (total.counter_) {
+
+				out << "  sum: " << total.sum_ << "  max: " << total.max_ << "\n";
+
+			}
+			else {
+
+				out << "  total: " << total.sum_ / 1000 << " us  mean: " << total.sum_ / static_cast<long long>(total.count_)
+					<< " ns  max: " << total.max_ << " ns\n";
+
+			} // end if
+
+		} // end for
+
+	} // end for
+
+	out << "+=====+ +=============+ +=====+\n";
+
+} // End of writeSummary
+
+/** reset
+@pre None
+@post every thread's totals and events cleared*/
+void PhaseTrace::reset() {
+
+	std::lock_guard<std::mutex> registryLock(registryMutex);
+
+	for (std::size_t b = 0; b < registry().size(); ++b) {
+
+		ThreadBuffer& buffer = *registry()[b];
+		std::lock_guard<std::mutex> lock(buffer.mutex_);
+
+		buffer.events_.clear();
+		buffer.totals_.clear();
+
+	} // end for
+
+} // End of reset
+
+/** setEventCapacity
+@pre None
+@post each thread keeps at most capacity events from now on, totals are unaffected
+@parm std::size_t [capacity]*/
+void PhaseTrace::setEventCapacity(std::size_t capacity) {
+
+	eventCapacity.store(capacity, std::memory_order_relaxed);
+
+} // End of setEventCapacity
+
+/** Constructor
+@pre name is a string literal
+@post phase started
+@parm char* [name]*/
+ScopedPhase::ScopedPhase(const char* name)
+	:name_(name), startNs_(PhaseTrace::now())
+{} // End of Constructor
+
+/** Destructor
+@pre None
+@post phase recorded for the calling thread*/
+ScopedPhase::~ScopedPhase() {
+
+	PhaseTrace::recordPhase(name_, startNs_, PhaseTrace::now());
+
+} // End of Destructor
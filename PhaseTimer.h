@@ -0,0 +1,125 @@
+/** @file PhaseTimer.h
+ @author Anthony Campos
+ @date 10/19/2026
+ This header class file implements scoped phase timers and counters that aggregate per thread
+ and export to Chrome trace JSON or a plain text summary */
+
+	//---------------------------------------------------------------------------
+	// PhaseTrace class:  per thread phase timing
+	//   included features:
+	//   -- HUFFMAN_TRACE_SCOPE(name) times the enclosing scope,
+	//			HUFFMAN_TRACE_COUNTER(name, value) records a value
+	//   -- both macros compile to nothing unless HUFFMAN_ENABLE_TRACING is defined
+	//   -- every thread records into its own buffer, the buffer lock is only
+	//			contended while an export reads it
+	//   -- each thread keeps a total, count and maximum per name, and the first
+	//			eventCapacity events for the trace, so long runs stay bounded
+	//   -- allows for writing Chrome trace JSON (chrome://tracing, Perfetto) and
+	//			a plain text summary per thread and name
+	//
+	// Assumptions:
+	//   --  names are string literals, they are kept and compared by address
+	//---------------------------------------------------------------------------
+
+#pragma once
+
+// Included libraries
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+
+// Default number of events each thread keeps for the trace
+const std::size_t DEFAULT_TRACE_EVENT_CAPACITY = 1 << 16;
+
+#if defined(HUFFMAN_ENABLE_TRACING)
+
+#define HUFFMAN_TRACE_CONCAT_INNER(a, b) a##b
+#define HUFFMAN_TRACE_CONCAT(a, b) HUFFMAN_TRACE_CONCAT_INNER(a, b)
+#define HUFFMAN_TRACE_SCOPE(name) ScopedPhase HUFFMAN_TRACE_CONCAT(scopedPhase_, __LINE__)(name)
+#define HUFFMAN_TRACE_COUNTER(name, value) PhaseTrace::recordCounter((name), static_cast<long long>(value))
+
+#else
+
+#define HUFFMAN_TRACE_SCOPE(name) ((void)0)
+#define HUFFMAN_TRACE_COUNTER(name, value) ((void)0)
+
+#endif
+
+
+class PhaseTrace {
+
+public:
+
+	/** Public Methods */
+
+	/** now
+	@return nanoseconds since the trace clock started*/
+	static std::uint64_t now();
+
+	/** recordPhase
+	@pre name is a string literal, startNs <= endNs
+	@post phase added to the calling thread's totals and, while there is room, its events
+	@parm char* [name], std::uint64_t [startNs], std::uint64_t [endNs]*/
+	static void recordPhase(const char* name, std::uint64_t startNs, std::uint64_t endNs);
+
+	/** recordCounter
+	@pre name is a string literal
+	@post value added to the calling thread's totals and, while there is room, its events
+	@parm char* [name], long long [value]*/
+	static void recordCounter(const char* name, long long value);
+
+	/** writeChromeTrace
+	@pre None
+	@post every kept event of every thread written as Chrome trace JSON
+	@parm std::ostream [out]*/
+	static void writeChromeTrace(std::ostream& out);
+
+	/** writeSummary
+	@pre None
+	@post one line per thread and name: count, total, mean and max (phases) or sum (counters)
+	@parm std::ostream [out]*/
+	static void writeSummary(std::ostream& out);
+
+	/** reset
+	@pre None
+	@post every thread's totals and events cleared*/
+	static void reset();
+
+	/** setEventCapacity
+	@pre None
+	@post each thread keeps at most capacity events from now on, totals are unaffected
+	@parm std::size_t [capacity]*/
+	static void setEventCapacity(std::size_t capacity);
+
+}; // End of PhaseTrace
+
+
+class ScopedPhase {
+
+public:
+
+	/** Constructors & Destructor */
+
+	/** Constructor
+	@pre name is a string literal
+	@post phase started
+	@parm char* [name]*/
+	explicit ScopedPhase(const char* name);
+
+	/** Copy Constructor & Assignment disabled, a phase is recorded once */
+	ScopedPhase(const ScopedPhase& sourcePhase) = delete;
+	ScopedPhase& operator=(const ScopedPhase& rhsPhase) = delete;
+
+	/** Destructor
+	@pre None
+	@post phase recorded for the calling thread*/
+	~ScopedPhase();
+
+private:
+
+	/** Private Attributes */
+	const char* name_;
+	std::uint64_t startNs_;
+
+}; // End of ScopedPhase
@@ -0,0 +1,434 @@
+/** @file PipelinedCompressor.cpp
+ @author Anthony Campos
+ @date 10/19/2026
+ This implementation file implements a PipelinedCompressor that compresses a file with
+ HuffmanAlgorithm codes, overlapping file I/O with counting and encoding */
+
+//---------------------------------------------------------------------------
+// PipelinedCompressor class:  multi threaded file compressor
+//   included features:
+//   -- count pass, a reader thread and a histogram thread connected by
+//			BoundedQueues of recycled blocks
+//   -- encode pass, reader, encoder and writer threads connected by
+//			BoundedQueues, every block handed back once its stage is done so
+//			each stage always has a second block to fill (double buffering)
+//   -- codes are packed 8 per byte with a BitWriter
+//   -- allows for decompression of a file made by compressFile, a block at a
+//			time through a BitReader
+//
+// File layout:
+//   --  "HUFP", NUM_LETTERS little endian 8 byte counts, 8 byte bit count,
+//			then the packed code
+//
+// Assumptions:
+//   --  like HuffmanAlgorithm::getWord, only 'a' - 'z' are compressed,
+//			every other byte of the input is skipped
+//---------------------------------------------------------------------------
+
+
+// included .h files
+#include "PipelinedCompressor.h"
+#include "BoundedQueue.h"
+#include "BitStream.h"
+#include "ByteOrder.h"
+
+// Included libraries
+#include <atomic>
+#include <fstream>
+#include <memory>
+#include <thread>
+
+namespace {
+
+	// magic bytes at the start of every compressed file
+	const char FILE_MAGIC[4] = { 'H', 'U', 'F', 'P' };
+
+	/** readStage fills free blocks from in and passes them on until in is exhausted
+	@post full is closed, readFailed set if in went bad before the end of file*/
+	template <typename Block>
+	void readStage(std::istream& in, int blockSize, BoundedQueue<Block*>& freeBlocks,
+		BoundedQueue<Block*>& fullBlocks, std::uint64_t& bytesRead, std::atomic<bool>& readFailed) {
+
+		Block* block = nullptr;
+		bool reading = true;
+
+		while (reading && freeBlocks.pop(block)) {
+
+			in.read(reinterpret_cast<char*>(block->data_.data()), blockSize);
+			block->size_ = static_cast<int>(in.gcount());
+
+			if (block->size_ > 0) {
+
+				bytesRead += block->size_;
+				fullBlocks.push(block);
+
+			} // end if
+
+			if (!in) {
+
+				reading = false;
+				if (!in.eof()) {
+					readFailed = true;
+				} // end if
+
+			} // end if
+
+		} // end while
+
+		fullBlocks.close();
+
+	} // End of readStage
+
+} // end of namespace
+
+
+/** Constructor
+@pre blockSize > 0, queueDepth > 0
+@post PipelinedCompressor Object created
+@parm int [blockSize] bytes per I/O block, int [queueDepth] blocks in flight per stage*/
+PipelinedCompressor::PipelinedCompressor(int blockSize, int queueDepth)
+	:blockSize_(blockSize), queueDepth_(queueDepth), bytesRead_(0), bitsWritten_(0)
+{} // End of Constructor
+
+/** compressFile
+@pre None
+@post outPath holds the header and packed code of the letters of inPath
+@parm std::string [inPath], std::string [outPath]
+@return true if both files could be read and written, otherwise false*/
+bool PipelinedCompressor::compressFile(const std::string& inPath, const std::string& outPath) {
+
+	bytesRead_ = 0;
+	bitsWritten_ = 0;
+
+	long long counts[NUM_LETTERS] = {};
+	if (!countPass(inPath, counts)) {
+		return false;
+	} // end if
+
+	HuffmanAlgorithm codec(counts);
+
+	// total bits is known up front, so the header can be written before encoding
+	std::uint64_t totalBits = 0;
+	char letter = 'a';
+	for (int i = 0; i < NUM_LETTERS; ++i) {
+
+		totalBits += static_cast<std::uint64_t>(counts[i]) * codec.codeLength(letter);
+		++letter;
+
+	} // end for
+
+	std::ofstream out(outPath, std::ios::binary | std::ios::trunc);
+	if (!out) {
+		return false;
+	} // end if
+
+	out.write(FILE_MAGIC, sizeof(FILE_MAGIC));
+	for (int i = 0; i < NUM_LETTERS; ++i) {
+
+		writeUint(out, static_cast<std::uint64_t>(counts[i]), 8);
+
+	} // end for
+	writeUint(out, totalBits, 8);
+
+	// counted bytes are read again by the encode pass
+	bytesRead_ = 0;
+
+	bool encoded = encodePass(inPath, out, codec);
+
+	return encoded && bitsWritten_ == totalBits;
+
+} // End of compressFile
+
+/** countPass
+@pre None
+@post counts holds the letter counts of inPath
+@parm std::string [inPath], long long [] [counts]
+@return true if the file could be read, otherwise false*/
+bool PipelinedCompressor::countPass(const std::string& inPath, long long(&counts)[NUM_LETTERS]) {
+
+	std::ifstream in(inPath, std::ios::binary);
+	if (!in) {
+		return false;
+	} // end if
+
+	const int blockCount = queueDepth_ + 1;
+	std::vector<std::unique_ptr<Block>> pool;
+	BoundedQueue<Block*> freeBlocks(blockCount);
+	BoundedQueue<Block*> fullBlocks(blockCount);
+
+	for (int i = 0; i < blockCount; ++i) {
+
+		pool.push_back(std::unique_ptr<Block>(new Block));
+		pool.back()->data_.resize(blockSize_);
+		Block* block = pool.back().get();
+		freeBlocks.push(block);
+
+	} // end for
+
+	std::atomic<bool> readFailed(false);
+
+	std::thread reader(readStage<Block>, std::ref(in), blockSize_, std::ref(freeBlocks),
+		std::ref(fullBlocks), std::ref(bytesRead_), std::ref(readFailed));
+
+	std::thread histogram([&]() {
+
+		long long byteCounts[256] = {};
+		Block* block = nullptr;
+
+		while (fullBlocks.pop(block)) {
+
+			const unsigned char* data = block->data_.data();
+			for (int i = 0; i < block->size_; ++i) {
+
+				++byteCounts[data[i]];
+
+			} // end for
+
+			freeBlocks.push(block);
+
+		} // end while
+
+		for (int i = 0; i < NUM_LETTERS; ++i) {
+
+			counts[i] = byteCounts['a' + i];
+
+		} // end for
+
+	});
+
+	reader.join();
+	histogram.join();
+
+	return !readFailed;
+
+} // End of countPass
+
+/** encodePass
+@pre out already holds the header
+@post packed code of every letter of inPath appended to out
+@parm std::string [inPath], std::ostream [out], HuffmanAlgorithm [codec]
+@return true if the file could be read and out written, otherwise false*/
+bool PipelinedCompressor::encodePass(const std::string& inPath, std::ostream& out, const HuffmanAlgorithm& codec) {
+
+	std::ifstream in(inPath, std::ios::binary);
+	if (!in) {
+		return false;
+	} // end if
+
+	// codes as right aligned bits, indexed by byte so non-letters have length 0
+	std::uint64_t codeBits[256] = {};
+	int codeLengths[256] = {};
+	char letter = 'a';
+	for (int i = 0; i < NUM_LETTERS; ++i) {
+
+		codeBits['a' + i] = codec.codeBits(letter);
+		codeLengths['a' + i] = codec.codeLength(letter);
+		++letter;
+
+	} // end for
+
+	const int blockCount = queueDepth_ + 1;
+	std::vector<std::unique_ptr<Block>> pool;
+	BoundedQueue<Block*> freeIn(blockCount);
+	BoundedQueue<Block*> fullIn(blockCount);
+	BoundedQueue<Block*> freeOut(blockCount);
+	BoundedQueue<Block*> fullOut(blockCount);
+
+	for (int i = 0; i < 2 * blockCount; ++i) {
+
+		pool.push_back(std::unique_ptr<Block>(new Block));
+		Block* block = pool.back().get();
+
+		if (i < blockCount) {
+
+			block->data_.resize(blockSize_);
+			freeIn.push(block);
+
+		}
+		else {
+
+			freeOut.push(block);
+
+		} // end if
+
+	} // end for
+
+	std::atomic<bool> readFailed(false);
+	std::atomic<bool> writeFailed(false);
+
+	std::thread reader(readStage<Block>, std::ref(in), blockSize_, std::ref(freeIn),
+		std::ref(fullIn), std::ref(bytesRead_), std::ref(readFailed));
+
+	std::thread encoder([&]() {
+
+		BitWriter writer;
+		Block* block = nullptr;
+		Block* outBlock = nullptr;
+
+		while (fullIn.pop(block)) {
+
+			const unsigned char* data = block->data_.data();
+			for (int i = 0; i < block->size_; ++i) {
+
+				writer.writeBits(codeBits[data[i]], codeLengths[data[i]]);
+
+			} // end for
+
+			freeIn.push(block);
+
+			// hand a full output block to the writer, take its previous buffer back
+			if (writer.bytes().size() >= static_cast<unsigned int>(blockSize_) && freeOut.pop(outBlock)) {
+
+				writer.swapBytes(outBlock->data_);
+				outBlock->size_ = static_cast<int>(outBlock->data_.size());
+				fullOut.push(outBlock);
+
+			} // end if
+
+		} // end while
+
+		writer.finish();
+		bitsWritten_ = writer.bitCount();
+
+		if (!writer.bytes().empty() && freeOut.pop(outBlock)) {
+
+			writer.swapBytes(outBlock->data_);
+			outBlock->size_ = static_cast<int>(outBlock->data_.size());
+			fullOut.push(outBlock);
+
+		} // end if
+
+		fullOut.close();
+
+	});
+
+	std::thread writerThread([&]() {
+
+		Block* block = nullptr;
+
+		while (fullOut.pop(block)) {
+
+			out.write(reinterpret_cast<const char*>(block->data_.data()), block->size_);
+			if (!out) {
+				writeFailed = true;
+			} // end if
+
+			freeOut.push(block);
+
+		} // end while
+
+		out.flush();
+
+	});
+
+	reader.join();
+	encoder.join();
+	writerThread.join();
+
+	return !readFailed && !writeFailed && out.good();
+
+} // End of encodePass
+
+/** decompressFile
+@pre inPath was written by compressFile
+@post outPath holds the letters of the original file
+@parm std::string [inPath], std::string [outPath]
+@return true if the file was valid (counts >= 0 summing below 2^63, code ending on a
+complete letter) and could be written, otherwise false*/
+bool PipelinedCompressor::decompressFile(const std::string& inPath, const std::string& outPath) const {
+
+	std::ifstream in(inPath, std::ios::binary);
+	if (!in) {
+		return false;
+	} // end if
+
+	char magic[sizeof(FILE_MAGIC)] = {};
+	in.read(magic, sizeof(magic));
+	if (!in || std::string(magic, sizeof(magic)) != std::string(FILE_MAGIC, sizeof(FILE_MAGIC))) {
+		return false;
+	} // end if
+
+	// the counts come from the file, HuffmanAlgorithm needs each >= 0 and their sum < 2^63
+	const std::uint64_t countLimit = std::uint64_t(1) << 63;
+	std::uint64_t total = 0;
+	bool countsValid = true;
+
+	long long counts[NUM_LETTERS];
+	for (int i = 0; i < NUM_LETTERS; ++i) {
+
+		const std::uint64_t count = readUint(in, 8);
+		countsValid = countsValid && count < countLimit - total;
+		total += countsValid ? count : 0;
+		counts[i] = countsValid ? static_cast<long long>(count) : 0;
+
+	} // end for
+	std::uint64_t remainingBits = readUint(in, 8);
+
+	if (!in || !countsValid) {
+		return false;
+	} // end if
+
+	HuffmanAlgorithm codec(counts);
+
+	std::ofstream out(outPath, std::ios::binary | std::ios::trunc);
+	if (!out) {
+		return false;
+	} // end if
+
+	// packed code of this block, after the bytes of a code split across the last two blocks
+	std::vector<unsigned char> code{};
+	std::uint64_t codeBits = 0;
+	std::uint64_t startBit = 0;
+	std::string text{};
+
+	while (remainingBits > 0 && in) {
+
+		const std::size_t kept = code.size();
+		code.resize(kept + blockSize_);
+		in.read(reinterpret_cast<char*>(code.data() + kept), blockSize_);
+
+		const std::uint64_t bytes = static_cast<std::uint64_t>(in.gcount());
+		code.resize(kept + static_cast<std::size_t>(bytes));
+
+		const std::uint64_t newBits = (8 * bytes < remainingBits) ? 8 * bytes : remainingBits;
+		codeBits += newBits;
+		remainingBits -= newBits;
+
+		BitReader reader(code.data(), codeBits, startBit);
+		char letter = '\0';
+		while (reader.remaining() > 0 && codec.decodeLetter(reader, letter)) {
+
+			text += letter;
+
+		} // end while
+
+		// keep the bytes of the incomplete code, if any
+		const std::uint64_t usedBytes = reader.position() / 8;
+		code.erase(code.begin(), code.begin() + static_cast<std::size_t>(usedBytes));
+		codeBits -= 8 * usedBytes;
+		startBit = reader.position() % 8;
+
+		out.write(text.data(), text.size());
+		text.clear();
+
+	} // end while
+
+	return remainingBits == 0 && startBit == codeBits && out.good();
+
+} // End of decompressFile
+
+/** bytesRead
+@return bytes of input read by the last compressFile*/
+std::uint64_t PipelinedCompressor::bytesRead() const {
+
+	return bytesRead_;
+
+} // End of bytesRead
+
+/** bitsWritten
+@return code bits written by the last compressFile, header excluded*/
+std::uint64_t PipelinedCompressor::bitsWritten() const {
+
+	return bitsWritten_;
+
+} // End of bitsWritten
@@ -0,0 +1,117 @@
+/** @file PipelinedCompressor.h
+ @author Anthony Campos
+ @date 10/19/2026
+ This header class file implements a PipelinedCompressor that compresses a file with
+ HuffmanAlgorithm codes, overlapping file I/O with counting and encoding */
+
+	//---------------------------------------------------------------------------
+	// PipelinedCompressor class:  multi threaded file compressor
+	//   included features:
+	//   -- count pass, a reader thread and a histogram thread connected by
+	//			BoundedQueues of recycled blocks
+	//   -- encode pass, reader, encoder and writer threads connected by
+	//			BoundedQueues, every block handed back once its stage is done so
+	//			each stage always has a second block to fill (double buffering)
+	//   -- codes are packed 8 per byte with a BitWriter
+	//   -- allows for decompression of a file made by compressFile, a block at a
+	//			time through a BitReader
+	//
+	// File layout:
+	//   --  "HUFP", NUM_LETTERS little endian 8 byte counts, 8 byte bit count,
+	//			then the packed code
+	//
+	// Assumptions:
+	//   --  like HuffmanAlgorithm::getWord, only 'a' - 'z' are compressed,
+	//			every other byte of the input is skipped
+	//---------------------------------------------------------------------------
+
+#pragma once
+
+// Included libraries
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// included .h files
+#include "HuffmanAlgorithm.h"
+
+// Default size in bytes of each I/O block
+const int DEFAULT_BLOCK_SIZE = 1 << 20;
+
+// Default number of blocks in flight between two stages
+const int DEFAULT_QUEUE_DEPTH = 2;
+
+
+class PipelinedCompressor {
+
+public:
+
+	/** Constructors */
+
+	/** Constructor
+	@pre blockSize > 0, queueDepth > 0
+	@post PipelinedCompressor Object created
+	@parm int [blockSize] bytes per I/O block, int [queueDepth] blocks in flight per stage*/
+	explicit PipelinedCompressor(int blockSize = DEFAULT_BLOCK_SIZE, int queueDepth = DEFAULT_QUEUE_DEPTH);
+
+	/** Public Methods */
+
+	/** compressFile
+	@pre None
+	@post outPath holds the header and packed code of the letters of inPath
+	@parm std::string [inPath], std::string [outPath]
+	@return true if both files could be read and written, otherwise false*/
+	bool compressFile(const std::string& inPath, const std::string& outPath);
+
+	/** decompressFile
+	@pre inPath was written by compressFile
+	@post outPath holds the letters of the original file
+	@parm std::string [inPath], std::string [outPath]
+	@return true if the file was valid (counts >= 0 summing below 2^63, code ending on a
+	complete letter) and could be written, otherwise false*/
+	bool decompressFile(const std::string& inPath, const std::string& outPath) const;
+
+	/** Accessor Methods */
+
+	/** bytesRead
+	@return bytes of input read by the last compressFile*/
+	std::uint64_t bytesRead() const;
+
+	/** bitsWritten
+	@return code bits written by the last compressFile, header excluded*/
+	std::uint64_t bitsWritten() const;
+
+private:
+
+	/** Private Attributes */
+
+	struct Block {
+
+		std::vector<unsigned char> data_;
+		int size_ = 0; // bytes of data_ in use
+
+	}; // end of Block
+
+	int blockSize_;
+	int queueDepth_;
+	std::uint64_t bytesRead_;
+	std::uint64_t bitsWritten_;
+
+	/** Private Methods */
+
+	/** countPass
+	@pre None
+	@post counts holds the letter counts of inPath
+	@parm std::string [inPath], long long [] [counts]
+	@return true if the file could be read, otherwise false*/
+	bool countPass(const std::string& inPath, long long(&counts)[NUM_LETTERS]);
+
+	/** encodePass
+	@pre out already holds the header
+	@post packed code of every letter of inPath appended to out
+	@parm std::string [inPath], std::ostream [out], HuffmanAlgorithm [codec]
+	@return true if the file could be read and out written, otherwise false*/
+	bool encodePass(const std::string& inPath, std::ostream& out, const HuffmanAlgorithm& codec);
+
+}; // End of PipelinedCompressor
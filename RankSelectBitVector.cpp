@@ -0,0 +1,282 @@
+/** @file RankSelectBitVector.cpp
+ @author Anthony Campos
+ @date 10/19/2026
+ This implementation file implements a RankSelectBitVector, a static bit vector that answers rank
+ and select queries with a small directory on top of the bits */
+
+//---------------------------------------------------------------------------
+// RankSelectBitVector class:  succinct bit vector
+//   included features:
+//   -- bits are appended while building, then build() adds the directory
+//   -- rank: the count of 1 bits before every 512 bit block (64 bits per
+//			512, 12.5% extra), plus at most 8 popcounts inside the block
+//   -- select: the block of every 4096th 1 (and 0) is sampled, a binary
+//			search between two samples finds the block, then at most 8 words
+//			are scanned
+//
+// Assumptions:
+//   --  no bits are appended after build
+//---------------------------------------------------------------------------
+
+
+// included .h files
+#include "RankSelectBitVector.h"
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace {
+
+	const int WORDS_PER_BLOCK = 8;
+	const std::uint64_t BLOCK_BITS = 64 * WORDS_PER_BLOCK;
+	const std::uint64_t SELECT_SAMPLE = 4096;
+
+	/** popcount of a word, the hardware instruction where the compiler offers one */
+	inline int popcount(std::uint64_t word) {
+
+#if defined(__GNUC__) || defined(__clang__)
+		return __builtin_popcountll(word);
+#elif defined(_MSC_VER) && defined(_M_X64)
+		return static_cast<int>(__popcnt64(word));
+#else
+		word = word - ((word >> 1) & 0x5555555555555555ULL);
+		word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+		word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+		return static_cast<int>((word * 0x0101010101010101ULL) >> 56);
+#endif
+
+	} // End of popcount
+
+	/** selectInWord: position of the 1 bit of word with k 1 bits below it */
+	inline int selectInWord(std::uint64_t word, std::uint64_t k) {
+
+		for (std::uint64_t i = 0; i < k; ++i) {
+			word &= word - 1;
+		} // end for
+
+		int position = 0;
+		while (((word >> position) & 1) == 0) {
+			++position;
+		} // end while
+
+		return position;
+
+	} // End of selectInWord
+
+} // end of namespace
+
+
+/** Defualt Constructor
+@pre None
+@post Empty RankSelectBitVector Object created*/
+RankSelectBitVector::RankSelectBitVector()
+	:size_(0)
+{} // End of Constructor
+
+/** pushBack
+@pre build not yet called
+@post bit appended
+@parm bool [bit]*/
+void RankSelectBitVector::pushBack(bool bit) {
+
+	if (size_ % 64 == 0) {
+		words_.push_back(0);
+	} // end if
+
+	if (bit) {
+		words_.back() |= static_cast<std::uint64_t>(1) << (size_ % 64);
+	} // end if
+
+	++size_;
+
+} // End of pushBack
+
+/** build
+@pre None
+@post rank and select directory built over the bits appended so far*/
+void RankSelectBitVector::build() {
+
+	const std::size_t blocks = (words_.size() + WORDS_PER_BLOCK - 1) / WORDS_PER_BLOCK;
+
+	blockRanks_.assign(blocks + 1, 0);
+	selectOnes_.clear();
+	selectZeros_.clear();
+
+	std::uint64_t onesBefore = 0;
+	for (std::size_t block = 0; block < blocks; ++block) {
+
+		blockRanks_[block] = onesBefore;
+
+		for (std::size_t w = block * WORDS_PER_BLOCK; w < words_.size() && w < (block + 1) * WORDS_PER_BLOCK; ++w) {
+
+			onesBefore += popcount(words_[w]);
+
+		} // end for
+
+		// sample the block that holds 1 number s * SELECT_SAMPLE, likewise for 0
+		std::uint64_t blockEnd = (block + 1) * BLOCK_BITS;
+		if (blockEnd > size_) {
+			blockEnd = size_;
+		} // end if
+
+		const std::uint64_t zerosAfter = blockEnd - onesBefore;
+		while (selectOnes_.size() * SELECT_SAMPLE < onesBefore) {
+			selectOnes_.push_back(static_cast<std::uint32_t>(block));
+		} // end while
+		while (selectZeros_.size() * SELECT_SAMPLE < zerosAfter) {
+			selectZeros_.push_back(static_cast<std::uint32_t>(block));
+		} // end while
+
+	} // end for
+
+	blockRanks_[blocks] = onesBefore;
+
+} // End of build
+
+/** get
+@pre i < size()
+@parm std::uint64_t [i]
+@return bit i*/
+bool RankSelectBitVector::get(std::uint64_t i) const {
+
+	return ((words_[static_cast<std::size_t>(i / 64)] >> (i % 64)) & 1) != 0;
+
+} // End of get
+
+/** rank1
+@pre build called, i <= size()
+@parm std::uint64_t [i]
+@return number of 1 bits in [0, i)*/
+std::uint64_t RankSelectBitVector::rank1(std::uint64_t i) const {
+
+	const std::size_t word = static_cast<std::size_t>(i / 64);
+	std::uint64_t rank = blockRanks_[word / WORDS_PER_BLOCK];
+
+	for (std::size_t w = (word / WORDS_PER_BLOCK) * WORDS_PER_BLOCK; w < word; ++w) {
+
+		rank += popcount(words_[w]);
+
+	} // end for
+
+	if (i % 64 != 0) {
+
+		rank += popcount(words_[word] & ((static_cast<std::uint64_t>(1) << (i % 64)) - 1));
+
+	} // end if
+
+	return rank;
+
+} // End of rank1
+
+/** rank0
+@pre build called, i <= size()
+@parm std::uint64_t [i]
+@return number of 0 bits in [0, i)*/
+std::uint64_t RankSelectBitVector::rank0(std::uint64_t i) const {
+
+	return i - rank1(i);
+
+} // End of rank0
+
+/** select1
+@pre build called, k < ones()
+@parm std::uint64_t [k]
+@return position of the 1 bit with k 1 bits before it*/
+std::uint64_t RankSelectBitVector::select1(std::uint64_t k) const {
+
+	return select(k, true);
+
+} // End of select1
+
+/** select0
+@pre build called, k < size() - ones()
+@parm std::uint64_t [k]
+@return position of the 0 bit with k 0 bits before it*/
+std::uint64_t RankSelectBitVector::select0(std::uint64_t k) const {
+
+	return select(k, false);
+
+} // End of select0
+
+/** blockRank
+@parm std::size_t [block], bool [bit]
+@return number of bit valued bits before block*/
+std::uint64_t RankSelectBitVector::blockRank(std::size_t block, bool bit) const {
+
+	return bit ? blockRanks_[block] : block * BLOCK_BITS - blockRanks_[block];
+
+} // End of blockRank
+
+/** select
+@pre build called, k < the number of bit valued bits
+@parm std::uint64_t [k], bool [bit]
+@return position of the bit valued bit with k of them before it*/
+std::uint64_t RankSelectBitVector::select(std::uint64_t k, bool bit) const {
+
+	const std::vector<std::uint32_t>& samples = bit ? selectOnes_ : selectZeros_;
+	const std::size_t sample = static_cast<std::size_t>(k / SELECT_SAMPLE);
+
+	// the block is the last one with fewer than k + 1 matching bits before it
+	std::size_t low = samples[sample];
+	std::size_t high = (sample + 1 < samples.size()) ? samples[sample + 1] : blockRanks_.size() - 2;
+
+	while (low < high) {
+
+		std::size_t middle = (low + high + 1) / 2;
+
+		if (blockRank(middle, bit) <= k) {
+			low = middle;
+		}
+		else {
+			high = middle - 1;
+		} // end if
+
+	} // end while
+
+	std::uint64_t remaining = k - blockRank(low, bit);
+	std::size_t word = low * WORDS_PER_BLOCK;
+
+	while (true) {
+
+		const std::uint64_t bits = bit ? words_[word] : ~words_[word];
+		const std::uint64_t count = popcount(bits);
+
+		if (remaining < count) {
+			break;
+		} // end if
+
+		remaining -= count;
+		++word;
+
+	} // end while
+
+	const std::uint64_t bits = bit ? words_[word] : ~words_[word];
+
+	return word * 64 + selectInWord(bits, remaining);
+
+} // End of select
+
+/** size
+@return number of bits*/
+std::uint64_t RankSelectBitVector::size() const {
+
+	return size_;
+
+} // End of size
+
+/** ones
+@return number of 1 bits*/
+std::uint64_t RankSelectBitVector::ones() const {
+
+	return blockRanks_.empty() ? 0 : blockRanks_.back();
+
+} // End of ones
+
+/** sizeInBits
+@return memory of the bits and the directory, in bits*/
+std::uint64_t RankSelectBitVector::sizeInBits() const {
+
+	return 64 * (words_.size() + blockRanks_.size()) + 32 * (selectOnes_.size() + selectZeros_.size());
+
+} // End of sizeInBits
@@ -0,0 +1,120 @@
+/** @file RankSelectBitVector.h
+ @author Anthony Campos
+ @date 10/19/2026
+ This header class file implements a RankSelectBitVector, a static bit vector that answers rank
+ and select queries with a small directory on top of the bits */
+
+	//---------------------------------------------------------------------------
+	// RankSelectBitVector class:  succinct bit vector
+	//   included features:
+	//   -- bits are appended while building, then build() adds the directory
+	//   -- rank: the count of 1 bits before every 512 bit block (64 bits per
+	//			512, 12.5% extra), plus at most 8 popcounts inside the block
+	//   -- select: the block of every 4096th 1 (and 0) is sampled, a binary
+	//			search between two samples finds the block, then at most 8 words
+	//			are scanned
+	//
+	// Assumptions:
+	//   --  no bits are appended after build
+	//---------------------------------------------------------------------------
+
+#pragma once
+
+// Included libraries
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+class RankSelectBitVector {
+
+public:
+
+	/** Constructors */
+
+	/** Defualt Constructor
+	@pre None
+	@post Empty RankSelectBitVector Object created*/
+	RankSelectBitVector();
+
+	/** Public Methods */
+
+	/** pushBack
+	@pre build not yet called
+	@post bit appended
+	@parm bool [bit]*/
+	void pushBack(bool bit);
+
+	/** build
+	@pre None
+	@post rank and select directory built over the bits appended so far*/
+	void build();
+
+	/** get
+	@pre i < size()
+	@parm std::uint64_t [i]
+	@return bit i*/
+	bool get(std::uint64_t i) const;
+
+	/** rank1
+	@pre build called, i <= size()
+	@parm std::uint64_t [i]
+	@return number of 1 bits in [0, i)*/
+	std::uint64_t rank1(std::uint64_t i) const;
+
+	/** rank0
+	@pre build called, i <= size()
+	@parm std::uint64_t [i]
+	@return number of 0 bits in [0, i)*/
+	std::uint64_t rank0(std::uint64_t i) const;
+
+	/** select1
+	@pre build called, k < ones()
+	@parm std::uint64_t [k]
+	@return position of the 1 bit with k 1 bits before it*/
+	std::uint64_t select1(std::uint64_t k) const;
+
+	/** select0
+	@pre build called, k < size() - ones()
+	@parm std::uint64_t [k]
+	@return position of the 0 bit with k 0 bits before it*/
+	std::uint64_t select0(std::uint64_t k) const;
+
+	/** Accessor Methods */
+
+	/** size
+	@return number of bits*/
+	std::uint64_t size() const;
+
+	/** ones
+	@return number of 1 bits*/
+	std::uint64_t ones() const;
+
+	/** sizeInBits
+	@return memory of the bits and the directory, in bits*/
+	std::uint64_t sizeInBits() const;
+
+private:
+
+	/** Private Attributes */
+	std::vector<std::uint64_t> words_; // bit i is bit i % 64 of word i / 64
+	std::uint64_t size_;
+
+	std::vector<std::uint64_t> blockRanks_; // 1 bits before each 512 bit block, one extra at the end
+	std::vector<std::uint32_t> selectOnes_; // block of every 4096th 1 bit
+	std::vector<std::uint32_t> selectZeros_; // block of every 4096th 0 bit
+
+	/** Private Methods */
+
+	/** blockRank
+	@parm std::size_t [block], bool [bit]
+	@return number of bit valued bits before block*/
+	std::uint64_t blockRank(std::size_t block, bool bit) const;
+
+	/** select
+	@pre build called, k < the number of bit valued bits
+	@parm std::uint64_t [k], bool [bit]
+	@return position of the bit valued bit with k of them before it*/
+	std::uint64_t select(std::uint64_t k, bool bit) const;
+
+}; // End of RankSelectBitVector
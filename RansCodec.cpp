@@ -0,0 +1,242 @@
+/** @file RansCodec.cpp
+ @author Anthony Campos
+ @date 10/19/2026
+ This implementation file implements a RansCodec, a range asymmetric numeral systems (rANS)
+ coder built from the same 'a' - 'z' counts as HuffmanAlgorithm */
+
+//---------------------------------------------------------------------------
+// RansCodec class:  rANS entropy coding
+//   included features:
+//   -- allows construction by the int or 64 bit count arrays HuffmanAlgorithm takes
+//   -- counts are quantized to frequencies summing to 2^RANS_PRECISION_BITS,
+//			every letter keeps a frequency of at least 1
+//   -- codes close to the entropy of the counts, letters are not rounded
+//			to whole bits the way Huffman codes are
+//   -- same surface as HuffmanAlgorithm: getWord / decipher on '0'/'1' text,
+//			encode / decode on PackedCode
+//   -- decodes a letter with one table lookup and renormalizes by bytes
+//
+// Assumptions:
+//   --  index 0-25 represents 'a' - 'z' .
+//   --  chars other than 'a' - 'z' are skipped by encode
+//   --  a code is a whole number of bytes, the encoder writes backwards so the
+//			decoder reads forwards
+//---------------------------------------------------------------------------
+
+
+// included .h files
+#include "RansCodec.h"
+#include "BitPacking.h"
+
+// Included libraries
+#include <algorithm>
+
+
+/** Constructor
+@pre all indexes must have a integer value >= 0
+@post RansCodec Object is created with frequencies quantized from counts
+@parm int* [] [counts], frequency for each letter from 'a' to 'z'*/
+RansCodec::RansCodec(int(&counts)[NUM_LETTERS]) {
+
+	long long wideCounts[NUM_LETTERS];
+	for (int i = 0; i < NUM_LETTERS; ++i) {
+
+		wideCounts[i] = counts[i];
+
+	} // end for
+
+	build(wideCounts);
+
+} // End of Constructor
+
+/** Constructor
+@pre all indexes must have a integer value >= 0, their sum < 2^63
+@post RansCodec Object is created with frequencies quantized from counts
+@parm long long* [] [counts], frequency for each letter from 'a' to 'z'*/
+RansCodec::RansCodec(long long(&counts)[NUM_LETTERS]) {
+
+	build(counts);
+
+} // End of Constructor
+
+/** build
+@pre all indexes must have a integer value >= 0, their sum < 2^63
+@post frequencies_, starts_ and slots_ computed from counts
+@parm long long* [] [counts]*/
+void RansCodec::build(const long long(&counts)[NUM_LETTERS]) {
+
+	const std::uint32_t total = 1u << RANS_PRECISION_BITS;
+
+	double countTotal = 0.0;
+	for (int i = 0; i < NUM_LETTERS; ++i) {
+
+		countTotal += static_cast<double>(counts[i]);
+
+	} // end for
+
+	// scale to total, rounding, and keep every letter encodable
+	std::uint32_t sum = 0;
+	int largest = 0;
+	for (int i = 0; i < NUM_LETTERS; ++i) {
+
+		double scaled = (countTotal > 0.0) ? counts[i] * (total / countTotal) : total / NUM_LETTERS;
+		std::uint32_t frequency = static_cast<std::uint32_t>(scaled + 0.5);
+
+		frequencies_[i] = (frequency > 0) ? frequency : 1;
+		sum += frequencies_[i];
+
+		if (frequencies_[i] > frequencies_[largest]) {
+			largest = i;
+		} // end if
+
+	} // end for
+
+	// rounding leaves the sum a few off, the largest frequency absorbs the difference.
+	// The minimums add at most NUM_LETTERS, far below the largest frequency
+	frequencies_[largest] = frequencies_[largest] + total - sum;
+
+	std::uint32_t start = 0;
+	slots_.assign(total, 0);
+	for (int i = 0; i < NUM_LETTERS; ++i) {
+
+		starts_[i] = start;
+		std::fill(slots_.begin() + start, slots_.begin() + start + frequencies_[i], static_cast<unsigned char>(i));
+		start += frequencies_[i];
+
+	} // end for
+
+} // End of build
+
+/** getWord
+@pre None
+@post all lowercase letters of provided string are encoded
+@parm std::string [in]
+@return the code of in as '0'/'1' text*/
+std::string RansCodec::getWord(std::string in) const {
+
+	return unpackAscii(encode(in));
+
+} // End of getWord
+
+/** decipher
+@pre provided code was generated by getWord of a RansCodec with the same counts
+@post None
+@parm std::string [in]
+@return text representation of provided code*/
+std::string RansCodec::decipher(std::string in) const {
+
+	return decode(packAscii(in));
+
+} // End of decipher
+
+/** encode
+@pre None
+@post all lowercase letters of provided string are encoded
+@parm std::string [in]
+@return packed code of in*/
+PackedCode RansCodec::encode(const std::string& in) const {
+
+	// written back to front, reversed at the end
+	std::vector<unsigned char> reversed;
+	reversed.reserve(in.size() / 2 + 4);
+
+	std::uint32_t state = RANS_STATE_LOW;
+
+	for (std::size_t i = in.size(); i > 0; --i) {
+
+		char c = in[i - 1];
+		// only valid char 'a' - 'z'
+		if (c >= 'a' && c <= 'z') {
+
+			const int letter = c - 'a';
+			const std::uint32_t frequency = frequencies_[letter];
+
+			// renormalize so the state is back in range after coding the letter
+			const std::uint32_t stateMax = ((RANS_STATE_LOW >> RANS_PRECISION_BITS) << 8) * frequency;
+			while (state >= stateMax) {
+
+				reversed.push_back(static_cast<unsigned char>(state));
+				state >>= 8;
+
+			} // end while
+
+			state = ((state / frequency) << RANS_PRECISION_BITS) + (state % frequency) + starts_[letter];
+
+		} // end if
+
+	} // end for
+
+	for (int i = 0; i < 4; ++i) {
+
+		reversed.push_back(static_cast<unsigned char>(state));
+		state >>= 8;
+
+	} // end for
+
+	PackedCode code;
+	code.bytes_.assign(reversed.rbegin(), reversed.rend());
+	code.bitCount_ = 8 * static_cast<std::uint64_t>(code.bytes_.size());
+
+	return code;
+
+} // End of encode
+
+/** decode
+@pre provided code was generated by encode of a RansCodec with the same counts
+@post None, decoding stops at the first inconsistency of a damaged code
+@parm PackedCode [code]
+@return text representation of provided code*/
+std::string RansCodec::decode(const PackedCode& code) const {
+
+	std::string text{};
+
+	const std::size_t size = static_cast<std::size_t>(code.bitCount_ / 8);
+	const unsigned char* bytes = code.bytes_.data();
+	const std::uint32_t mask = (1u << RANS_PRECISION_BITS) - 1;
+
+	std::size_t at = 0;
+	std::uint32_t state = 0;
+	for (; at < 4 && at < size; ++at) {
+
+		state = (state << 8) | bytes[at];
+
+	} // end for
+
+	// the encoder started at RANS_STATE_LOW, so the decoder is done when it is back there
+	// with every byte read. The state can equal RANS_STATE_LOW mid stream, so neither
+	// condition ends decoding alone: while bytes are left, more letters follow
+	bool decoding = size >= 4 && state >= RANS_STATE_LOW;
+
+	while (decoding && !(at == size && state == RANS_STATE_LOW)) {
+
+		const std::uint32_t slot = state & mask;
+		const int letter = slots_[slot];
+
+		text += static_cast<char>('a' + letter);
+		state = frequencies_[letter] * (state >> RANS_PRECISION_BITS) + slot - starts_[letter];
+
+		while (state < RANS_STATE_LOW && at < size) {
+
+			state = (state << 8) | bytes[at];
+			++at;
+
+		} // end while
+
+		decoding = state >= RANS_STATE_LOW;
+
+	} // end while
+
+	return text;
+
+} // End of decode
+
+/** frequency
+@pre None
+@post None
+@parm char [letter], 'a' - 'z'
+@return quantized frequency of letter out of 2^RANS_PRECISION_BITS, 0 if letter is not 'a' - 'z'*/
+int RansCodec::frequency(const char letter) const {
+
+	return (letter >= 'a' && letter <= 'z') ? static_cast<int>(frequencies_[letter - 'a']) : 0;
+
+} // End of frequency
@@ -0,0 +1,117 @@
+/** @file RansCodec.h
+ @author Anthony Campos
+ @date 10/19/2026
+ This header class file implements a RansCodec, a range asymmetric numeral systems (rANS)
+ coder built from the same 'a' - 'z' counts as HuffmanAlgorithm */
+
+	//---------------------------------------------------------------------------
+	// RansCodec class:  rANS entropy coding
+	//   included features:
+	//   -- allows construction by the int or 64 bit count arrays HuffmanAlgorithm takes
+	//   -- counts are quantized to frequencies summing to 2^RANS_PRECISION_BITS,
+	//			every letter keeps a frequency of at least 1
+	//   -- codes close to the entropy of the counts, letters are not rounded
+	//			to whole bits the way Huffman codes are
+	//   -- same surface as HuffmanAlgorithm: getWord / decipher on '0'/'1' text,
+	//			encode / decode on PackedCode
+	//   -- decodes a letter with one table lookup and renormalizes by bytes
+	//
+	// Assumptions:
+	//   --  index 0-25 represents 'a' - 'z' .
+	//   --  chars other than 'a' - 'z' are skipped by encode
+	//   --  a code is a whole number of bytes, the encoder writes backwards so the
+	//			decoder reads forwards
+	//---------------------------------------------------------------------------
+
+#pragma once
+
+// Included libraries
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// included .h files
+#include "HuffmanTree.h"
+#include "BitStream.h"
+
+// Frequencies sum to 2^RANS_PRECISION_BITS
+const int RANS_PRECISION_BITS = 14;
+
+// Lower bound of the coder state, the state stays in [RANS_STATE_LOW, RANS_STATE_LOW << 8)
+const std::uint32_t RANS_STATE_LOW = 1u << 23;
+
+
+class RansCodec {
+
+public:
+
+	/** Constructors */
+
+	/** Constructor
+	@pre all indexes must have a integer value >= 0
+	@post RansCodec Object is created with frequencies quantized from counts
+	@parm int* [] [counts], frequency for each letter from 'a' to 'z'*/
+	RansCodec(int(&counts)[NUM_LETTERS]);
+
+	/** Constructor
+	@pre all indexes must have a integer value >= 0, their sum < 2^63
+	@post RansCodec Object is created with frequencies quantized from counts
+	@parm long long* [] [counts], frequency for each letter from 'a' to 'z'*/
+	RansCodec(long long(&counts)[NUM_LETTERS]);
+
+	/** Public Methods */
+
+	/** getWord
+	@pre None
+	@post all lowercase letters of provided string are encoded
+	@parm std::string [in]
+	@return the code of in as '0'/'1' text*/
+	std::string getWord(std::string in) const;
+
+	/** decipher
+	@pre provided code was generated by getWord of a RansCodec with the same counts
+	@post None
+	@parm std::string [in]
+	@return text representation of provided code*/
+	std::string decipher(std::string in) const;
+
+	/** encode
+	@pre None
+	@post all lowercase letters of provided string are encoded
+	@parm std::string [in]
+	@return packed code of in*/
+	PackedCode encode(const std::string& in) const;
+
+	/** decode
+	@pre provided code was generated by encode of a RansCodec with the same counts
+	@post None, decoding stops at the first inconsistency of a damaged code
+	@parm PackedCode [code]
+	@return text representation of provided code*/
+	std::string decode(const PackedCode& code) const;
+
+	/** Accessor Methods */
+
+	/** frequency
+	@pre None
+	@post None
+	@parm char [letter], 'a' - 'z'
+	@return quantized frequency of letter out of 2^RANS_PRECISION_BITS, 0 if letter is not 'a' - 'z'*/
+	int frequency(const char letter) const;
+
+private:
+
+	/** Private Attributes */
+
+	std::uint32_t frequencies_[NUM_LETTERS]; // quantized counts, sum 2^RANS_PRECISION_BITS
+	std::uint32_t starts_[NUM_LETTERS]; // running sum of frequencies_ before each letter
+	std::vector<unsigned char> slots_; // slot of the state -> letter index, used for decoding
+
+	/** Private Methods */
+
+	/** build
+	@pre all indexes must have a integer value >= 0, their sum < 2^63
+	@post frequencies_, starts_ and slots_ computed from counts
+	@parm long long* [] [counts]*/
+	void build(const long long(&counts)[NUM_LETTERS]);
+
+}; // End of RansCodec
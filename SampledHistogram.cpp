@@ -0,0 +1,302 @@
+/** @file SampledHistogram.cpp
+ @author Anthony Campos
+ @date 10/19/2026
+ This implementation file implements a SampledHistogram, letter counts estimated from a sample of
+ the input so a codebook can be built before the input is read, and encoded, in one pass */
+
+//---------------------------------------------------------------------------
+// SampledHistogram class:  estimated letter counts
+//   included features:
+//   -- strided sampling: evenly spaced blocks of a seekable stream (or of
+//			memory) are counted, about sampleBytes in all, and the stream is
+//			put back where it was
+//   -- reservoir sampling: chunks of a stream that cannot seek are fed in
+//			turn, a uniform sample of reservoirSize letters is kept with
+//			Algorithm L, which draws one random number per letter kept rather
+//			than per letter seen
+//   -- estimate gives the sampled counts plus one, so letters the sample
+//			missed still get a code of sensible length
+//   -- encode reads the input once through a StreamEncoder, counts the exact
+//			letters on the way and reports the ratio loss: the code bits
+//			against the bits of a codebook built from the exact counts
+//
+// Assumptions:
+//   --  only 'a' - 'z' are counted, other chars are skipped
+//---------------------------------------------------------------------------
+
+
+// included .h files
+#include "SampledHistogram.h"
+
+// Included libraries
+#include <algorithm>
+#include <cmath>
+
+
+/** Constructor
+@pre reservoirSize > 0
+@post Empty SampledHistogram Object created
+@parm std::size_t [reservoirSize] letters kept by reservoir sampling, unsigned int [seed]*/
+SampledHistogram::SampledHistogram(std::size_t reservoirSize, unsigned int seed)
+	:sampledBytes_(0), reservoirSize_(reservoirSize > 0 ? reservoirSize : 1), reservoirSeen_(0),
+	nextReplace_(0), weight_(0), random_(seed) {
+
+	for (int i = 0; i < NUM_LETTERS; ++i) {
+		stridedCounts_[i] = 0;
+	} // end for
+
+} // End of Constructor
+
+/** sampleStrided
+@pre blockBytes > 0
+@post letters of about sampleBytes bytes, read in evenly spaced blocks of blockBytes, counted.
+in is put back at its position, the whole input is counted if it is no larger than sampleBytes
+@parm std::istream [in] passed by reference, std::uint64_t [sampleBytes], std::size_t [blockBytes]
+@return false if in cannot seek, nothing is counted then*/
+bool SampledHistogram::sampleStrided(std::istream& in, std::uint64_t sampleBytes, std::size_t blockBytes) {
+
+	const std::istream::pos_type start = in.tellg();
+	bool seekable = start != std::istream::pos_type(-1) && static_cast<bool>(in.seekg(0, std::ios::end));
+
+	if (seekable && sampleBytes > 0) {
+
+		blockBytes = static_cast<std::size_t>(std::min<std::uint64_t>(blockBytes, sampleBytes));
+		const std::uint64_t size = static_cast<std::uint64_t>(in.tellg() - start);
+
+		// a small input is read whole, one block after the other
+		std::uint64_t blocks = (size + blockBytes - 1) / blockBytes;
+		std::uint64_t stride = blockBytes;
+
+		if (size > sampleBytes) {
+
+			blocks = (sampleBytes + blockBytes - 1) / blockBytes;
+			stride = size / blocks;
+
+		} // end if
+
+		std::vector<char> block(blockBytes);
+
+		for (std::uint64_t b = 0; b < blocks; ++b) {
+
+			in.clear();
+			in.seekg(start + static_cast<std::istream::off_type>(b * stride));
+			in.read(block.data(), static_cast<std::streamsize>(block.size()));
+
+			const std::size_t read = static_cast<std::size_t>(in.gcount());
+			countLetters(block.data(), read);
+			sampledBytes_ += read;
+
+		} // end for
+
+	} // end if
+
+	in.clear();
+	in.seekg(start);
+
+	return seekable;
+
+} // End of sampleStrided
+
+/** sampleStrided
+@pre blockBytes > 0
+@post letters of about sampleBytes bytes of data, in evenly spaced blocks of blockBytes, counted
+@parm char* [data], std::size_t [size], std::uint64_t [sampleBytes], std::size_t [blockBytes]*/
+void SampledHistogram::sampleStrided(const char* data, std::size_t size, std::uint64_t sampleBytes,
+	std::size_t blockBytes) {
+
+	blockBytes = static_cast<std::size_t>(std::min<std::uint64_t>(blockBytes, sampleBytes));
+
+	if (size <= sampleBytes) {
+
+		countLetters(data, size);
+		sampledBytes_ += size;
+
+	}
+	else if (sampleBytes > 0) {
+
+		const std::size_t blocks = static_cast<std::size_t>((sampleBytes + blockBytes - 1) / blockBytes);
+		const std::size_t stride = size / blocks;
+
+		for (std::size_t b = 0; b < blocks; ++b) {
+
+			const std::size_t length = std::min(blockBytes, size - b * stride);
+			countLetters(data + b * stride, length);
+			sampledBytes_ += length;
+
+		} // end for
+
+	} // end if
+
+} // End of sampleStrided
+
+/** sampleReservoir
+@pre None
+@post the reservoir holds a uniform sample of the letters of every chunk fed so far
+@parm char* [data], std::size_t [size]*/
+void SampledHistogram::sampleReservoir(const char* data, std::size_t size) {
+
+	for (std::size_t i = 0; i < size; ++i) {
+
+		const char c = data[i];
+
+		// only valid char 'a' - 'z'
+		if (c >= 'a' && c <= 'z') {
+
+			if (reservoir_.size() < reservoirSize_) {
+
+				reservoir_.push_back(c);
+
+				if (reservoir_.size() == reservoirSize_) {
+
+					weight_ = std::exp(std::log(uniform()) / reservoirSize_);
+					skipAhead();
+
+				} // end if
+
+			}
+			else if (reservoirSeen_ == nextReplace_) {
+
+				reservoir_[static_cast<std::size_t>(random_() % reservoirSize_)] = c;
+				weight_ *= std::exp(std::log(uniform()) / reservoirSize_);
+				skipAhead();
+
+			} // end if
+
+			++reservoirSeen_;
+
+		} // end if
+
+	} // end for
+
+	sampledBytes_ += size;
+
+} // End of sampleReservoir
+
+/** estimate
+@pre None
+@post counts set to the strided counts plus the reservoir counts plus one
+@parm long long* [] [counts] passed by reference*/
+void SampledHistogram::estimate(long long(&counts)[NUM_LETTERS]) const {
+
+	for (int i = 0; i < NUM_LETTERS; ++i) {
+		counts[i] = stridedCounts_[i] + 1;
+	} // end for
+
+	for (std::size_t i = 0; i < reservoir_.size(); ++i) {
+		++counts[reservoir_[i] - 'a'];
+	} // end for
+
+} // End of estimate
+
+/** encode
+@pre codec was built from estimate (or any counts)
+@post in read to its end in chunks of chunkBytes and encoded to sink, report filled
+@parm HuffmanAlgorithm [codec], std::istream [in], ByteSink [sink] & SamplingReport [report]
+passed by reference, std::size_t [chunkBytes]
+@return false if the sink failed*/
+bool SampledHistogram::encode(const HuffmanAlgorithm& codec, std::istream& in, ByteSink& sink, SamplingReport& report,
+	std::size_t chunkBytes) const {
+
+	std::vector<char> chunk(chunkBytes > 0 ? chunkBytes : DEFAULT_STREAM_BUFFER_SIZE);
+	StreamEncoder encoder(codec, sink);
+	long long exactCounts[NUM_LETTERS] = {};
+
+	report = SamplingReport();
+	report.sampledBytes_ = sampledBytes_;
+
+	while (in.read(chunk.data(), static_cast<std::streamsize>(chunk.size())) || in.gcount() > 0) {
+
+		const std::size_t read = static_cast<std::size_t>(in.gcount());
+
+		for (std::size_t i = 0; i < read; ++i) {
+
+			if (chunk[i] >= 'a' && chunk[i] <= 'z') {
+				++exactCounts[chunk[i] - 'a'];
+			} // end if
+
+		} // end for
+
+		encoder.write(chunk.data(), read);
+		report.inputBytes_ += read;
+
+	} // end while
+
+	report.codeBits_ = encoder.finish();
+
+	// what a second pass with the exact counts would have cost
+	HuffmanAlgorithm exactCodec(exactCounts);
+	char letter = 'a';
+	for (int i = 0; i < NUM_LETTERS; ++i) {
+
+		report.letters_ += exactCounts[i];
+		report.exactCodeBits_ += exactCounts[i] * exactCodec.codeLength(letter);
+		++letter;
+
+	} // end for
+
+	if (report.exactCodeBits_ > 0) {
+		report.ratioLoss_ = static_cast<double>(report.codeBits_) / report.exactCodeBits_ - 1;
+	} // end if
+
+	return encoder.good();
+
+} // End of encode
+
+/** sampledBytes
+@return bytes looked at by strided and reservoir sampling*/
+std::uint64_t SampledHistogram::sampledBytes() const {
+
+	return sampledBytes_;
+
+} // End of sampledBytes
+
+/** sampledLetters
+@return letters the estimate is made of, the plus one excluded*/
+std::uint64_t SampledHistogram::sampledLetters() const {
+
+	std::uint64_t letters = reservoir_.size();
+
+	for (int i = 0; i < NUM_LETTERS; ++i) {
+		letters += stridedCounts_[i];
+	} // end for
+
+	return letters;
+
+} // End of sampledLetters
+
+/** countLetters
+@post letters of data added to stridedCounts_
+@parm char* [data], std::size_t [size]*/
+void SampledHistogram::countLetters(const char* data, std::size_t size) {
+
+	for (std::size_t i = 0; i < size; ++i) {
+
+		// only valid char 'a' - 'z'
+		if (data[i] >= 'a' && data[i] <= 'z') {
+			++stridedCounts_[data[i] - 'a'];
+		} // end if
+
+	} // end for
+
+} // End of countLetters
+
+/** uniform
+@return a random number in (0, 1)*/
+double SampledHistogram::uniform() {
+
+	// 53 random bits, shifted off 0
+	return (static_cast<double>(random_() >> 11) + 0.5) / 9007199254740992.0;
+
+} // End of uniform
+
+/** skipAhead
+@pre reservoir is full
+@post nextReplace_ set past a geometric number of letters, weight_ updated*/
+void SampledHistogram::skipAhead() {
+
+	const double skip = std::floor(std::log(uniform()) / std::log1p(-weight_));
+
+	// a skip past 2^62 letters will never be reached
+	nextReplace_ = reservoirSeen_ + 1 + (skip < 4.6e18 ? static_cast<std::uint64_t>(skip) : (static_cast<std::uint64_t>(1) << 62));
+
+} // End of skipAhead
@@ -0,0 +1,153 @@
+/** @file SampledHistogram.h
+ @author Anthony Campos
+ @date 10/19/2026
+ This header class file implements a SampledHistogram, letter counts estimated from a sample of
+ the input so a codebook can be built before the input is read, and encoded, in one pass */
+
+	//---------------------------------------------------------------------------
+	// SampledHistogram class:  estimated letter counts
+	//   included features:
+	//   -- strided sampling: evenly spaced blocks of a seekable stream (or of
+	//			memory) are counted, about sampleBytes in all, and the stream is
+	//			put back where it was
+	//   -- reservoir sampling: chunks of a stream that cannot seek are fed in
+	//			turn, a uniform sample of reservoirSize letters is kept with
+	//			Algorithm L, which draws one random number per letter kept rather
+	//			than per letter seen
+	//   -- estimate gives the sampled counts plus one, so letters the sample
+	//			missed still get a code of sensible length
+	//   -- encode reads the input once through a StreamEncoder, counts the exact
+	//			letters on the way and reports the ratio loss: the code bits
+	//			against the bits of a codebook built from the exact counts
+	//
+	// Assumptions:
+	//   --  only 'a' - 'z' are counted, other chars are skipped
+	//---------------------------------------------------------------------------
+
+#pragma once
+
+// Included libraries
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// included .h files
+#include "HuffmanAlgorithm.h"
+#include "StreamEncoder.h"
+
+// Default number of bytes read by strided sampling
+const std::uint64_t DEFAULT_SAMPLE_BYTES = 1 << 24;
+
+// Default size of each block read by strided sampling
+const std::size_t DEFAULT_SAMPLE_BLOCK = 1 << 16;
+
+// Default number of letters kept by reservoir sampling
+const std::size_t DEFAULT_RESERVOIR_SIZE = 1 << 20;
+
+
+// Outcome of a one pass encode with a sampled codebook
+struct SamplingReport {
+
+	std::uint64_t sampledBytes_ = 0; // bytes the codebook was estimated from
+	std::uint64_t inputBytes_ = 0; // bytes encoded
+	std::uint64_t letters_ = 0; // letters encoded
+	std::uint64_t codeBits_ = 0; // code bits with the sampled codebook
+	std::uint64_t exactCodeBits_ = 0; // code bits a codebook of the exact counts would give
+	double ratioLoss_ = 0; // codeBits_ / exactCodeBits_ - 1
+
+}; // end of SamplingReport
+
+
+class SampledHistogram {
+
+public:
+
+	/** Constructors */
+
+	/** Constructor
+	@pre reservoirSize > 0
+	@post Empty SampledHistogram Object created
+	@parm std::size_t [reservoirSize] letters kept by reservoir sampling, unsigned int [seed]*/
+	explicit SampledHistogram(std::size_t reservoirSize = DEFAULT_RESERVOIR_SIZE, unsigned int seed = 0);
+
+	/** Public Methods */
+
+	/** sampleStrided
+	@pre blockBytes > 0
+	@post letters of about sampleBytes bytes, read in evenly spaced blocks of blockBytes, counted.
+	in is put back at its position, the whole input is counted if it is no larger than sampleBytes
+	@parm std::istream [in] passed by reference, std::uint64_t [sampleBytes], std::size_t [blockBytes]
+	@return false if in cannot seek, nothing is counted then*/
+	bool sampleStrided(std::istream& in, std::uint64_t sampleBytes = DEFAULT_SAMPLE_BYTES,
+		std::size_t blockBytes = DEFAULT_SAMPLE_BLOCK);
+
+	/** sampleStrided
+	@pre blockBytes > 0
+	@post letters of about sampleBytes bytes of data, in evenly spaced blocks of blockBytes, counted
+	@parm char* [data], std::size_t [size], std::uint64_t [sampleBytes], std::size_t [blockBytes]*/
+	void sampleStrided(const char* data, std::size_t size, std::uint64_t sampleBytes = DEFAULT_SAMPLE_BYTES,
+		std::size_t blockBytes = DEFAULT_SAMPLE_BLOCK);
+
+	/** sampleReservoir
+	@pre None
+	@post the reservoir holds a uniform sample of the letters of every chunk fed so far
+	@parm char* [data], std::size_t [size]*/
+	void sampleReservoir(const char* data, std::size_t size);
+
+	/** estimate
+	@pre None
+	@post counts set to the strided counts plus the reservoir counts plus one
+	@parm long long* [] [counts] passed by reference*/
+	void estimate(long long(&counts)[NUM_LETTERS]) const;
+
+	/** encode
+	@pre codec was built from estimate (or any counts)
+	@post in read to its end in chunks of chunkBytes and encoded to sink, report filled
+	@parm HuffmanAlgorithm [codec], std::istream [in], ByteSink [sink] & SamplingReport [report]
+	passed by reference, std::size_t [chunkBytes]
+	@return false if the sink failed*/
+	bool encode(const HuffmanAlgorithm& codec, std::istream& in, ByteSink& sink, SamplingReport& report,
+		std::size_t chunkBytes = DEFAULT_STREAM_BUFFER_SIZE) const;
+
+	/** Accessor Methods */
+
+	/** sampledBytes
+	@return bytes looked at by strided and reservoir sampling*/
+	std::uint64_t sampledBytes() const;
+
+	/** sampledLetters
+	@return letters the estimate is made of, the plus one excluded*/
+	std::uint64_t sampledLetters() const;
+
+private:
+
+	/** Private Attributes */
+	long long stridedCounts_[NUM_LETTERS];
+	std::uint64_t sampledBytes_;
+
+	std::vector<char> reservoir_;
+	std::size_t reservoirSize_;
+	std::uint64_t reservoirSeen_; // letters fed to the reservoir
+	std::uint64_t nextReplace_; // index (among letters seen) of the next letter that enters the reservoir
+	double weight_; // Algorithm L state
+	std::mt19937_64 random_;
+
+	/** Private Methods */
+
+	/** countLetters
+	@post letters of data added to stridedCounts_
+	@parm char* [data], std::size_t [size]*/
+	void countLetters(const char* data, std::size_t size);
+
+	/** uniform
+	@return a random number in (0, 1)*/
+	double uniform();
+
+	/** skipAhead
+	@pre reservoir is full
+	@post nextReplace_ set past a geometric number of letters, weight_ updated*/
+	void skipAhead();
+
+}; // End of SampledHistogram
@@ -0,0 +1,217 @@
+/** @file SampledPositionIndex.cpp
+ @author Anthony Campos
+ @date 10/19/2026
+ This implementation file implements a SampledPositionIndex, the bit offset of every K-th letter of
+ a packed HuffmanAlgorithm code, so a range of letters can be decoded without decoding from bit 0 */
+
+//---------------------------------------------------------------------------
+// SampledPositionIndex class:  random access into packed code
+//   included features:
+//   -- built by one pass over the code, records the bit offset of letters
+//			0, K, 2K, ... and the total letter count
+//   -- extract(i, j) jumps to the sample at or before i and decodes at most
+//			K - 1 + (j - i) letters
+//   -- the sample rate trades index size (8 bytes per sample) against the
+//			letters decoded and thrown away per extract (K / 2 on average)
+//   -- allows for serializing the index so it can be stored with the code
+//
+// Assumptions:
+//   --  extract is given the same codec and code the index was built from
+//---------------------------------------------------------------------------
+
+
+// included .h files
+#include "SampledPositionIndex.h"
+#include "ByteOrder.h"
+
+// Included libraries
+#include <cstring>
+
+namespace {
+
+	const char INDEX_MAGIC[4] = { 'H', 'U', 'F', 'I' };
+	const std::size_t INDEX_HEADER_SIZE = 24;
+
+} // end of namespace
+
+
+/** Defualt Constructor
+@pre None
+@post Empty SampledPositionIndex Object created, load it or build one from a code*/
+SampledPositionIndex::SampledPositionIndex()
+	:sampleRate_(DEFAULT_SAMPLE_RATE), letterCount_(0)
+{} // End of Constructor
+
+/** Constructor
+@pre code was generated by codec, sampleRate > 0
+@post SampledPositionIndex Object created with the bit offset of every sampleRate-th letter
+@parm HuffmanAlgorithm [codec], PackedCode [code], int [sampleRate]*/
+SampledPositionIndex::SampledPositionIndex(const HuffmanAlgorithm& codec, const PackedCode& code, int sampleRate)
+	:sampleRate_(sampleRate > 0 ? sampleRate : DEFAULT_SAMPLE_RATE), letterCount_(0) {
+
+	BitReader reader(code.bytes_.data(), code.bitCount_);
+	char letter = '\0';
+	bool decoding = true;
+	int untilSample = 0;
+
+	while (decoding && reader.remaining() > 0) {
+
+		const std::uint64_t position = reader.position();
+		decoding = codec.decodeLetter(reader, letter);
+
+		if (decoding) {
+
+			if (untilSample == 0) {
+
+				offsets_.push_back(position);
+				untilSample = sampleRate_;
+
+			} // end if
+
+			--untilSample;
+			++letterCount_;
+
+		} // end if
+
+	} // end while
+
+} // End of Constructor
+
+/** extract
+@pre codec and code are the ones the index was built from
+@post None
+@parm HuffmanAlgorithm [codec], PackedCode [code], std::uint64_t [begin], std::uint64_t [end]
+@return letters [begin, end) of the decoded text, clamped to the letter count*/
+std::string SampledPositionIndex::extract(const HuffmanAlgorithm& codec, const PackedCode& code,
+	std::uint64_t begin, std::uint64_t end) const {
+
+	std::string text{};
+
+	if (end > letterCount_) {
+		end = letterCount_;
+	} // end if
+
+	if (begin < end) {
+
+		const std::uint64_t sample = begin / sampleRate_;
+		BitReader reader(code.bytes_.data(), code.bitCount_, offsets_[static_cast<std::size_t>(sample)]);
+
+		// decode and drop the letters between the sample and begin
+		char letter = '\0';
+		bool decoding = true;
+		for (std::uint64_t skipped = sample * sampleRate_; decoding && skipped < begin; ++skipped) {
+
+			decoding = codec.decodeLetter(reader, letter);
+
+		} // end for
+
+		if (decoding) {
+
+			text = codec.decode(code, reader.position(), end - begin);
+
+		} // end if
+
+	} // end if
+
+	return text;
+
+} // End of extract
+
+/** serialize
+@pre None
+@post None
+@return the index in the serialized layout*/
+std::vector<unsigned char> SampledPositionIndex::serialize() const {
+
+	std::vector<unsigned char> data(INDEX_MAGIC, INDEX_MAGIC + sizeof(INDEX_MAGIC));
+	data.reserve(INDEX_HEADER_SIZE + 8 * offsets_.size());
+
+	appendUint(data, static_cast<std::uint64_t>(sampleRate_), 4);
+	appendUint(data, letterCount_, 8);
+	appendUint(data, offsets_.size(), 8);
+
+	for (std::size_t i = 0; i < offsets_.size(); ++i) {
+
+		appendUint(data, offsets_[i], 8);
+
+	} // end for
+
+	return data;
+
+} // End of serialize
+
+/** load
+@pre None
+@post index replaced by the serialized one if data is well formed, otherwise left unchanged
+@parm std::vector<unsigned char> [data]
+@return true if data is well formed: one sample per started group of letters, offsets
+strictly increasing*/
+bool SampledPositionIndex::load(const std::vector<unsigned char>& data) {
+
+	bool valid = data.size() >= INDEX_HEADER_SIZE && std::memcmp(data.data(), INDEX_MAGIC, sizeof(INDEX_MAGIC)) == 0;
+
+	if (valid) {
+
+		const std::uint64_t sampleRate = loadUint(data.data() + 4, 4);
+		const std::uint64_t letterCount = loadUint(data.data() + 8, 8);
+		const std::uint64_t sampleCount = loadUint(data.data() + 16, 8);
+
+		// one sample per started group of sampleRate letters, counted without letterCount + sampleRate
+		// wrapping near 2^64
+		valid = sampleRate > 0 && sampleRate <= 0x7FFFFFFF
+			&& sampleCount == letterCount / sampleRate + (letterCount % sampleRate != 0 ? 1 : 0)
+			&& sampleCount <= (data.size() - INDEX_HEADER_SIZE) / 8
+			&& data.size() == INDEX_HEADER_SIZE + 8 * sampleCount;
+
+		// every group holds at least one code bit, so the offsets strictly increase
+		std::vector<std::uint64_t> offsets;
+		if (valid) {
+
+			offsets.resize(static_cast<std::size_t>(sampleCount));
+
+		} // end if
+
+		for (std::size_t i = 0; valid && i < offsets.size(); ++i) {
+
+			offsets[i] = loadUint(data.data() + INDEX_HEADER_SIZE + 8 * i, 8);
+			valid = i == 0 || offsets[i] > offsets[i - 1];
+
+		} // end for
+
+		if (valid) {
+
+			sampleRate_ = static_cast<int>(sampleRate);
+			letterCount_ = letterCount;
+			offsets_.swap(offsets);
+
+		} // end if
+
+	} // end if
+
+	return valid;
+
+} // End of load
+
+/** sampleRate
+@return number of letters between samples*/
+int SampledPositionIndex::sampleRate() const {
+
+	return sampleRate_;
+
+} // End of sampleRate
+
+/** letterCount
+@return number of letters in the code*/
+std::uint64_t SampledPositionIndex::letterCount() const {
+
+	return letterCount_;
+
+} // End of letterCount
+
+/** sampleCount
+@return number of samples*/
+std::uint64_t SampledPositionIndex::sampleCount() const {
+
+	return offsets_.size();
+
+} // End of sampleCount
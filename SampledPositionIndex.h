@@ -0,0 +1,102 @@
+/** @file SampledPositionIndex.h
+ @author Anthony Campos
+ @date 10/19/2026
+ This header class file implements a SampledPositionIndex, the bit offset of every K-th letter of
+ a packed HuffmanAlgorithm code, so a range of letters can be decoded without decoding from bit 0 */
+
+	//---------------------------------------------------------------------------
+	// SampledPositionIndex class:  random access into packed code
+	//   included features:
+	//   -- built by one pass over the code, records the bit offset of letters
+	//			0, K, 2K, ... and the total letter count
+	//   -- extract(i, j) jumps to the sample at or before i and decodes at most
+	//			K - 1 + (j - i) letters
+	//   -- the sample rate trades index size (8 bytes per sample) against the
+	//			letters decoded and thrown away per extract (K / 2 on average)
+	//   -- allows for serializing the index so it can be stored with the code
+	//
+	// Serialized layout (little endian):
+	//   --  "HUFI", uint32 sample rate, uint64 letter count, uint64 sample count,
+	//			then sample count x uint64 bit offset
+	//
+	// Assumptions:
+	//   --  extract is given the same codec and code the index was built from
+	//---------------------------------------------------------------------------
+
+#pragma once
+
+// Included libraries
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// included .h files
+#include "HuffmanAlgorithm.h"
+#include "BitStream.h"
+
+// Default number of letters between samples
+const int DEFAULT_SAMPLE_RATE = 64;
+
+
+class SampledPositionIndex {
+
+public:
+
+	/** Constructors */
+
+	/** Defualt Constructor
+	@pre None
+	@post Empty SampledPositionIndex Object created, load it or build one from a code*/
+	SampledPositionIndex();
+
+	/** Constructor
+	@pre code was generated by codec, sampleRate > 0
+	@post SampledPositionIndex Object created with the bit offset of every sampleRate-th letter
+	@parm HuffmanAlgorithm [codec], PackedCode [code], int [sampleRate]*/
+	SampledPositionIndex(const HuffmanAlgorithm& codec, const PackedCode& code, int sampleRate = DEFAULT_SAMPLE_RATE);
+
+	/** Public Methods */
+
+	/** extract
+	@pre codec and code are the ones the index was built from
+	@post None
+	@parm HuffmanAlgorithm [codec], PackedCode [code], std::uint64_t [begin], std::uint64_t [end]
+	@return letters [begin, end) of the decoded text, clamped to the letter count*/
+	std::string extract(const HuffmanAlgorithm& codec, const PackedCode& code, std::uint64_t begin, std::uint64_t end) const;
+
+	/** serialize
+	@pre None
+	@post None
+	@return the index in the serialized layout*/
+	std::vector<unsigned char> serialize() const;
+
+	/** load
+	@pre None
+	@post index replaced by the serialized one if data is well formed, otherwise left unchanged
+	@parm std::vector<unsigned char> [data]
+	@return true if data is well formed: one sample per started group of letters, offsets
+	strictly increasing*/
+	bool load(const std::vector<unsigned char>& data);
+
+	/** Accessor Methods */
+
+	/** sampleRate
+	@return number of letters between samples*/
+	int sampleRate() const;
+
+	/** letterCount
+	@return number of letters in the code*/
+	std::uint64_t letterCount() const;
+
+	/** sampleCount
+	@return number of samples*/
+	std::uint64_t sampleCount() const;
+
+private:
+
+	/** Private Attributes */
+	int sampleRate_;
+	std::uint64_t letterCount_;
+	std::vector<std::uint64_t> offsets_; // bit offset of letter k * sampleRate_
+
+}; // End of SampledPositionIndex
@@ -0,0 +1,517 @@
+/** @file SparseHuffmanCodec.cpp
+ @author Anthony Campos
+ @date 10/19/2026
+ This implementation file implements a SparseHuffmanCodec, Huffman Coding over a large sparse
+ alphabet of 32 bit symbols such as token IDs or Unicode code points */
+
+//---------------------------------------------------------------------------
+// SparseHuffmanCodec class:  Huffman Coding for large alphabets
+//   included features:
+//   -- allows construction by a symbol sequence or by symbol/count pairs
+//   -- only symbols with a count above 0 get a code, each symbol is mapped to
+//			a dense index through a compact open addressing hash table
+//   -- code lengths come from a HuffmanTree built over the dense indexes,
+//			codes are then assigned canonically (by length, then symbol)
+//   -- decodes short codes with a single table lookup and long, rare codes
+//			with the canonical first-code per length search
+//   -- allows for converting UTF-8 text to code points and back
+//
+// Assumptions:
+//   --  symbols not in the codebook are skipped by encode
+//---------------------------------------------------------------------------
+
+
+// included .h files
+#include "SparseHuffmanCodec.h"
+#include "HuffmanTree.h"
+
+// Included libraries
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+
+
+/** Defualt Constructor
+@pre None
+@post SparseHuffmanCodec Object created with an empty codebook*/
+SparseHuffmanCodec::SparseHuffmanCodec()
+	:maxLength_(0)
+{} // End of Constructor
+
+/** Constructor
+@pre None
+@post SparseHuffmanCodec Object created with a code for every distinct symbol of text
+@parm std::vector<std::uint32_t> [text] symbols to count*/
+SparseHuffmanCodec::SparseHuffmanCodec(const std::vector<std::uint32_t>& text)
+	:maxLength_(0) {
+
+	std::unordered_map<std::uint32_t, long long> histogram;
+
+	for (unsigned int i = 0; i < text.size(); ++i) {
+
+		++histogram[text[i]];
+
+	} // end for
+
+	std::vector<std::uint32_t> symbols;
+	std::vector<long long> counts;
+	symbols.reserve(histogram.size());
+	counts.reserve(histogram.size());
+
+	for (const auto& entry : histogram) {
+
+		symbols.push_back(entry.first);
+		counts.push_back(entry.second);
+
+	} // end for
+
+	build(symbols, counts);
+
+} // End of Constructor
+
+/** Constructor
+@pre symbols are distinct, counts.size() == symbols.size(), counts >= 0 & their sum < 2^63
+@post SparseHuffmanCodec Object created with a code for every symbol whose count is above 0
+@parm std::vector<std::uint32_t> [symbols], std::vector<long long> [counts]*/
+SparseHuffmanCodec::SparseHuffmanCodec(const std::vector<std::uint32_t>& symbols, const std::vector<long long>& counts)
+	:maxLength_(0) {
+
+	build(symbols, counts);
+
+} // End of Constructor
+
+/** codeLengths computes Huffman code lengths with the HuffmanTree builder
+@pre all counts > 0 & their sum < 2^63, maxLength >= ceil(log2(counts.size()))
+@post None
+@parm std::vector<long long> [counts], int [maxLength] longest allowed code
+@return code length of every count. If the tree is deeper than maxLength the counts are
+halved (kept >= 1) and the tree built again until it fits*/
+std::vector<int> SparseHuffmanCodec::codeLengths(std::vector<long long> counts, int maxLength) {
+
+	std::vector<int> lengths(counts.size(), 0);
+	bool fits = counts.empty();
+
+	while (!fits) {
+
+		HuffmanTree tree;
+		tree.build(counts);
+		tree.codeLengths(lengths);
+
+		fits = *std::max_element(lengths.begin(), lengths.end()) <= maxLength;
+
+		// flatten the distribution, all counts reach 1 (a balanced tree) eventually
+		for (unsigned int i = 0; i < counts.size() && !fits; ++i) {
+
+			counts[i] = (counts[i] + 1) / 2;
+
+		} // end for
+
+	} // end while
+
+	return lengths;
+
+} // End of codeLengths
+
+/** build
+@pre symbols are distinct, counts.size() == symbols.size()
+@post codebook, hash table and decode tables built for symbols with a count above 0
+@parm std::vector<std::uint32_t> [symbols], std::vector<long long> [counts]*/
+void SparseHuffmanCodec::build(const std::vector<std::uint32_t>& symbols, const std::vector<long long>& counts) {
+
+	// zero frequency symbols get no code, sorted so the same histogram gives the same tree
+	std::vector<std::pair<std::uint32_t, long long>> present;
+	for (unsigned int i = 0; i < symbols.size(); ++i) {
+
+		if (counts[i] > 0) {
+
+			present.push_back(std::make_pair(symbols[i], counts[i]));
+
+		} // end if
+
+	} // end for
+
+	std::sort(present.begin(), present.end());
+
+	const int size = static_cast<int>(present.size());
+	std::vector<long long> presentCounts(size);
+	for (int i = 0; i < size; ++i) {
+
+		presentCounts[i] = present[i].second;
+
+	} // end for
+
+	std::vector<int> treeLengths = codeLengths(presentCounts, MAX_SPARSE_CODE_LENGTH);
+
+	// canonical order, shorter codes first, ties by symbol
+	std::vector<int> order(size);
+	for (int i = 0; i < size; ++i) {
+
+		order[i] = i;
+
+	} // end for
+
+	std::sort(order.begin(), order.end(), [&](int lhs, int rhs) {
+
+		return (treeLengths[lhs] != treeLengths[rhs]) ? treeLengths[lhs] < treeLengths[rhs] : lhs < rhs;
+
+	});
+
+	symbols_.assign(size, 0);
+	codes_.assign(size, 0);
+	lengths_.assign(size, 0);
+	maxLength_ = 0;
+
+	for (int i = 0; i < size; ++i) {
+
+		symbols_[i] = present[order[i]].first;
+		lengths_[i] = treeLengths[order[i]];
+		maxLength_ = std::max(maxLength_, lengths_[i]);
+
+	} // end for
+
+	firstCode_.assign(maxLength_ + 1, 0);
+	firstIndex_.assign(maxLength_ + 1, 0);
+	lengthCount_.assign(maxLength_ + 1, 0);
+
+	// canonical codes, each length starts one past the last code of the previous length
+	std::uint64_t code = 0;
+	int previousLength = (size > 0) ? lengths_[0] : 0;
+
+	for (int i = 0; i < size; ++i) {
+
+		if (i > 0) {
+
+			code = (code + 1) << (lengths_[i] - previousLength);
+			previousLength = lengths_[i];
+
+		} // end if
+
+		codes_[i] = code;
+
+		if (lengthCount_[lengths_[i]] == 0) {
+
+			firstCode_[lengths_[i]] = code;
+			firstIndex_[lengths_[i]] = i;
+
+		} // end if
+
+		++lengthCount_[lengths_[i]];
+
+	} // end for
+
+	// hash table at most half full
+	unsigned int capacity = 2;
+	while (capacity < 2u * static_cast<unsigned int>(size)) {
+
+		capacity <<= 1;
+
+	} // end while
+
+	slots_.assign(capacity, Slot());
+
+	for (int i = 0; i < size; ++i) {
+
+		unsigned int slot = slotOf(symbols_[i]);
+		while (slots_[slot].index_ != -1) {
+
+			slot = (slot + 1) & (capacity - 1);
+
+		} // end while
+
+		slots_[slot].symbol_ = symbols_[i];
+		slots_[slot].index_ = i;
+
+	} // end for
+
+	// every SPARSE_LOOKUP_BITS pattern that starts with a short code maps to it
+	lookup_.assign(1u << SPARSE_LOOKUP_BITS, LookupEntry());
+
+	for (int i = 0; i < size && lengths_[i] <= SPARSE_LOOKUP_BITS; ++i) {
+
+		const int freeBits = SPARSE_LOOKUP_BITS - lengths_[i];
+		const std::uint64_t start = codes_[i] << freeBits;
+
+		for (std::uint64_t pattern = 0; pattern < (std::uint64_t(1) << freeBits); ++pattern) {
+
+			lookup_[start | pattern].index_ = i;
+			lookup_[start | pattern].length_ = lengths_[i];
+
+		} // end for
+
+	} // end for
+
+} // End of build
+
+/** encodeSymbol
+@pre None
+@post code of symbol appended to writer
+@parm std::uint32_t [symbol], BitWriter [writer] passed by reference
+@return true if symbol has a code, otherwise false and nothing is written*/
+bool SparseHuffmanCodec::encodeSymbol(std::uint32_t symbol, BitWriter& writer) const {
+
+	int index = findIndex(symbol);
+
+	if (index >= 0) {
+
+		writer.writeBits(codes_[index], lengths_[index]);
+
+	} // end if
+
+	return index >= 0;
+
+} // End of encodeSymbol
+
+/** decodeSymbol
+@pre reader is at the start of a code made by this codebook
+@post reader moved past the code
+@parm BitReader [reader] passed by reference, std::uint32_t [symbol] passed by reference
+@return true if a symbol was decoded, false if the bits left are not a complete code*/
+bool SparseHuffmanCodec::decodeSymbol(BitReader& reader, std::uint32_t& symbol) const {
+
+	bool decoded = false;
+	const std::uint64_t remaining = reader.remaining();
+
+	if (remaining > 0 && !symbols_.empty()) {
+
+		const LookupEntry& entry = lookup_[reader.peekBits(SPARSE_LOOKUP_BITS)];
+
+		if (entry.length_ > 0) {
+
+			// short code, one lookup
+			if (static_cast<std::uint64_t>(entry.length_) <= remaining) {
+
+				symbol = symbols_[entry.index_];
+				reader.skipBits(entry.length_);
+				decoded = true;
+
+			} // end if
+
+		}
+		else {
+
+			// long code, find the length whose canonical range holds the prefix
+			for (int length = SPARSE_LOOKUP_BITS + 1; length <= maxLength_
+				&& static_cast<std::uint64_t>(length) <= remaining && !decoded; ++length) {
+
+				if (lengthCount_[length] > 0) {
+
+					std::uint64_t code = reader.peekBits(length);
+
+					if (code >= firstCode_[length] && code - firstCode_[length] < static_cast<std::uint64_t>(lengthCount_[length])) {
+
+						symbol = symbols_[firstIndex_[length] + static_cast<int>(code - firstCode_[length])];
+						reader.skipBits(length);
+						decoded = true;
+
+					} // end if
+
+				} // end if
+
+			} // end for
+
+		} // end if
+
+	} // end if
+
+	return decoded;
+
+} // End of decodeSymbol
+
+/** encode
+@pre None
+@post every symbol of text with a code is encoded, the rest are skipped
+@parm std::vector<std::uint32_t> [text], std::uint64_t [bitCount] passed by reference
+@return packed code, bitCount holds the number of code bits in it*/
+std::vector<unsigned char> SparseHuffmanCodec::encode(const std::vector<std::uint32_t>& text, std::uint64_t& bitCount) const {
+
+	BitWriter writer;
+
+	for (unsigned int i = 0; i < text.size(); ++i) {
+
+		encodeSymbol(text[i], writer);
+
+	} // end for
+
+	writer.finish();
+	bitCount = writer.bitCount();
+
+	std::vector<unsigned char> code;
+	writer.swapBytes(code);
+
+	return code;
+
+} // End of encode
+
+/** decode
+@pre code was made by encode of the current codebook
+@post None
+@parm std::vector<unsigned char> [code], std::uint64_t [bitCount]
+@return the decoded symbols*/
+std::vector<std::uint32_t> SparseHuffmanCodec::decode(const std::vector<unsigned char>& code, std::uint64_t bitCount) const {
+
+	std::vector<std::uint32_t> text;
+	BitReader reader(code.data(), bitCount);
+	std::uint32_t symbol = 0;
+
+	while (decodeSymbol(reader, symbol)) {
+
+		text.push_back(symbol);
+
+	} // end while
+
+	return text;
+
+} // End of decode
+
+/** fromUtf8
+@pre text is valid UTF-8
+@post None
+@parm std::string [text]
+@return the code point of every char of text*/
+std::vector<std::uint32_t> SparseHuffmanCodec::fromUtf8(const std::string& text) {
+
+	std::vector<std::uint32_t> codePoints;
+	codePoints.reserve(text.size());
+
+	unsigned int i = 0;
+	while (i < text.size()) {
+
+		unsigned char lead = static_cast<unsigned char>(text[i]);
+		int extra = 0;
+		std::uint32_t codePoint = lead;
+
+		if (lead >= 0xF0) {
+			extra = 3;
+			codePoint = lead & 0x07;
+		}
+		else if (lead >= 0xE0) {
+			extra = 2;
+			codePoint = lead & 0x0F;
+		}
+		else if (lead >= 0xC0) {
+			extra = 1;
+			codePoint = lead & 0x1F;
+		} // end if
+
+		++i;
+		for (int j = 0; j < extra && i < text.size(); ++j) {
+
+			codePoint = (codePoint << 6) | (static_cast<unsigned char>(text[i]) & 0x3F);
+			++i;
+
+		} // end for
+
+		codePoints.push_back(codePoint);
+
+	} // end while
+
+	return codePoints;
+
+} // End of fromUtf8
+
+/** toUtf8
+@pre every code point <= 0x10FFFF
+@post None
+@parm std::vector<std::uint32_t> [codePoints]
+@return the UTF-8 text of codePoints*/
+std::string SparseHuffmanCodec::toUtf8(const std::vector<std::uint32_t>& codePoints) {
+
+	std::string text{};
+	text.reserve(codePoints.size());
+
+	for (unsigned int i = 0; i < codePoints.size(); ++i) {
+
+		std::uint32_t codePoint = codePoints[i];
+
+		if (codePoint < 0x80) {
+			text += static_cast<char>(codePoint);
+		}
+		else if (codePoint < 0x800) {
+			text += static_cast<char>(0xC0 | (codePoint >> 6));
+			text += static_cast<char>(0x80 | (codePoint & 0x3F));
+		}
+		else if (codePoint < 0x10000) {
+			text += static_cast<char>(0xE0 | (codePoint >> 12));
+			text += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+			text += static_cast<char>(0x80 | (codePoint & 0x3F));
+		}
+		else {
+			text += static_cast<char>(0xF0 | (codePoint >> 18));
+			text += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+			text += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+			text += static_cast<char>(0x80 | (codePoint & 0x3F));
+		} // end if
+
+	} // end for
+
+	return text;
+
+} // End of toUtf8
+
+/** symbolCount
+@return number of symbols that have a code*/
+int SparseHuffmanCodec::symbolCount() const {
+
+	return static_cast<int>(symbols_.size());
+
+} // End of symbolCount
+
+/** codeLength
+@parm std::uint32_t [symbol]
+@return code length of symbol, 0 if it has no code*/
+int SparseHuffmanCodec::codeLength(std::uint32_t symbol) const {
+
+	int index = findIndex(symbol);
+
+	return (index >= 0) ? lengths_[index] : 0;
+
+} // End of codeLength
+
+/** maxCodeLength
+@return length of the longest code*/
+int SparseHuffmanCodec::maxCodeLength() const {
+
+	return maxLength_;
+
+} // End of maxCodeLength
+
+/** findIndex
+@parm std::uint32_t [symbol]
+@return dense index of symbol, -1 if it has no code*/
+int SparseHuffmanCodec::findIndex(std::uint32_t symbol) const {
+
+	int index = -1;
+
+	if (!slots_.empty()) {
+
+		const unsigned int mask = static_cast<unsigned int>(slots_.size()) - 1;
+		unsigned int slot = slotOf(symbol);
+
+		// linear probing, stops at the first empty slot
+		while (slots_[slot].index_ != -1 && index == -1) {
+
+			if (slots_[slot].symbol_ == symbol) {
+				index = slots_[slot].index_;
+			} // end if
+
+			slot = (slot + 1) & mask;
+
+		} // end while
+
+	} // end if
+
+	return index;
+
+} // End of findIndex
+
+/** slotOf
+@parm std::uint32_t [symbol]
+@return first hash table slot to probe for symbol*/
+unsigned int SparseHuffmanCodec::slotOf(std::uint32_t symbol) const {
+
+	// Fibonacci hashing, spreads sequential IDs across the table
+	std::uint32_t hash = symbol * 2654435769u;
+
+	return static_cast<unsigned int>((static_cast<std::uint64_t>(hash) * slots_.size()) >> 32);
+
+} // End of slotOf
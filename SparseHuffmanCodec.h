@@ -0,0 +1,180 @@
+/** @file SparseHuffmanCodec.h
+ @author Anthony Campos
+ @date 10/19/2026
+ This header class file implements a SparseHuffmanCodec, Huffman Coding over a large sparse
+ alphabet of 32 bit symbols such as token IDs or Unicode code points */
+
+	//---------------------------------------------------------------------------
+	// SparseHuffmanCodec class:  Huffman Coding for large alphabets
+	//   included features:
+	//   -- allows construction by a symbol sequence or by symbol/count pairs
+	//   -- only symbols with a count above 0 get a code, each symbol is mapped to
+	//			a dense index through a compact open addressing hash table
+	//   -- code lengths come from a HuffmanTree built over the dense indexes,
+	//			codes are then assigned canonically (by length, then symbol)
+	//   -- decodes short codes with a single table lookup and long, rare codes
+	//			with the canonical first-code per length search
+	//   -- allows for converting UTF-8 text to code points and back
+	//
+	// Assumptions:
+	//   --  symbols not in the codebook are skipped by encode
+	//---------------------------------------------------------------------------
+
+#pragma once
+
+// Included libraries
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// included .h files
+#include "BitStream.h"
+
+// Longest code SparseHuffmanCodec assigns, longer trees are flattened
+const int MAX_SPARSE_CODE_LENGTH = 48;
+
+// Number of bits decoded by a single lookup
+const int SPARSE_LOOKUP_BITS = 10;
+
+
+class SparseHuffmanCodec {
+
+public:
+
+	/** Constructors */
+
+	/** Defualt Constructor
+	@pre None
+	@post SparseHuffmanCodec Object created with an empty codebook*/
+	SparseHuffmanCodec();
+
+	/** Constructor
+	@pre None
+	@post SparseHuffmanCodec Object created with a code for every distinct symbol of text
+	@parm std::vector<std::uint32_t> [text] symbols to count*/
+	explicit SparseHuffmanCodec(const std::vector<std::uint32_t>& text);
+
+	/** Constructor
+	@pre symbols are distinct, counts.size() == symbols.size(), counts >= 0 & their sum < 2^63
+	@post SparseHuffmanCodec Object created with a code for every symbol whose count is above 0
+	@parm std::vector<std::uint32_t> [symbols], std::vector<long long> [counts]*/
+	SparseHuffmanCodec(const std::vector<std::uint32_t>& symbols, const std::vector<long long>& counts);
+
+	/** Public Methods */
+
+	/** codeLengths computes Huffman code lengths with the HuffmanTree builder
+	@pre all counts > 0 & their sum < 2^63, maxLength >= ceil(log2(counts.size()))
+	@post None
+	@parm std::vector<long long> [counts], int [maxLength] longest allowed code
+	@return code length of every count. If the tree is deeper than maxLength the counts are
+	halved (kept >= 1) and the tree built again until it fits*/
+	static std::vector<int> codeLengths(std::vector<long long> counts, int maxLength);
+
+	/** encodeSymbol
+	@pre None
+	@post code of symbol appended to writer
+	@parm std::uint32_t [symbol], BitWriter [writer] passed by reference
+	@return true if symbol has a code, otherwise false and nothing is written*/
+	bool encodeSymbol(std::uint32_t symbol, BitWriter& writer) const;
+
+	/** decodeSymbol
+	@pre reader is at the start of a code made by this codebook
+	@post reader moved past the code
+	@parm BitReader [reader] passed by reference, std::uint32_t [symbol] passed by reference
+	@return true if a symbol was decoded, false if the bits left are not a complete code*/
+	bool decodeSymbol(BitReader& reader, std::uint32_t& symbol) const;
+
+	/** encode
+	@pre None
+	@post every symbol of text with a code is encoded, the rest are skipped
+	@parm std::vector<std::uint32_t> [text], std::uint64_t [bitCount] passed by reference
+	@return packed code, bitCount holds the number of code bits in it*/
+	std::vector<unsigned char> encode(const std::vector<std::uint32_t>& text, std::uint64_t& bitCount) const;
+
+	/** decode
+	@pre code was made by encode of the current codebook
+	@post None
+	@parm std::vector<unsigned char> [code], std::uint64_t [bitCount]
+	@return the decoded symbols*/
+	std::vector<std::uint32_t> decode(const std::vector<unsigned char>& code, std::uint64_t bitCount) const;
+
+	/** fromUtf8
+	@pre text is valid UTF-8
+	@post None
+	@parm std::string [text]
+	@return the code point of every char of text*/
+	static std::vector<std::uint32_t> fromUtf8(const std::string& text);
+
+	/** toUtf8
+	@pre every code point <= 0x10FFFF
+	@post None
+	@parm std::vector<std::uint32_t> [codePoints]
+	@return the UTF-8 text of codePoints*/
+	static std::string toUtf8(const std::vector<std::uint32_t>& codePoints);
+
+	/** Accessor Methods */
+
+	/** symbolCount
+	@return number of symbols that have a code*/
+	int symbolCount() const;
+
+	/** codeLength
+	@parm std::uint32_t [symbol]
+	@return code length of symbol, 0 if it has no code*/
+	int codeLength(std::uint32_t symbol) const;
+
+	/** maxCodeLength
+	@return length of the longest code*/
+	int maxCodeLength() const;
+
+private:
+
+	/** Private Attributes */
+
+	// hash table slot, index -1 when empty
+	struct Slot {
+
+		std::uint32_t symbol_ = 0;
+		int index_ = -1;
+
+	}; // end of Slot
+
+	// single lookup decode entry, length 0 when the code is longer than SPARSE_LOOKUP_BITS
+	struct LookupEntry {
+
+		int index_ = 0;
+		int length_ = 0;
+
+	}; // end of LookupEntry
+
+	std::vector<std::uint32_t> symbols_; // dense index -> symbol, in canonical order
+	std::vector<std::uint64_t> codes_; // dense index -> code, right aligned
+	std::vector<int> lengths_; // dense index -> code length
+	std::vector<Slot> slots_; // symbol -> dense index
+	std::vector<LookupEntry> lookup_; // first SPARSE_LOOKUP_BITS bits -> symbol
+
+	// canonical tables, per code length
+	std::vector<std::uint64_t> firstCode_; // code of the first symbol of each length
+	std::vector<int> firstIndex_; // dense index of the first symbol of each length
+	std::vector<int> lengthCount_; // symbols of each length
+	int maxLength_;
+
+	/** Private Methods */
+
+	/** build
+	@pre symbols are distinct, counts.size() == symbols.size()
+	@post codebook, hash table and decode tables built for symbols with a count above 0
+	@parm std::vector<std::uint32_t> [symbols], std::vector<long long> [counts]*/
+	void build(const std::vector<std::uint32_t>& symbols, const std::vector<long long>& counts);
+
+	/** findIndex
+	@parm std::uint32_t [symbol]
+	@return dense index of symbol, -1 if it has no code*/
+	int findIndex(std::uint32_t symbol) const;
+
+	/** slotOf
+	@parm std::uint32_t [symbol]
+	@return first hash table slot to probe for symbol*/
+	unsigned int slotOf(std::uint32_t symbol) const;
+
+}; // End of SparseHuffmanCodec
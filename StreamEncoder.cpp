@@ -0,0 +1,342 @@
+/** @file StreamEncoder.cpp
+ @author Anthony Campos
+ @date 10/19/2026
+ This implementation file implements a StreamEncoder, a push style HuffmanAlgorithm encoder that
+ takes text a chunk at a time and emits packed code through a buffered ByteSink */
+
+//---------------------------------------------------------------------------
+// ByteSink classes:  where a StreamEncoder sends its bytes
+//   included features:
+//   -- MemorySink appends to a std::vector
+//   -- FileDescriptorSink writes to a file descriptor, retrying short writes
+//   -- OstreamSink writes to a std::ostream
+//
+// StreamEncoder class:  incremental packed encoding
+//   included features:
+//   -- write(chunk) encodes a chunk, the partial byte carries over to the next
+//			chunk so chunk boundaries do not change the code
+//   -- output collects in one fixed buffer and reaches the sink in writes of
+//			bufferSize bytes (shorter only on flush and finish), so memory use
+//			does not grow with the input
+//   -- flush() passes every complete byte on, finish() pads the last byte,
+//			flushes and returns the number of code bits
+//
+// Assumptions:
+//   --  only 'a' - 'z' are encoded, other chars are skipped
+//   --  the HuffmanAlgorithm outlives the StreamEncoder, so does the sink
+//---------------------------------------------------------------------------
+
+
+// included .h files
+#include "StreamEncoder.h"
+
+// Included libraries
+#include <cerrno>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+
+/** ByteSink */
+
+/** flush
+@pre None
+@post bytes the sink buffers itself passed on
+@return false if they could not be*/
+bool ByteSink::flush() {
+
+	return true;
+
+} // End of flush
+
+
+/** MemorySink */
+
+/** Constructor
+@pre None
+@post MemorySink Object created, appending to target
+@parm std::vector<unsigned char> [target] passed by reference, must outlive the sink*/
+MemorySink::MemorySink(std::vector<unsigned char>& target)
+	:target_(target)
+{} // End of Constructor
+
+/** write
+@post data appended to the target
+@return true*/
+bool MemorySink::write(const unsigned char* data, std::size_t size) {
+
+	target_.insert(target_.end(), data, data + size);
+
+	return true;
+
+} // End of write
+
+
+/** FileDescriptorSink */
+
+/** Constructor
+@pre fd is open for writing, the sink does not close it
+@post FileDescriptorSink Object created
+@parm int [fd]*/
+FileDescriptorSink::FileDescriptorSink(int fd)
+	:fd_(fd)
+{} // End of Constructor
+
+/** write
+@post data written to the file descriptor, interrupted and short writes are retried
+@return false if the file descriptor reported an error*/
+bool FileDescriptorSink::write(const unsigned char* data, std::size_t size) {
+
+	bool written = true;
+
+	while (written && size > 0) {
+
+#ifdef _WIN32
+		int result = ::_write(fd_, data, static_cast<unsigned int>(size > (1u << 30) ? (1u << 30) : size));
+#else
+		ssize_t result = ::write(fd_, data, size);
+#endif
+
+		if (result > 0) {
+
+			data += result;
+			size -= static_cast<std::size_t>(result);
+
+		}
+		else {
+
+			written = result < 0 && errno == EINTR;
+
+		} // end if
+
+	} // end while
+
+	return written;
+
+} // End of write
+
+
+/** OstreamSink */
+
+/** Constructor
+@pre None
+@post OstreamSink Object created
+@parm std::ostream [out] passed by reference, must outlive the sink*/
+OstreamSink::OstreamSink(std::ostream& out)
+	:out_(out)
+{} // End of Constructor
+
+/** write
+@post data written to the stream
+@return false if the stream went bad*/
+bool OstreamSink::write(const unsigned char* data, std::size_t size) {
+
+	out_.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(size));
+
+	return out_.good();
+
+} // End of write
+
+/** flush
+@post the stream flushed
+@return false if the stream went bad*/
+bool OstreamSink::flush() {
+
+	out_.flush();
+
+	return out_.good();
+
+} // End of flush
+
+
+/** StreamEncoder */
+
+/** Constructor
+@pre bufferSize > 0
+@post StreamEncoder Object created, nothing written yet
+@parm HuffmanAlgorithm [codec], ByteSink [sink] passed by reference,
+std::size_t [bufferSize] bytes collected before each write to sink*/
+StreamEncoder::StreamEncoder(const HuffmanAlgorithm& codec, ByteSink& sink, std::size_t bufferSize)
+	:sink_(sink), buffer_(bufferSize > 0 ? bufferSize : DEFAULT_STREAM_BUFFER_SIZE), bufferFill_(0),
+	accumulator_(0), accumulatorBits_(0), bitCount_(0), bytesWritten_(0), good_(true), finished_(false) {
+
+	// 26 letters give codes of at most 25 bits
+	char letter = 'a';
+	for (int i = 0; i < NUM_LETTERS; ++i) {
+
+		codeBits_[i] = static_cast<std::uint32_t>(codec.codeBits(letter));
+		codeLengths_[i] = codec.codeLength(letter);
+		++letter;
+
+	} // end for
+
+} // End of Constructor
+
+/** write
+@pre finish not yet called
+@post every lowercase letter of the chunk encoded, full buffers written to the sink
+@parm char* [data], std::size_t [size]
+@return false once the sink has failed or after finish*/
+bool StreamEncoder::write(const char* data, std::size_t size) {
+
+	bool accepted = good_ && !finished_;
+
+	for (std::size_t i = 0; accepted && i < size; ++i) {
+
+		char c = data[i];
+		// only valid char 'a' - 'z'
+		if (c >= 'a' && c <= 'z') {
+
+			const int length = codeLengths_[c - 'a'];
+
+			accumulator_ = (accumulator_ << length) | codeBits_[c - 'a'];
+			accumulatorBits_ += length;
+			bitCount_ += length;
+
+			// pending bits stay below 32 + 25, a 64 bit accumulator never overflows
+			if (accumulatorBits_ >= 32) {
+
+				accumulatorBits_ -= 32;
+				putByte(static_cast<unsigned char>(accumulator_ >> (accumulatorBits_ + 24)));
+				putByte(static_cast<unsigned char>(accumulator_ >> (accumulatorBits_ + 16)));
+				putByte(static_cast<unsigned char>(accumulator_ >> (accumulatorBits_ + 8)));
+				putByte(static_cast<unsigned char>(accumulator_ >> accumulatorBits_));
+				accumulator_ &= (static_cast<std::uint64_t>(1) << accumulatorBits_) - 1;
+
+			} // end if
+
+		} // end if
+
+	} // end for
+
+	return accepted && good_;
+
+} // End of write
+
+/** write
+@pre finish not yet called
+@parm std::string [chunk]
+@return false once the sink has failed or after finish*/
+bool StreamEncoder::write(const std::string& chunk) {
+
+	return write(chunk.data(), chunk.size());
+
+} // End of write
+
+/** flush
+@pre None
+@post every complete byte written to the sink and the sink flushed, the partial byte is kept
+@return false once the sink has failed*/
+bool StreamEncoder::flush() {
+
+	putCompleteBytes();
+	drain();
+	good_ = good_ && sink_.flush();
+
+	return good_;
+
+} // End of flush
+
+/** finish
+@pre None
+@post the partial byte padded with 0 bits and flushed, later writes are refused
+@return number of code bits written, padding excluded*/
+std::uint64_t StreamEncoder::finish() {
+
+	if (!finished_) {
+
+		putCompleteBytes();
+
+		if (accumulatorBits_ > 0) {
+
+			putByte(static_cast<unsigned char>((accumulator_ << (8 - accumulatorBits_)) & 0xFF));
+			accumulator_ = 0;
+			accumulatorBits_ = 0;
+
+		} // end if
+
+		drain();
+		good_ = good_ && sink_.flush();
+		finished_ = true;
+
+	} // end if
+
+	return bitCount_;
+
+} // End of finish
+
+/** putByte
+@pre None
+@post byte added to the buffer, the buffer written to the sink first if it is full
+@parm unsigned char [byte]*/
+void StreamEncoder::putByte(unsigned char byte) {
+
+	if (bufferFill_ == buffer_.size()) {
+
+		drain();
+
+	} // end if
+
+	buffer_[bufferFill_] = byte;
+	++bufferFill_;
+
+} // End of putByte
+
+/** putCompleteBytes
+@pre None
+@post every complete pending byte moved to the buffer, fewer than 8 bits left pending*/
+void StreamEncoder::putCompleteBytes() {
+
+	while (accumulatorBits_ >= 8) {
+
+		accumulatorBits_ -= 8;
+		putByte(static_cast<unsigned char>(accumulator_ >> accumulatorBits_));
+
+	} // end while
+
+	accumulator_ &= (static_cast<std::uint64_t>(1) << accumulatorBits_) - 1;
+
+} // End of putCompleteBytes
+
+/** drain
+@pre None
+@post buffered bytes written to the sink and the buffer emptied*/
+void StreamEncoder::drain() {
+
+	if (bufferFill_ > 0 && good_) {
+
+		good_ = sink_.write(buffer_.data(), bufferFill_);
+		bytesWritten_ += bufferFill_;
+
+	} // end if
+
+	bufferFill_ = 0;
+
+} // End of drain
+
+/** good
+@return false once the sink has failed*/
+bool StreamEncoder::good() const {
+
+	return good_;
+
+} // End of good
+
+/** bitCount
+@return number of code bits encoded so far, padding excluded*/
+std::uint64_t StreamEncoder::bitCount() const {
+
+	return bitCount_;
+
+} // End of bitCount
+
+/** bytesWritten
+@return number of bytes handed to the sink so far*/
+std::uint64_t StreamEncoder::bytesWritten() const {
+
+	return bytesWritten_;
+
+} // End of bytesWritten
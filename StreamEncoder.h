@@ -0,0 +1,238 @@
+/** @file StreamEncoder.h
+ @author Anthony Campos
+ @date 10/19/2026
+ This header class file implements a StreamEncoder, a push style HuffmanAlgorithm encoder that
+ takes text a chunk at a time and emits packed code through a buffered ByteSink */
+
+	//---------------------------------------------------------------------------
+	// ByteSink classes:  where a StreamEncoder sends its bytes
+	//   included features:
+	//   -- MemorySink appends to a std::vector
+	//   -- FileDescriptorSink writes to a file descriptor, retrying short writes
+	//   -- OstreamSink writes to a std::ostream
+	//
+	// StreamEncoder class:  incremental packed encoding
+	//   included features:
+	//   -- write(chunk) encodes a chunk, the partial byte carries over to the next
+	//			chunk so chunk boundaries do not change the code
+	//   -- output collects in one fixed buffer and reaches the sink in writes of
+	//			bufferSize bytes (shorter only on flush and finish), so memory use
+	//			does not grow with the input
+	//   -- flush() passes every complete byte on, finish() pads the last byte,
+	//			flushes and returns the number of code bits
+	//
+	// Assumptions:
+	//   --  only 'a' - 'z' are encoded, other chars are skipped
+	//   --  the HuffmanAlgorithm outlives the StreamEncoder, so does the sink
+	//---------------------------------------------------------------------------
+
+#pragma once
+
+// Included libraries
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// included .h files
+#include "HuffmanAlgorithm.h"
+
+// Default StreamEncoder buffer, the size of every write between flushes
+const std::size_t DEFAULT_STREAM_BUFFER_SIZE = 1 << 16;
+
+
+class ByteSink {
+
+public:
+
+	/** Destructor */
+	virtual ~ByteSink() {}
+
+	/** write
+	@pre None
+	@post size bytes of data passed on
+	@parm unsigned char* [data], std::size_t [size]
+	@return false if the bytes could not all be written*/
+	virtual bool write(const unsigned char* data, std::size_t size) = 0;
+
+	/** flush
+	@pre None
+	@post bytes the sink buffers itself passed on
+	@return false if they could not be*/
+	virtual bool flush();
+
+}; // End of ByteSink
+
+
+class MemorySink : public ByteSink {
+
+public:
+
+	/** Constructor
+	@pre None
+	@post MemorySink Object created, appending to target
+	@parm std::vector<unsigned char> [target] passed by reference, must outlive the sink*/
+	explicit MemorySink(std::vector<unsigned char>& target);
+
+	/** write
+	@post data appended to the target
+	@return true*/
+	bool write(const unsigned char* data, std::size_t size) override;
+
+private:
+
+	/** Private Attributes */
+	std::vector<unsigned char>& target_;
+
+}; // End of MemorySink
+
+
+class FileDescriptorSink : public ByteSink {
+
+public:
+
+	/** Constructor
+	@pre fd is open for writing, the sink does not close it
+	@post FileDescriptorSink Object created
+	@parm int [fd]*/
+	explicit FileDescriptorSink(int fd);
+
+	/** write
+	@post data written to the file descriptor, interrupted and short writes are retried
+	@return false if the file descriptor reported an error*/
+	bool write(const unsigned char* data, std::size_t size) override;
+
+private:
+
+	/** Private Attributes */
+	int fd_;
+
+}; // End of FileDescriptorSink
+
+
+class OstreamSink : public ByteSink {
+
+public:
+
+	/** Constructor
+	@pre None
+	@post OstreamSink Object created
+	@parm std::ostream [out] passed by reference, must outlive the sink*/
+	explicit OstreamSink(std::ostream& out);
+
+	/** write
+	@post data written to the stream
+	@return false if the stream went bad*/
+	bool write(const unsigned char* data, std::size_t size) override;
+
+	/** flush
+	@post the stream flushed
+	@return false if the stream went bad*/
+	bool flush() override;
+
+private:
+
+	/** Private Attributes */
+	std::ostream& out_;
+
+}; // End of OstreamSink
+
+
+class StreamEncoder {
+
+public:
+
+	/** Constructors */
+
+	/** Constructor
+	@pre bufferSize > 0
+	@post StreamEncoder Object created, nothing written yet
+	@parm HuffmanAlgorithm [codec], ByteSink [sink] passed by reference,
+	std::size_t [bufferSize] bytes collected before each write to sink*/
+	StreamEncoder(const HuffmanAlgorithm& codec, ByteSink& sink, std::size_t bufferSize = DEFAULT_STREAM_BUFFER_SIZE);
+
+	/** Copy Constructor & Assignment disabled, the encoder holds references to its sink */
+	StreamEncoder(const StreamEncoder& sourceEncoder) = delete;
+	StreamEncoder& operator=(const StreamEncoder& rhsEncoder) = delete;
+
+	/** Public Methods */
+
+	/** write
+	@pre finish not yet called
+	@post every lowercase letter of the chunk encoded, full buffers written to the sink
+	@parm char* [data], std::size_t [size]
+	@return false once the sink has failed or after finish*/
+	bool write(const char* data, std::size_t size);
+
+	/** write
+	@pre finish not yet called
+	@parm std::string [chunk]
+	@return false once the sink has failed or after finish*/
+	bool write(const std::string& chunk);
+
+	/** flush
+	@pre None
+	@post every complete byte written to the sink and the sink flushed, the partial byte is kept
+	@return false once the sink has failed*/
+	bool flush();
+
+	/** finish
+	@pre None
+	@post the partial byte padded with 0 bits and flushed, later writes are refused
+	@return number of code bits written, padding excluded*/
+	std::uint64_t finish();
+
+	/** Accessor Methods */
+
+	/** good
+	@return false once the sink has failed*/
+	bool good() const;
+
+	/** bitCount
+	@return number of code bits encoded so far, padding excluded*/
+	std::uint64_t bitCount() const;
+
+	/** bytesWritten
+	@return number of bytes handed to the sink so far*/
+	std::uint64_t bytesWritten() const;
+
+private:
+
+	/** Private Attributes */
+
+	ByteSink& sink_;
+
+	std::uint32_t codeBits_[NUM_LETTERS]; // codes of the codec, right aligned
+	int codeLengths_[NUM_LETTERS];
+
+	std::vector<unsigned char> buffer_; // fixed size, filled up to bufferFill_
+	std::size_t bufferFill_;
+
+	std::uint64_t accumulator_; // pending bits, right aligned
+	int accumulatorBits_; // number of pending bits, < 32 between letters
+
+	std::uint64_t bitCount_;
+	std::uint64_t bytesWritten_;
+	bool good_;
+	bool finished_;
+
+	/** Private Methods */
+
+	/** putByte
+	@pre None
+	@post byte added to the buffer, the buffer written to the sink first if it is full
+	@parm unsigned char [byte]*/
+	void putByte(unsigned char byte);
+
+	/** putCompleteBytes
+	@pre None
+	@post every complete pending byte moved to the buffer, fewer than 8 bits left pending*/
+	void putCompleteBytes();
+
+	/** drain
+	@pre None
+	@post buffered bytes written to the sink and the buffer emptied*/
+	void drain();
+
+}; // End of StreamEncoder
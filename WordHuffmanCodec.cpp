@@ -0,0 +1,326 @@
+/** @file WordHuffmanCodec.cpp
+ @author Anthony Campos
+ @date 10/19/2026
+ This implementation file implements a WordHuffmanCodec, Huffman Coding over a vocabulary of words
+ and separators, so each word is encoded and decoded as one symbol */
+
+//---------------------------------------------------------------------------
+// WordHuffmanCodec class:  word level Huffman Coding
+//   included features:
+//   -- text is split into tokens: runs of word bytes (letters, digits and
+//			UTF-8 bytes >= 0x80) and runs of separator bytes
+//   -- the vocabulary is the maxVocabulary most frequent tokens of a training
+//			sample, coded by a SparseHuffmanCodec
+//   -- a token outside the vocabulary is coded as the escape symbol, its
+//			length as an Elias gamma code and then its raw bytes
+//   -- decodes a whole token per code lookup
+//   -- allows for counting a word in packed code without rebuilding the text
+//
+// Assumptions:
+//   --  every byte value can be encoded, text is treated as raw bytes
+//   --  decode expects code made with the same training sample and maxVocabulary
+//---------------------------------------------------------------------------
+
+
+// included .h files
+#include "WordHuffmanCodec.h"
+
+// Included libraries
+#include <algorithm>
+
+namespace {
+
+	// longest escaped token length the decoder accepts, as gamma code zero bits
+	const int MAX_GAMMA_ZEROS = 40;
+
+	/** isWordByte: letters, digits and every byte of a multi-byte UTF-8 char */
+	inline bool isWordByte(char c) {
+
+		unsigned char byte = static_cast<unsigned char>(c);
+
+		return (byte >= 'a' && byte <= 'z') || (byte >= 'A' && byte <= 'Z') || (byte >= '0' && byte <= '9') || byte >= 0x80;
+
+	} // End of isWordByte
+
+	/** tokenEnd: index one past the token that starts at start */
+	inline std::size_t tokenEnd(const std::string& text, std::size_t start) {
+
+		const bool word = isWordByte(text[start]);
+		std::size_t end = start + 1;
+
+		while (end < text.size() && isWordByte(text[end]) == word) {
+			++end;
+		} // end while
+
+		return end;
+
+	} // End of tokenEnd
+
+} // end of namespace
+
+
+/** Constructor
+@pre maxVocabulary > 0
+@post WordHuffmanCodec Object created with the most frequent tokens of sample as its vocabulary
+@parm std::string [sample] training text, int [maxVocabulary] tokens kept at most*/
+WordHuffmanCodec::WordHuffmanCodec(const std::string& sample, int maxVocabulary) {
+
+	std::unordered_map<std::string, long long> tokenCounts;
+	for (std::size_t start = 0; start < sample.size(); ) {
+
+		std::size_t end = tokenEnd(sample, start);
+		++tokenCounts[sample.substr(start, end - start)];
+		start = end;
+
+	} // end for
+
+	// most frequent first, ties by token so the vocabulary does not depend on hash order
+	std::vector<std::pair<long long, std::string> > ranked;
+	ranked.reserve(tokenCounts.size());
+	for (std::unordered_map<std::string, long long>::const_iterator it = tokenCounts.begin(); it != tokenCounts.end(); ++it) {
+
+		ranked.push_back(std::make_pair(-it->second, it->first));
+
+	} // end for
+
+	std::sort(ranked.begin(), ranked.end());
+
+	std::size_t kept = ranked.size();
+	if (maxVocabulary > 0 && kept > static_cast<std::size_t>(maxVocabulary)) {
+		kept = maxVocabulary;
+	} // end if
+
+	// the escape symbol is always codable, it costs what the dropped tokens occurred
+	long long escapeCount = 1;
+	for (std::size_t i = kept; i < ranked.size(); ++i) {
+
+		escapeCount -= ranked[i].first;
+
+	} // end for
+
+	std::vector<std::uint32_t> codecSymbols(1, WORD_ESCAPE_SYMBOL);
+	std::vector<long long> codecCounts(1, escapeCount);
+
+	vocabulary_.reserve(kept);
+	for (std::size_t i = 0; i < kept; ++i) {
+
+		const std::uint32_t symbol = static_cast<std::uint32_t>(i + 1);
+
+		vocabulary_.push_back(ranked[i].second);
+		symbols_[ranked[i].second] = symbol;
+		codecSymbols.push_back(symbol);
+		codecCounts.push_back(-ranked[i].first);
+
+	} // end for
+
+	codec_ = SparseHuffmanCodec(codecSymbols, codecCounts);
+
+} // End of Constructor
+
+/** tokenize
+@pre None
+@post None
+@parm std::string [text]
+@return tokens of text in order, their concatenation is text*/
+std::vector<std::string> WordHuffmanCodec::tokenize(const std::string& text) {
+
+	std::vector<std::string> tokens;
+
+	for (std::size_t start = 0; start < text.size(); ) {
+
+		std::size_t end = tokenEnd(text, start);
+		tokens.push_back(text.substr(start, end - start));
+		start = end;
+
+	} // end for
+
+	return tokens;
+
+} // End of tokenize
+
+/** encode
+@pre None
+@post every token of in encoded, vocabulary tokens as one code each
+@parm std::string [in]
+@return packed code of in*/
+PackedCode WordHuffmanCodec::encode(const std::string& in) const {
+
+	BitWriter writer;
+
+	for (std::size_t start = 0; start < in.size(); ) {
+
+		std::size_t end = tokenEnd(in, start);
+		encodeToken(in.data() + start, end - start, writer);
+		start = end;
+
+	} // end for
+
+	writer.finish();
+
+	PackedCode code;
+	code.bitCount_ = writer.bitCount();
+	writer.swapBytes(code.bytes_);
+
+	return code;
+
+} // End of encode
+
+/** encodeToken
+@pre None
+@post code of token appended to writer, escaped if it is not in the vocabulary
+@parm char* [token], std::size_t [length], BitWriter [writer] passed by reference*/
+void WordHuffmanCodec::encodeToken(const char* token, std::size_t length, BitWriter& writer) const {
+
+	std::unordered_map<std::string, std::uint32_t>::const_iterator found = symbols_.find(std::string(token, length));
+
+	if (found != symbols_.end()) {
+
+		codec_.encodeSymbol(found->second, writer);
+
+	}
+	else {
+
+		codec_.encodeSymbol(WORD_ESCAPE_SYMBOL, writer);
+
+		// Elias gamma: one 0 per bit after the leading 1, then the length itself
+		int lengthBits = 0;
+		while ((static_cast<std::uint64_t>(length) >> lengthBits) > 1) {
+			++lengthBits;
+		} // end while
+
+		writer.writeBits(0, lengthBits);
+		writer.writeBits(length, lengthBits + 1);
+
+		for (std::size_t i = 0; i < length; ++i) {
+
+			writer.writeBits(static_cast<unsigned char>(token[i]), 8);
+
+		} // end for
+
+	} // end if
+
+} // End of encodeToken
+
+/** decodeToken
+@pre reader at the start of a token's code
+@post reader moved past the token if it is complete
+@parm BitReader [reader] passed by reference, std::uint32_t [symbol] passed by reference,
+std::string [escaped] passed by reference, filled when symbol is WORD_ESCAPE_SYMBOL
+@return true if a complete token was decoded*/
+bool WordHuffmanCodec::decodeToken(BitReader& reader, std::uint32_t& symbol, std::string& escaped) const {
+
+	BitReader lookAhead = reader;
+	bool decoded = codec_.decodeSymbol(lookAhead, symbol) && symbol <= vocabulary_.size();
+
+	if (decoded && symbol == WORD_ESCAPE_SYMBOL) {
+
+		int lengthBits = 0;
+		while (lookAhead.remaining() > 0 && lengthBits <= MAX_GAMMA_ZEROS && lookAhead.peekBits(1) == 0) {
+
+			lookAhead.skipBits(1);
+			++lengthBits;
+
+		} // end while
+
+		decoded = lengthBits <= MAX_GAMMA_ZEROS && lookAhead.remaining() >= static_cast<std::uint64_t>(lengthBits + 1);
+
+		if (decoded) {
+
+			std::uint64_t length = lookAhead.readBits(lengthBits + 1);
+			decoded = lookAhead.remaining() / 8 >= length;
+
+			if (decoded) {
+
+				escaped.resize(static_cast<std::size_t>(length));
+				for (std::uint64_t i = 0; i < length; ++i) {
+
+					escaped[static_cast<std::size_t>(i)] = static_cast<char>(lookAhead.readBits(8));
+
+				} // end for
+
+			} // end if
+
+		} // end if
+
+	} // end if
+
+	if (decoded) {
+
+		reader = lookAhead;
+
+	} // end if
+
+	return decoded;
+
+} // End of decodeToken
+
+/** decode
+@pre code was made by encode of a WordHuffmanCodec with the same vocabulary
+@post None, decoding stops at the first incomplete token
+@parm PackedCode [code]
+@return text of code*/
+std::string WordHuffmanCodec::decode(const PackedCode& code) const {
+
+	std::string text{};
+
+	BitReader reader(code.bytes_.data(), code.bitCount_);
+	std::uint32_t symbol = 0;
+	std::string escaped{};
+
+	while (reader.remaining() > 0 && decodeToken(reader, symbol, escaped)) {
+
+		text += (symbol == WORD_ESCAPE_SYMBOL) ? escaped : vocabulary_[symbol - 1];
+
+	} // end while
+
+	return text;
+
+} // End of decode
+
+/** countWord
+@pre code was made by encode of a WordHuffmanCodec with the same vocabulary
+@post None
+@parm PackedCode [code], std::string [word]
+@return number of times word occurs as a token of the text of code. Vocabulary words are
+matched by symbol, without rebuilding the text*/
+long long WordHuffmanCodec::countWord(const PackedCode& code, const std::string& word) const {
+
+	long long count = 0;
+
+	std::unordered_map<std::string, std::uint32_t>::const_iterator found = symbols_.find(word);
+	const std::uint32_t target = (found != symbols_.end()) ? found->second : WORD_ESCAPE_SYMBOL;
+
+	BitReader reader(code.bytes_.data(), code.bitCount_);
+	std::uint32_t symbol = 0;
+	std::string escaped{};
+
+	while (reader.remaining() > 0 && decodeToken(reader, symbol, escaped)) {
+
+		if (symbol == target && (target != WORD_ESCAPE_SYMBOL || escaped == word)) {
+			++count;
+		} // end if
+
+	} // end while
+
+	return count;
+
+} // End of countWord
+
+/** vocabularySize
+@return number of tokens in the vocabulary*/
+int WordHuffmanCodec::vocabularySize() const {
+
+	return static_cast<int>(vocabulary_.size());
+
+} // End of vocabularySize
+
+/** codeLength
+@parm std::string [token]
+@return code length of token, 0 if it is not in the vocabulary*/
+int WordHuffmanCodec::codeLength(const std::string& token) const {
+
+	std::unordered_map<std::string, std::uint32_t>::const_iterator found = symbols_.find(token);
+
+	return (found != symbols_.end()) ? codec_.codeLength(found->second) : 0;
+
+} // End of codeLength
@@ -0,0 +1,121 @@
+/** @file WordHuffmanCodec.h
+ @author Anthony Campos
+ @date 10/19/2026
+ This header class file implements a WordHuffmanCodec, Huffman Coding over a vocabulary of words
+ and separators, so each word is encoded and decoded as one symbol */
+
+	//---------------------------------------------------------------------------
+	// WordHuffmanCodec class:  word level Huffman Coding
+	//   included features:
+	//   -- text is split into tokens: runs of word bytes (letters, digits and
+	//			UTF-8 bytes >= 0x80) and runs of separator bytes
+	//   -- the vocabulary is the maxVocabulary most frequent tokens of a training
+	//			sample, coded by a SparseHuffmanCodec
+	//   -- a token outside the vocabulary is coded as the escape symbol, its
+	//			length as an Elias gamma code and then its raw bytes
+	//   -- decodes a whole token per code lookup
+	//   -- allows for counting a word in packed code without rebuilding the text
+	//
+	// Assumptions:
+	//   --  every byte value can be encoded, text is treated as raw bytes
+	//   --  decode expects code made with the same training sample and maxVocabulary
+	//---------------------------------------------------------------------------
+
+#pragma once
+
+// Included libraries
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// included .h files
+#include "SparseHuffmanCodec.h"
+#include "BitStream.h"
+
+// Default number of tokens kept in the vocabulary
+const int DEFAULT_WORD_VOCABULARY = 1 << 16;
+
+// Symbol of a token outside the vocabulary, vocabulary tokens are 1 - vocabularySize
+const std::uint32_t WORD_ESCAPE_SYMBOL = 0;
+
+
+class WordHuffmanCodec {
+
+public:
+
+	/** Constructors */
+
+	/** Constructor
+	@pre maxVocabulary > 0
+	@post WordHuffmanCodec Object created with the most frequent tokens of sample as its vocabulary
+	@parm std::string [sample] training text, int [maxVocabulary] tokens kept at most*/
+	explicit WordHuffmanCodec(const std::string& sample, int maxVocabulary = DEFAULT_WORD_VOCABULARY);
+
+	/** Public Methods */
+
+	/** tokenize
+	@pre None
+	@post None
+	@parm std::string [text]
+	@return tokens of text in order, their concatenation is text*/
+	static std::vector<std::string> tokenize(const std::string& text);
+
+	/** encode
+	@pre None
+	@post every token of in encoded, vocabulary tokens as one code each
+	@parm std::string [in]
+	@return packed code of in*/
+	PackedCode encode(const std::string& in) const;
+
+	/** decode
+	@pre code was made by encode of a WordHuffmanCodec with the same vocabulary
+	@post None, decoding stops at the first incomplete token
+	@parm PackedCode [code]
+	@return text of code*/
+	std::string decode(const PackedCode& code) const;
+
+	/** countWord
+	@pre code was made by encode of a WordHuffmanCodec with the same vocabulary
+	@post None
+	@parm PackedCode [code], std::string [word]
+	@return number of times word occurs as a token of the text of code. Vocabulary words are
+	matched by symbol, without rebuilding the text*/
+	long long countWord(const PackedCode& code, const std::string& word) const;
+
+	/** Accessor Methods */
+
+	/** vocabularySize
+	@return number of tokens in the vocabulary*/
+	int vocabularySize() const;
+
+	/** codeLength
+	@parm std::string [token]
+	@return code length of token, 0 if it is not in the vocabulary*/
+	int codeLength(const std::string& token) const;
+
+private:
+
+	/** Private Attributes */
+
+	std::vector<std::string> vocabulary_; // symbol - 1 -> token
+	std::unordered_map<std::string, std::uint32_t> symbols_; // token -> symbol
+	SparseHuffmanCodec codec_;
+
+	/** Private Methods */
+
+	/** encodeToken
+	@pre None
+	@post code of token appended to writer, escaped if it is not in the vocabulary
+	@parm char* [token], std::size_t [length], BitWriter [writer] passed by reference*/
+	void encodeToken(const char* token, std::size_t length, BitWriter& writer) const;
+
+	/** decodeToken
+	@pre reader at the start of a token's code
+	@post reader moved past the token if it is complete
+	@parm BitReader [reader] passed by reference, std::uint32_t [symbol] passed by reference,
+	std::string [escaped] passed by reference, filled when symbol is WORD_ESCAPE_SYMBOL
+	@return true if a complete token was decoded*/
+	bool decodeToken(BitReader& reader, std::uint32_t& symbol, std::string& escaped) const;
+
+}; // End of WordHuffmanCodec
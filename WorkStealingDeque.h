@@ -0,0 +1,112 @@
+//--------------------------------------------------------------------
+// WORKSTEALINGDEQUE.H
+// Declaration and definition of the template WorkStealingDeque class
+// Author: Anthony Campos
+//--------------------------------------------------------------------
+// WorkStealingDeque class:
+//	Implements one worker's deque of a work stealing pool with the
+//	following methods:
+//		push, pop, steal, size
+//  The owner pushes and pops at the back, so it works on its newest
+//  items, other workers steal the oldest item from the front. A short
+//  lock guards both ends, contention is rare since thieves only come
+//  when their own deque is empty.
+//  Assumptions:
+//	 Only the owner calls push and pop, any thread may call steal
+//	 Item must be default constructible and movable
+//--------------------------------------------------------------------
+
+#pragma once
+#include <deque>
+#include <mutex>
+
+template <typename Item>
+class WorkStealingDeque {
+
+public:
+
+	/** Constructors */
+
+	/** Defualt Constructor
+	@pre None
+	@post empty WorkStealingDeque Object created*/
+	WorkStealingDeque() {
+
+	} // End of Constructor
+
+	/** Copy Constructor & Assignment disabled, deque is shared between threads */
+	WorkStealingDeque(const WorkStealingDeque& sourceDeque) = delete;
+	WorkStealingDeque& operator=(const WorkStealingDeque& rhsDeque) = delete;
+
+
+	//------------------------------------------------------------------------
+	// push - adds a single item to the back of the deque
+	// Preconditions: called by the owner thread only
+	// Postconditions: item is moved into the deque
+	void push(Item& item) {
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		items_.push_back(std::move(item));
+
+	} // end of push
+
+	//------------------------------------------------------------------------
+	// pop - removes the newest item
+	// Preconditions: called by the owner thread only
+	// Postconditions: returns false if the deque is empty, otherwise the
+	//		back item is moved into item and true is returned
+	bool pop(Item& item) {
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		bool popped = !items_.empty();
+
+		if (popped) {
+
+			item = std::move(items_.back());
+			items_.pop_back();
+
+		} // end if
+
+		return popped;
+
+	} // end of pop
+
+	//------------------------------------------------------------------------
+	// steal - removes the oldest item
+	// Preconditions: None
+	// Postconditions: returns false if the deque is empty, otherwise the
+	//		front item is moved into item and true is returned
+	bool steal(Item& item) {
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		bool stolen = !items_.empty();
+
+		if (stolen) {
+
+			item = std::move(items_.front());
+			items_.pop_front();
+
+		} // end if
+
+		return stolen;
+
+	} // end of steal
+
+	//------------------------------------------------------------------------
+	// size - number of items, may be out of date as soon as it returns
+	// Preconditions: None
+	// Postconditions: None
+	std::size_t size() const {
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		return items_.size();
+
+	} // end of size
+
+private:
+
+	// attributes
+	std::deque<Item> items_;				// front is the oldest item
+	mutable std::mutex mutex_;				// guards items_
+
+}; // End of WorkStealingDeque
@@ -1,9 +1,32 @@
+#include <algorithm>
+#include <chrono>
 #include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
 #include <vector>
 
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+// the DEFLATE check inflates through zlib, build with -DHUFFMAN_ZLIB_CHECK and link -lz
+#if defined(HUFFMAN_ZLIB_CHECK)
+#include <zlib.h>
+#endif
+
 #include "PriorityQueue.h"
 #include "HuffmanTree.h"
 #include "HuffmanAlgorithm.h"
+#include "ContextHuffmanAlgorithm.h"
+#include "BigramHuffmanCodec.h"
+#include "BlockTransformCodec.h"
+#include "CompressedSearch.h"
+#include "CompressionClient.h"
+#include "DeflateCompressor.h"
+#include "RansCodec.h"
+#include "SampledHistogram.h"
 
 int main(){
 
@@ -103,8 +126,454 @@ int main(){
 	std::cout << leastCode << ": " << code.decipher(leastCode) << std::endl;
 	std::cout << hellCode << ": " << code.decipher(hellCode) << std::endl;
 	std::cout << std::endl;
+
+	/* ContextHuffmanAlgorithm Testing */
+
+	std::string sample = "thequickbrownfoxjumpsoverthelazydog";
+	for (int i = 0; i < 4; i++) {
+		sample += sample;
+	}
+
+	long long pairCounts[NUM_LETTERS][NUM_LETTERS] = {};
+	ContextHuffmanAlgorithm::countPairs(sample, pairCounts);
+	ContextHuffmanAlgorithm contextCode(pairCounts);
+
+	std::string contextCodeText = contextCode.getWord("thelazydog");
+	std::cout << "+=====+ Context Test +=====+" << std::endl;
+	std::cout << "tables: " << contextCode.tableCount() << std::endl;
+	std::cout << contextCodeText << ": " << contextCode.decipher(contextCodeText) << std::endl;
+	std::cout << std::endl;
+
+	/* BlockTransformCodec Benchmark */
+
+	const char* phrases[] = { "thequickbrownfox", "jumpsover", "thelazydog", "andthecat" };
+	std::string repetitive{};
+	while (repetitive.size() < (1 << 22)) {
+		repetitive += phrases[rand() % 4];
+	}
+
+	long long repetitiveCounts[NUM_LETTERS] = {};
+	for (unsigned int i = 0; i < repetitive.size(); i++) {
+		repetitiveCounts[repetitive[i] - 'a']++;
+	}
+
+	std::chrono::steady_clock::time_point plainStart = std::chrono::steady_clock::now();
+	HuffmanAlgorithm plainCode(repetitiveCounts);
+	PackedCode plainPacked = plainCode.encode(repetitive);
+	bool plainRoundTrip = plainCode.decode(plainPacked) == repetitive;
+	std::chrono::steady_clock::time_point plainEnd = std::chrono::steady_clock::now();
+
+	BlockTransformCodec transformCode;
+	std::vector<unsigned char> transformPacked = transformCode.compress(repetitive);
+	std::string transformText{};
+	bool transformRoundTrip = transformCode.decompress(transformPacked, transformText) && transformText == repetitive;
+	std::chrono::steady_clock::time_point transformEnd = std::chrono::steady_clock::now();
+
+	std::cout << "+=====+ Block Transform Benchmark +=====+" << std::endl;
+	std::cout << "input bytes:     " << repetitive.size() << std::endl;
+	std::cout << "plain bytes:     " << plainPacked.bytes_.size() << (plainRoundTrip ? "" : " (round trip failed)") << ", "
+		<< std::chrono::duration_cast<std::chrono::milliseconds>(plainEnd - plainStart).count() << " ms" << std::endl;
+	std::cout << "transform bytes: " << transformPacked.size() << (transformRoundTrip ? "" : " (round trip failed)") << ", "
+		<< std::chrono::duration_cast<std::chrono::milliseconds>(transformEnd - plainEnd).count() << " ms" << std::endl;
+	std::cout << std::endl;
+
+	/* DeflateCompressor Benchmark */
+
+	std::chrono::steady_clock::time_point deflateStart = std::chrono::steady_clock::now();
+	DeflateCompressor deflateCode;
+	std::vector<unsigned char> deflatePacked = deflateCode.compress(repetitive);
+	std::chrono::steady_clock::time_point deflateEnd = std::chrono::steady_clock::now();
+
+	std::cout << "+=====+ DEFLATE Benchmark +=====+" << std::endl;
+	std::cout << "input bytes:   " << repetitive.size() << std::endl;
+	std::cout << "deflate bytes: " << deflatePacked.size() << " (level " << deflateCode.level() << "), "
+		<< std::chrono::duration_cast<std::chrono::milliseconds>(deflateEnd - deflateStart).count() << " ms" << std::endl;
+	std::cout << std::endl;
+
+	/* RansCodec Benchmark */
+
+	// one letter dominates, Huffman still spends a whole bit on it
+	long long skewedCounts[NUM_LETTERS];
+	for (int i = 0; i < NUM_LETTERS; i++) {
+		skewedCounts[i] = 1 + rand() % 20;
+	}
+	skewedCounts['e' - 'a'] = 5000;
+
+	long long skewedTotal = 0;
+	for (int i = 0; i < NUM_LETTERS; i++) {
+		skewedTotal += skewedCounts[i];
+	}
+
+	std::string skewed{};
+	while (skewed.size() < (1 << 22)) {
+
+		long long pick = rand() % skewedTotal;
+		int letter = 0;
+		while (pick >= skewedCounts[letter]) {
+			pick -= skewedCounts[letter];
+			letter++;
+		}
+
+		skewed += static_cast<char>('a' + letter);
+
+	}
+
+	std::chrono::steady_clock::time_point huffmanStart = std::chrono::steady_clock::now();
+	HuffmanAlgorithm skewedHuffman(skewedCounts);
+	PackedCode huffmanPacked = skewedHuffman.encode(skewed);
+	bool huffmanRoundTrip = skewedHuffman.decode(huffmanPacked) == skewed;
+	std::chrono::steady_clock::time_point huffmanEnd = std::chrono::steady_clock::now();
+
+	RansCodec skewedRans(skewedCounts);
+	PackedCode ransPacked = skewedRans.encode(skewed);
+	bool ransRoundTrip = skewedRans.decode(ransPacked) == skewed;
+	std::chrono::steady_clock::time_point ransEnd = std::chrono::steady_clock::now();
+
+	std::cout << "+=====+ rANS Benchmark +=====+" << std::endl;
+	std::cout << "input letters: " << skewed.size() << std::endl;
+	std::cout << "huffman bytes: " << huffmanPacked.bytes_.size() << (huffmanRoundTrip ? "" : " (round trip failed)") << ", "
+		<< std::chrono::duration_cast<std::chrono::milliseconds>(huffmanEnd - huffmanStart).count() << " ms" << std::endl;
+	std::cout << "rANS bytes:    " << ransPacked.bytes_.size() << (ransRoundTrip ? "" : " (round trip failed)") << ", "
+		<< std::chrono::duration_cast<std::chrono::milliseconds>(ransEnd - huffmanEnd).count() << " ms" << std::endl;
+	std::cout << std::endl;
+
+	/* BigramHuffmanCodec Benchmark */
+
+	// pairs of the dominant letter share one short code
+	BigramHuffmanCodec skewedBigram(skewed);
+
+	std::chrono::steady_clock::time_point bigramStart = std::chrono::steady_clock::now();
+	PackedCode bigramPacked = skewedBigram.encode(skewed);
+	std::chrono::steady_clock::time_point bigramEncoded = std::chrono::steady_clock::now();
+	bool bigramRoundTrip = skewedBigram.decode(bigramPacked) == skewed;
+	std::chrono::steady_clock::time_point bigramEnd = std::chrono::steady_clock::now();
+
+	std::cout << "+=====+ Bigram Benchmark +=====+" << std::endl;
+	std::cout << "input letters: " << skewed.size() << std::endl;
+	std::cout << "huffman bytes: " << huffmanPacked.bytes_.size() << std::endl;
+	std::cout << "bigram bytes:  " << bigramPacked.bytes_.size() << (bigramRoundTrip ? "" : " (round trip failed)") << ", "
+		<< skewedBigram.bitsPerLetter() << " bits per letter" << std::endl;
+	std::cout << "bigram encode: " << std::chrono::duration_cast<std::chrono::milliseconds>(bigramEncoded - bigramStart).count() << " ms, decode: "
+		<< std::chrono::duration_cast<std::chrono::milliseconds>(bigramEnd - bigramEncoded).count() << " ms" << std::endl;
+	std::cout << std::endl;
+
+	/* SampledHistogram Benchmark */
+
+	// codebook from 64 KiB of the input, then a single encoding pass
+	std::istringstream skewedStream(skewed);
+	SampledHistogram skewedSample;
+	skewedSample.sampleStrided(skewedStream, 1 << 16, 1 << 12);
+
+	long long sampledCounts[NUM_LETTERS];
+	skewedSample.estimate(sampledCounts);
+	HuffmanAlgorithm sampledHuffman(sampledCounts);
+
+	std::vector<unsigned char> sampledPacked{};
+	MemorySink sampledSink(sampledPacked);
+	SamplingReport sampledReport;
+	skewedSample.encode(sampledHuffman, skewedStream, sampledSink, sampledReport);
+
+	std::cout << "+=====+ Sampled Histogram Benchmark +=====+" << std::endl;
+	std::cout << "sampled bytes: " << sampledReport.sampledBytes_ << " of " << sampledReport.inputBytes_ << std::endl;
+	std::cout << "code bits:     " << sampledReport.codeBits_ << ", exact counts: " << sampledReport.exactCodeBits_ << std::endl;
+	std::cout << "ratio loss:    " << sampledReport.ratioLoss_ * 100 << "%" << std::endl;
+	std::cout << std::endl;
+
+	/* Self Checks */
+
+	// each check prints FAILED on a mismatch and makes main return 1
+	int failedChecks = 0;
+
+	/* CompressedSearch Check */
+
+	// random codebooks, texts and patterns, matches compared with std::string::find.
+	// Patterns of more than MAX_BYTE_TABLE_PATTERN letters take the bit stepping path
+	int searchCases = 0;
+	int searchMismatches = 0;
+	for (int round = 0; round < 200; round++) {
+
+		const int alphabet = 2 + rand() % 6;
+
+		long long searchCounts[NUM_LETTERS];
+		for (int i = 0; i < NUM_LETTERS; i++) {
+			searchCounts[i] = (i < alphabet) ? 1 + rand() % 100 : rand() % 3;
+		}
+		HuffmanAlgorithm searchCode(searchCounts);
+
+		std::string searchText{};
+		const int textLength = rand() % 3000;
+		for (int i = 0; i < textLength; i++) {
+			searchText += static_cast<char>('a' + rand() % alphabet);
+		}
+		PackedCode searchPacked = searchCode.encode(searchText);
+
+		for (int p = 0; p < 4; p++) {
+
+			// mostly pieces of the text, so there are matches to find
+			const int patternLength = (p == 3) ? MAX_BYTE_TABLE_PATTERN + 1 + rand() % 16 : 1 + rand() % 8;
+			std::string pattern{};
+			if (rand() % 4 != 0 && textLength >= patternLength) {
+				pattern = searchText.substr(rand() % (textLength - patternLength + 1), patternLength);
+			}
+			else {
+				for (int i = 0; i < patternLength; i++) {
+					pattern += static_cast<char>('a' + rand() % alphabet);
+				}
+			}
+
+			std::vector<std::uint64_t> expected{};
+			for (std::size_t at = searchText.find(pattern); at != std::string::npos; at = searchText.find(pattern, at + 1)) {
+				expected.push_back(at);
+			}
+
+			CompressedSearch search(searchCode, pattern);
+			searchCases++;
+			if (search.findAll(searchPacked) != expected || search.count(searchPacked) != static_cast<long long>(expected.size())
+				|| search.contains(searchPacked) != !expected.empty()) {
+				searchMismatches++;
+			}
+
+		}
+
+	}
+
+	std::cout << "+=====+ Compressed Search Check +=====+" << std::endl;
+	std::cout << "naive search:  " << searchCases << " random cases, "
+		<< (searchMismatches == 0 ? "all matched" : std::to_string(searchMismatches) + " mismatched, FAILED") << std::endl;
+	std::cout << std::endl;
+	failedChecks += (searchMismatches == 0) ? 0 : 1;
+
+	/* DeflateCompressor Check */
+
+	std::cout << "+=====+ DEFLATE Check +=====+" << std::endl;
+
+#if defined(HUFFMAN_ZLIB_CHECK)
+	// every level on empty, short, random byte, skewed and repetitive inputs, inflated by
+	// zlib as raw DEFLATE (window bits -15) and compared with the input
+	std::vector<std::string> deflateInputs = { "", "a", "abcabcabcabc", skewed.substr(0, 100000), repetitive.substr(0, 300000) };
+	for (int n = 0; n < 8; n++) {
+
+		std::string randomBytes{};
+		const int randomLength = rand() % (1 << (4 + 2 * n));
+		for (int i = 0; i < randomLength; i++) {
+			randomBytes += static_cast<char>(rand() % ((n % 2 == 0) ? 256 : 4));
+		}
+		deflateInputs.push_back(randomBytes);
+
+	}
+
+	int deflateCases = 0;
+	int deflateMismatches = 0;
+	for (int level = 0; level <= 9; level++) {
+
+		DeflateCompressor levelCode(level);
+
+		for (unsigned int i = 0; i < deflateInputs.size(); i++) {
+
+			std::vector<unsigned char> packed = levelCode.compress(deflateInputs[i]);
+			std::string inflated(deflateInputs[i].size() + 1, '\0');
+
+			z_stream stream = {};
+			bool inflatedAll = inflateInit2(&stream, -15) == Z_OK;
+			if (inflatedAll) {
+
+				stream.next_in = packed.data();
+				stream.avail_in = static_cast<uInt>(packed.size());
+				stream.next_out = reinterpret_cast<Bytef*>(&inflated[0]);
+				stream.avail_out = static_cast<uInt>(inflated.size());
+
+				// the extra output byte must stay unused, the stream has to end exactly there
+				inflatedAll = inflate(&stream, Z_FINISH) == Z_STREAM_END && stream.avail_in == 0
+					&& stream.total_out == deflateInputs[i].size();
+				inflateEnd(&stream);
+
+			}
+
+			inflated.resize(deflateInputs[i].size());
+			deflateCases++;
+			if (!inflatedAll || inflated != deflateInputs[i]) {
+				deflateMismatches++;
+			}
+
+		}
+
+	}
+
+	std::cout << "zlib inflate:  " << deflateCases << " inputs at levels 0 - 9, "
+		<< (deflateMismatches == 0 ? "all matched" : std::to_string(deflateMismatches) + " mismatched, FAILED") << std::endl;
+	failedChecks += (deflateMismatches == 0) ? 0 : 1;
+#else
+	std::cout << "zlib inflate:  skipped, build with -DHUFFMAN_ZLIB_CHECK and -lz" << std::endl;
+#endif
+
+	std::cout << std::endl;
+
+	/* Alphabetic Code Check */
+
+	// Garsia-Wachs trees against the O(n^3) dynamic program for optimal alphabetic trees:
+	// cost[i][j] = min over k of cost[i][k] + cost[k + 1][j], plus the weight of leaves i - j
+	int alphabeticCases = 0;
+	int alphabeticMismatches = 0;
+	for (int round = 0; round < 300; round++) {
+
+		const int leaves = 2 + rand() % 39;
+		std::vector<long long> leafCounts(leaves);
+		for (int i = 0; i < leaves; i++) {
+			leafCounts[i] = (rand() % 8 == 0) ? 0 : rand() % ((round % 2 == 0) ? 100 : 1000000);
+		}
+
+		std::vector<long long> prefix(leaves + 1, 0);
+		for (int i = 0; i < leaves; i++) {
+			prefix[i + 1] = prefix[i] + leafCounts[i];
+		}
+
+		std::vector<std::vector<long long>> cost(leaves, std::vector<long long>(leaves, 0));
+		for (int width = 2; width <= leaves; width++) {
+			for (int i = 0; i + width <= leaves; i++) {
+
+				const int j = i + width - 1;
+				long long best = cost[i][i] + cost[i + 1][j];
+				for (int k = i + 1; k < j; k++) {
+					best = std::min(best, cost[i][k] + cost[k + 1][j]);
+				}
+				cost[i][j] = best + prefix[j + 1] - prefix[i];
+
+			}
+		}
+
+		HuffmanTree alphabeticTree;
+		alphabeticTree.buildAlphabetic(leafCounts);
+		std::vector<int> leafLengths(leaves, 0);
+		alphabeticTree.codeLengths(leafLengths);
+
+		long long treeCost = 0;
+		for (int i = 0; i < leaves; i++) {
+			treeCost += leafCounts[i] * leafLengths[i];
+		}
+
+		alphabeticCases++;
+		if (treeCost != cost[0][leaves - 1]) {
+			alphabeticMismatches++;
+		}
+
+	}
+
+	// and the codes of an ALPHABETIC_ORDER codebook sort like the letters
+	long long orderCounts[NUM_LETTERS];
+	for (int i = 0; i < NUM_LETTERS; i++) {
+		orderCounts[i] = rand() % 1000;
+	}
+	HuffmanAlgorithm orderCode(orderCounts, NO_NORMALIZATION, ALPHABETIC_ORDER);
+
+	bool alphabeticSorted = true;
+	for (int i = 0; i + 1 < NUM_LETTERS; i++) {
+		alphabeticSorted = alphabeticSorted && HuffmanAlgorithm::compareCodes(orderCode.encode(std::string(1, static_cast<char>('a' + i))),
+			orderCode.encode(std::string(1, static_cast<char>('a' + i + 1)))) < 0;
+	}
+
+	std::cout << "+=====+ Alphabetic Code Check +=====+" << std::endl;
+	std::cout << "O(n^3) costs:  " << alphabeticCases << " random counts, "
+		<< (alphabeticMismatches == 0 ? "all matched" : std::to_string(alphabeticMismatches) + " mismatched, FAILED") << std::endl;
+	std::cout << "letter order:  " << (alphabeticSorted ? "codes sorted" : "codes out of order, FAILED") << std::endl;
+	std::cout << std::endl;
+	failedChecks += (alphabeticMismatches == 0 && alphabeticSorted) ? 0 : 1;
+
+#ifndef _WIN32
+	/* CompressionDaemon Benchmark */
+
+	// load generator: client threads send encode then decode requests back to back
+	CompressionDaemon daemon(2);
+	std::string daemonPath = "/tmp/huffman-daemon-" + std::to_string(getpid()) + ".sock";
+
+	std::shared_ptr<CodebookDictionary> daemonDictionary = std::make_shared<CodebookDictionary>();
+	daemonDictionary->assign(CodebookDictionary::train(repetitive, 1, 1));
+	daemon.registry().publish(daemonDictionary);
+
+	if (daemon.start(daemonPath)) {
+
+		const int loadClients = 8;
+		const int loadRequests = 1000;
+		std::vector<std::vector<long long>> loadLatencies(loadClients);
+		std::vector<std::thread> loadThreads;
+
+		std::chrono::steady_clock::time_point loadStart = std::chrono::steady_clock::now();
+
+		for (int c = 0; c < loadClients; c++) {
+
+			loadThreads.emplace_back([&, c]() {
+
+				CompressionClient client;
+				client.connect(daemonPath);
+
+				std::vector<unsigned char> message{};
+				std::string text{};
+
+				for (int i = 0; i < loadRequests && client.isConnected(); i++) {
+
+					// 64 - 320 letters of the repetitive text
+					std::string request = repetitive.substr((c * loadRequests + i) * 97 % (1 << 20), 64 + i % 257);
+
+					std::chrono::steady_clock::time_point sent = std::chrono::steady_clock::now();
+					client.encode(1, request, message);
+					client.decode(message, text);
+					loadLatencies[c].push_back(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - sent).count());
+
+				}
+
+			});
+
+		}
+
+		for (unsigned int c = 0; c < loadThreads.size(); c++) {
+			loadThreads[c].join();
+		}
+
+		std::chrono::steady_clock::time_point loadEnd = std::chrono::steady_clock::now();
+
+		std::vector<long long> roundTrips{};
+		for (int c = 0; c < loadClients; c++) {
+			roundTrips.insert(roundTrips.end(), loadLatencies[c].begin(), loadLatencies[c].end());
+		}
+		std::sort(roundTrips.begin(), roundTrips.end());
+
+		DaemonStats daemonStats = daemon.stats();
+
+		// hostile decode: a bit count near 2^64 must be refused, not read past the payload
+		CompressionClient probe;
+		probe.connect(daemonPath);
+
+		std::vector<unsigned char> probeMessage{};
+		std::string probeText{};
+		bool probeServing = probe.encode(1, "hostile", probeMessage);
+
+		std::vector<unsigned char> hostileMessage = probeMessage;
+		for (int i = 8; i < 16 && i < static_cast<int>(hostileMessage.size()); i++) {
+			hostileMessage[i] = 0xFF;
+		}
+
+		bool hostileRejected = !probe.decode(hostileMessage, probeText) && probe.lastStatus() == DAEMON_BAD_REQUEST;
+		probeServing = probeServing && probe.decode(probeMessage, probeText) && probeText == "hostile";
+
+		daemon.stop();
+
+		long long loadMs = std::chrono::duration_cast<std::chrono::milliseconds>(loadEnd - loadStart).count();
+
+		std::cout << "+=====+ Compression Daemon Benchmark +=====+" << std::endl;
+		std::cout << "clients:          " << loadClients << " x " << loadRequests << " encode + decode, " << daemon.workers() << " workers" << std::endl;
+		if (!roundTrips.empty()) {
+			std::cout << "round trip:       p50 " << roundTrips[roundTrips.size() / 2] << " us, p99 " << roundTrips[roundTrips.size() * 99 / 100] << " us" << std::endl;
+		}
+		std::cout << "requests:         " << daemonStats.requests_ << " in " << daemonStats.batches_ << " batches, "
+			<< (loadMs > 0 ? daemonStats.requests_ * 1000 / loadMs : 0) << " per second" << std::endl;
+		std::cout << "daemon latency:   p50 " << daemonStats.p50Micros_ << " us, p99 " << daemonStats.p99Micros_ << " us" << std::endl;
+		std::cout << "hostile decode:   " << (hostileRejected ? "rejected" : "NOT REJECTED") << ", daemon "
+			<< (probeServing ? "still serving" : "NOT SERVING") << std::endl;
+		std::cout << std::endl;
+
+	}
+#endif
 	
-	return 0;
+	return (failedChecks == 0) ? 0 : 1;
 
 
 } // end if
\ No newline at end of file